@@ -324,25 +324,27 @@ unsigned char QueryAccelerometerState(void)
  */
 void AccelerometerSetupHandler(tMessage* pMsg)
 {
+  unsigned char Value = GetMessagePayload(pMsg)[0];
+  
   switch (pMsg->Options)
   {
   case ACCELEROMETER_SETUP_OPMODE_OPTION:
-    OperatingModeRegister = pMsg->pBuffer[0];
+    OperatingModeRegister = Value;
     break;
   case ACCELEROMETER_SETUP_INTERRUPT_CONTROL_OPTION:
-    InterruptControl = pMsg->pBuffer[0];
+    InterruptControl = Value;
     break;
   case ACCELEROMETER_SETUP_SID_CONTROL_OPTION:
-    SidControl = pMsg->pBuffer[0];
+    SidControl = Value;
     break;
   case ACCELEROMETER_SETUP_SID_ADDR_OPTION:
-    SidAddr = pMsg->pBuffer[0];
+    SidAddr = Value;
     break;
   case ACCELEROMETER_SETUP_SID_LENGTH_OPTION:
-    SidLength = pMsg->pBuffer[0];
+    SidLength = Value;
     break;
   case ACCELEROMETER_SETUP_INTERRUPT_ENABLE_DISABLE_OPTION:
-    if ( pMsg->pBuffer[0] == 0 )
+    if ( Value == 0 )
     {
       ACCELEROMETER_INT_DISABLE(); 
     }
@@ -361,7 +363,7 @@ void AccelerometerSetupHandler(tMessage* pMsg)
 void AccelerometerAccessHandler(tMessage* pMsg)
 {
   tAccelerometerAccessPayload* pPayload = 
-    (tAccelerometerAccessPayload*) pMsg->pBuffer;
+    (tAccelerometerAccessPayload*) GetMessagePayload(pMsg);
 
   if ( pMsg->Options == ACCELEROMETER_ACCESS_WRITE_OPTION )
   {
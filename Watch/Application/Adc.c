@@ -337,8 +337,8 @@ void LowBatteryMonitor(void)
     {
       LowBatteryBtOffMessageSent = 1;
       
-      SetupMessageAndAllocateBuffer(&Msg,LowBatteryBtOffMsgHost,NO_MSG_OPTIONS);
-      CopyHostMsgPayload(Msg.pBuffer,(unsigned char *)&BatteryAverage,2);
+      SetupMessageWithInlinePayload(&Msg,LowBatteryBtOffMsgHost,NO_MSG_OPTIONS);
+      CopyHostMsgPayload(Msg.InlinePayload,(unsigned char *)&BatteryAverage,2);
       Msg.Length = 2;
       RouteMsg(&Msg);
     
@@ -347,10 +347,10 @@ void LowBatteryMonitor(void)
       RouteMsg(&Msg);
       
       /* now send a vibration to the wearer */
-      SetupMessageAndAllocateBuffer(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
+      SetupMessageWithInlinePayload(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
       
       tSetVibrateModePayload* pMsgData;
-      pMsgData = (tSetVibrateModePayload*) Msg.pBuffer;
+      pMsgData = (tSetVibrateModePayload*) Msg.InlinePayload;
       
       pMsgData->Enable = 1;
       pMsgData->OnDurationLsb = 0x00;
@@ -369,8 +369,8 @@ void LowBatteryMonitor(void)
     {
       LowBatteryWarningMessageSent = 1;
 
-      SetupMessageAndAllocateBuffer(&Msg,LowBatteryWarningMsgHost,NO_MSG_OPTIONS);
-      CopyHostMsgPayload(Msg.pBuffer,(unsigned char*)&BatteryAverage,2);
+      SetupMessageWithInlinePayload(&Msg,LowBatteryWarningMsgHost,NO_MSG_OPTIONS);
+      CopyHostMsgPayload(Msg.InlinePayload,(unsigned char*)&BatteryAverage,2);
       Msg.Length = 2;
       RouteMsg(&Msg);
     
@@ -379,10 +379,10 @@ void LowBatteryMonitor(void)
       RouteMsg(&Msg);
       
       /* now send a vibration to the wearer */
-      SetupMessageAndAllocateBuffer(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
+      SetupMessageWithInlinePayload(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
       
       tSetVibrateModePayload* pMsgData;
-      pMsgData = (tSetVibrateModePayload*) Msg.pBuffer;
+      pMsgData = (tSetVibrateModePayload*) Msg.InlinePayload;
       
       pMsgData->Enable = 1;
       pMsgData->OnDurationLsb = 0x00;
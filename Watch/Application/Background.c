@@ -73,6 +73,9 @@ static void SetCallbackTimerHandler(tMessage* pMsg);
 #define BACKGROUND_STACK_SIZE	   (configMINIMAL_STACK_SIZE + 100)
 #define BACKGROUND_TASK_PRIORITY   (tskIDLE_PRIORITY + 1)
 
+/* the most messages that are handled before the stack and queue checks */
+#define BACKGROUND_BATCH_LENGTH    8
+
 xTaskHandle xBkgTaskHandle;
 
 static tMessage BackgroundMsg;
@@ -215,11 +218,11 @@ static void BackgroundTask(void *pvParameters)
 
   InitializeAccelerometer();
 
-  SetupMessageAndAllocateBuffer(&BackgroundMsg,
+  SetupMessageWithInlinePayload(&BackgroundMsg,
                                 AccelerometerSetupMsg,
                                 ACCELEROMETER_SETUP_INTERRUPT_CONTROL_OPTION);
 
-  BackgroundMsg.pBuffer[0] = INTERRUPT_CONTROL_ENABLE_INTERRUPT;
+  BackgroundMsg.InlinePayload[0] = INTERRUPT_CONTROL_ENABLE_INTERRUPT;
   BackgroundMsg.Length = 1;
   RouteMsg(&BackgroundMsg);
 
@@ -240,14 +243,23 @@ static void BackgroundTask(void *pvParameters)
 
   for(;;)
   {
-    if( pdTRUE == xQueueReceive(QueueHandles[BACKGROUND_QINDEX],
-                                &BackgroundMsg, portMAX_DELAY ) )
+    if( ReceiveMessage(BACKGROUND_QINDEX, &BackgroundMsg, portMAX_DELAY) )
     {
-      PrintMessageType(&BackgroundMsg);
-
-      BackgroundMessageHandler(&BackgroundMsg);
-
-      SendToFreeQueue(&BackgroundMsg);
+      unsigned char Count = 0;
+      
+      /* once awake handle whatever else is already waiting */
+      do
+      {
+        PrintMessageType(&BackgroundMsg);
+
+        BackgroundMessageHandler(&BackgroundMsg);
+
+        SendToFreeQueue(&BackgroundMsg);
+        
+      } while (   ++Count < BACKGROUND_BATCH_LENGTH
+               && ReceiveMessage(BACKGROUND_QINDEX,
+                                 &BackgroundMsg,
+                                 DONT_WAIT) );
 
       CheckStackUsage(xBkgTaskHandle,"Background Task");
 
@@ -271,11 +283,11 @@ static void BackgroundMessageHandler(tMessage* pMsg)
     break;
 
   case GetDeviceType:
-    SetupMessageAndAllocateBuffer(&OutgoingMsg,
+    SetupMessageWithInlinePayload(&OutgoingMsg,
                                   GetDeviceTypeResponse,
                                   NO_MSG_OPTIONS);
 
-    OutgoingMsg.pBuffer[0] = BOARD_TYPE;
+    OutgoingMsg.InlinePayload[0] = BOARD_TYPE;
     OutgoingMsg.Length = 1;
     RouteMsg(&OutgoingMsg);
     break;
@@ -289,7 +301,7 @@ static void BackgroundMessageHandler(tMessage* pMsg)
     break;
 
   case SetRealTimeClock:
-    halRtcSet((tRtcHostMsgPayload*)pMsg->pBuffer);
+    halRtcSet((tRtcHostMsgPayload*)GetMessagePayload(pMsg));
 
 #ifdef DIGITAL
     SetupMessage(&OutgoingMsg,IdleUpdate,NO_MSG_OPTIONS);
@@ -348,13 +360,21 @@ static void BackgroundMessageHandler(tMessage* pMsg)
     break;
 
   case BatteryConfigMsg:
-    SetBatteryLevels(pMsg->pBuffer);
+    SetBatteryLevels(GetMessagePayload(pMsg));
     break;
 
   case ReadBatteryVoltageMsg:
     ReadBatteryVoltageHandler();
     break;
 
+  case QueueTelemetryMsg:
+    QueueTelemetryHandler(pMsg);
+    break;
+
+  case FlowControlMsg:
+    FlowControlHandler(pMsg);
+    break;
+
   case ReadLightSensorMsg:
     ReadLightSensorHandler();
     break;
@@ -429,7 +449,7 @@ static void AdvanceWatchHandsHandler(tMessage* pMsg)
 #ifdef ANALOG
   // overlay a structure pointer on the data section
   tAdvanceWatchHandsPayload* pPayload;
-  pPayload = (tAdvanceWatchHandsPayload*) pMsg->pBuffer;
+  pPayload = (tAdvanceWatchHandsPayload*) GetMessagePayload(pMsg);
 
   if ( pPayload->Hours <= 12 )
   {
@@ -454,44 +474,57 @@ static void AdvanceWatchHandsHandler(tMessage* pMsg)
  * \param tHostMsg* pMsg The message options contain the type of operation that
  * should be performed on the LED outout.
  */
+/* a run of led messages (button presses) only has to change the led and
+ * the timer once 
+ */
 static void LedChangeHandler(tMessage* pMsg)
 {
-  switch (pMsg->Options)
+  tMessage NextMsg;
+  unsigned char Options = pMsg->Options;
+  unsigned char On = LedOn;
+  
+  for(;;)
   {
-  case LED_ON_OPTION:
-    LedOn = 1;
-    ENABLE_LCD_LED();
-    StartOneSecondTimer(LedTimerId);
-    break;
-
-  case LED_TOGGLE_OPTION:
-    if ( LedOn )
+    switch (Options)
     {
-      LedOn = 0;
-      DISABLE_LCD_LED();
-      StopOneSecondTimer(LedTimerId);
+    case LED_ON_OPTION:
+    case LED_START_OFF_TIMER:
+      On = 1;
+      break;
+
+    case LED_TOGGLE_OPTION:
+      On = !On;
+      break;
+
+    case LED_OFF_OPTION:
+    default:
+      On = 0;
+      break;
     }
-    else
+    
+    if (   pdTRUE != xQueuePeek(QueueHandles[BACKGROUND_QINDEX],
+                                &NextMsg, DONT_WAIT)
+        || NextMsg.Type != LedChange )
     {
-      LedOn = 1;
-      ENABLE_LCD_LED();
-      StartOneSecondTimer(LedTimerId);
+      break;
     }
-    break;
-
-  case LED_START_OFF_TIMER:
-    LedOn = 1;
+    
+    ReceiveMessage(BACKGROUND_QINDEX, &NextMsg, DONT_WAIT);
+    Options = NextMsg.Options;
+    SendToFreeQueue(&NextMsg);
+  }
+  
+  LedOn = On;
+  
+  if ( LedOn )
+  {
     ENABLE_LCD_LED();
     StartOneSecondTimer(LedTimerId);
-    break;
-
-  case LED_OFF_OPTION:
-  default:
-    LedOn = 0;
+  }
+  else
+  {
     DISABLE_LCD_LED();
     StopOneSecondTimer(LedTimerId);
-    break;
-
   }
 
 }
@@ -506,7 +539,7 @@ static void LedChangeHandler(tMessage* pMsg)
 static void EnableButtonMsgHandler(tMessage* pMsg)
 {
   tButtonActionPayload* pButtonActionPayload =
-    (tButtonActionPayload*)pMsg->pBuffer;
+    (tButtonActionPayload*)GetMessagePayload(pMsg);
 
   DefineButtonAction(pButtonActionPayload->DisplayMode,
                      pButtonActionPayload->ButtonIndex,
@@ -524,7 +557,7 @@ static void EnableButtonMsgHandler(tMessage* pMsg)
 static void DisableButtonMsgHandler(tMessage* pMsg)
 {
   tButtonActionPayload* pButtonActionPayload =
-    (tButtonActionPayload*)pMsg->pBuffer;
+    (tButtonActionPayload*)GetMessagePayload(pMsg);
 
   DisableButtonAction(pButtonActionPayload->DisplayMode,
                       pButtonActionPayload->ButtonIndex,
@@ -542,7 +575,7 @@ static void ReadButtonConfigHandler(tMessage* pMsg)
 {
   /* map incoming message payload to button information */
   tButtonActionPayload* pButtonActionPayload =
-    (tButtonActionPayload*)pMsg->pBuffer;
+    (tButtonActionPayload*)GetMessagePayload(pMsg);
 
   tMessage OutgoingMsg;
   SetupMessageAndAllocateBuffer(&OutgoingMsg,
@@ -650,7 +683,8 @@ static void SoftwareResetHandler(tMessage* pMsg)
 static void NvalOperationHandler(tMessage* pMsg)
 {
   /* overlay */
-  tNvalOperationPayload* pNvPayload = (tNvalOperationPayload*)pMsg->pBuffer;
+  tNvalOperationPayload* pNvPayload = 
+    (tNvalOperationPayload*)GetMessagePayload(pMsg);
 
   /* create the outgoing message */
   tMessage OutgoingMsg;
@@ -853,7 +887,8 @@ static unsigned char RateTestCallback(void)
 
 static void SetCallbackTimerHandler(tMessage* pMsg)
 {
-  tSetCallbackTimerPayload *pPayload = (tSetCallbackTimerPayload *)(pMsg->pBuffer);
+  tSetCallbackTimerPayload *pPayload = 
+    (tSetCallbackTimerPayload *)GetMessagePayload(pMsg);
 
   StopOneSecondTimer(CallbackTimerId);
 
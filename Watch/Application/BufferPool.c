@@ -35,28 +35,53 @@
 #include "DebugUart.h"
 #include "Utilities.h"
 
-/*! \param buffer is a buffer of HOST_MSG_BUFFER_LENGTH whose address goes
- * onto a queue
-*/
+/* Each buffer starts with HOST_MSG_HEADER_LENGTH bytes of header so that a 
+ * single call to SPP_write can be made (~hack).  The address of the data 
+ * section after the header is handed out by the allocator.
+ *
+ * The storage is declared as words so that the free list pointer kept in 
+ * the data section of a free buffer is aligned.
+ */
+#if ( (HOST_MSG_BUFFER_LENGTH % 2) || (HOST_MSG_HEADER_LENGTH % 2) )
+  #error "Message buffer length must be even"
+#endif
+
+/* the in use bits are kept in a long */
+#if NUM_MSG_BUFFERS > 32
+  #error "NUM_MSG_BUFFERS must be 32 or less"
+#endif
+
+/*! A free buffer holds a pointer to the next free buffer in its data section
+ * (intrusive free list)
+ *
+ * \param pNext is the data section of the next free buffer (or NULL)
+ */
 typedef struct
 {
-  /* ~hack
-   * add bytes for the header so that a single call to SPP_write can be made
-   */
-  unsigned char header[HOST_MSG_HEADER_LENGTH];
-  unsigned char buffer[HOST_MSG_BUFFER_LENGTH-HOST_MSG_HEADER_LENGTH];  
-
-} tBufferPoolBuffer;    
+  unsigned char* pNext;
 
+} tFreeBufferLink;
 
 // This memory is never accessed directly, pointers to the buffers are put on
-// a queue at startup
-static tBufferPoolBuffer BufferPool[NUM_MSG_BUFFERS];
+// the free list at startup
+static unsigned int BufferPool[(HOST_MSG_BUFFER_LENGTH * NUM_MSG_BUFFERS) / 2];
 
-// all pointers on/off the queue must be in this range, use these to check the
-// buffer free to make sure we don't trash the pool
-static const unsigned char* LOW_BUFFER_ADDRESS   = &(BufferPool[0].buffer[0]);
-static const unsigned char* HIGH_BUFFER_ADDRESS  = &(BufferPool[NUM_MSG_BUFFERS - 1].buffer[0]);
+// all pointers on/off the free list must be in this range, use these to check 
+// the buffer free to make sure we don't trash the pool
+static const unsigned char* LOW_BUFFER_ADDRESS = 
+  (unsigned char*)BufferPool + HOST_MSG_HEADER_LENGTH;
+
+static const unsigned char* HIGH_BUFFER_ADDRESS = 
+  (unsigned char*)BufferPool + HOST_MSG_HEADER_LENGTH 
+  + (NUM_MSG_BUFFERS - 1) * HOST_MSG_BUFFER_LENGTH;
+
+/* head of the free list and one bit for each buffer that has been allocated */
+static unsigned char* pFreeListHead;
+static unsigned long InUseMask;
+
+/* number of buffers allocated and the largest number allocated at one time */
+static unsigned char InUse;
+static unsigned char HighWater;
 
 static void SetBufferPoolFailureBit(void)
 {
@@ -64,131 +89,230 @@ static void SetBufferPoolFailureBit(void)
   ForceWatchdogReset();  
 }
 
+/* The print functions cannot be used in interrupt context */
+static void SetBufferPoolFailureBitIsr(void)
+{
+  gAppStats.BufferPoolFailure = 1;
+  ForceWatchdogReset();  
+}
+
+/* \return the index of the buffer or NUM_MSG_BUFFERS when pBuffer is not the 
+ * start of the data section of a buffer in the pool
+ */
+static unsigned char GetPoolIndex(const unsigned char* pBuffer)
+{
+  if (   pBuffer < LOW_BUFFER_ADDRESS 
+      || pBuffer > HIGH_BUFFER_ADDRESS )
+  {
+    return NUM_MSG_BUFFERS;
+  }
+  
+  unsigned int Offset = (unsigned int)(pBuffer - LOW_BUFFER_ADDRESS);
+  
+  if ( Offset % HOST_MSG_BUFFER_LENGTH )
+  {
+    return NUM_MSG_BUFFERS;
+  }
+  
+  return (unsigned char)(Offset / HOST_MSG_BUFFER_LENGTH);
+}
+
 void InitializeBufferPool( void )
 {
   unsigned int  ii;              // loop counter
-  unsigned char* pMsgBuffer;      // holds the address of the msg buffer to add to the queue
   
-  // create the queue to hold the free message buffers
-  QueueHandles[FREE_QINDEX] =
-    xQueueCreate( ( unsigned portBASE_TYPE ) NUM_MSG_BUFFERS,
-                  ( unsigned portBASE_TYPE ) sizeof(unsigned char*) );
+  pFreeListHead = NULL;
+  InUseMask = 0;
+  InUse = 0;
+  HighWater = 0;
   
-  // Add the address of each buffer's data section to the queue
-  for(ii = 0; ii < NUM_MSG_BUFFERS; ii++)
+  // Add the address of each buffer's data section to the free list
+  for(ii = NUM_MSG_BUFFERS; ii > 0; ii--)
   {
-      // use the address of the data section so that the header is only accessed
-      // as needed
-      pMsgBuffer = & (BufferPool[ii].buffer[0]);
+    // use the address of the data section so that the header is only 
+    // accessed as needed
+    unsigned char* pMsgBuffer = 
+      (unsigned char*)LOW_BUFFER_ADDRESS + (ii-1) * HOST_MSG_BUFFER_LENGTH;
+
+    /* the link is accessed as a word so it must be on an even address */
+    if ( (unsigned int)pMsgBuffer & 0x01 )
+    {
+      PrintString("Buffer Pool is not word aligned\r\n");
+      SetBufferPoolFailureBit();
+    }
+
+    ((tFreeBufferLink*)pMsgBuffer)->pNext = pFreeListHead;
+    pFreeListHead = pMsgBuffer;
+  }
+}
+
+/* Pop the head of the free list.  This saves and restores the interrupt
+ * state so it can be called from a task or an isr.
+ *
+ * \return 0 if a buffer was allocated, 1 if the pool is empty and 2 if the
+ * free list is corrupt
+ */
+static unsigned char AllocBuffer(unsigned char** ppBuffer)
+{
+  unsigned char Result = 0;
+  unsigned char Index;
+  unsigned char* pBuffer;
+  
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
   
-      // We only call this at initialization so it should never fail
-      // params: queue handle, ptr to item to queue, ticks to wait if full
-      if ( xQueueSend( QueueHandles[FREE_QINDEX], &pMsgBuffer, DONT_WAIT ) != pdTRUE )
+  pBuffer = pFreeListHead;
+  
+  if ( pBuffer == NULL )
+  {
+    Result = 1;
+  }
+  else
+  {
+    Index = GetPoolIndex(pBuffer);
+    
+    if (   Index == NUM_MSG_BUFFERS 
+        || (InUseMask & (1UL << Index)) )
+    {
+      Result = 2;
+    }
+    else
+    {
+      pFreeListHead = ((tFreeBufferLink*)pBuffer)->pNext;
+      InUseMask |= (1UL << Index);
+      
+      InUse++;
+      if ( InUse > HighWater )
       {
-        PrintString("Unable to build Free Queue\r\n");
-        SetBufferPoolFailureBit();
+        HighWater = InUse;
       }
+    }
+  }
+  
+  __set_interrupt_state(IntState);
+  
+  *ppBuffer = pBuffer;
+  return Result;
+}
+
+/* Push a buffer onto the free list.  Safe in task and isr context.
+ *
+ * \return 0 if the buffer was freed, 1 if the pointer isn't a pool buffer 
+ * and 2 if the buffer was already free
+ */
+static unsigned char FreeBuffer(unsigned char* pBuffer)
+{
+  unsigned char Result = 0;
+  
+  // make sure the returned pointer is the start of a buffer
+  unsigned char Index = GetPoolIndex(pBuffer);
+  
+  if ( Index == NUM_MSG_BUFFERS )
+  {
+    return 1;  
   }
+  
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  if ( (InUseMask & (1UL << Index)) == 0 )
+  {
+    Result = 2;
+  }
+  else
+  {
+    InUseMask &= ~(1UL << Index);
+    InUse--;
+    ((tFreeBufferLink*)pBuffer)->pNext = pFreeListHead;
+    pFreeListHead = pBuffer;
+  }
+  
+  __set_interrupt_state(IntState);
+  
+  return Result;
 }
 
 unsigned char* BPL_AllocMessageBuffer(void)
 {
   unsigned char * pBuffer = NULL;
 
-  // params are: queue handle, ptr to the msg buffer, ticks to wait
-  if( pdTRUE != xQueueReceive( QueueHandles[FREE_QINDEX], &pBuffer, DONT_WAIT ) )
+  switch ( AllocBuffer(&pBuffer) )
   {
+  case 1:
     PrintString("Unable to Allocate Buffer\r\n");
     SetBufferPoolFailureBit();
-  }
-
-  if (   pBuffer < LOW_BUFFER_ADDRESS 
-      || pBuffer > HIGH_BUFFER_ADDRESS )
-  {
+    break;
+  case 2:
     PrintString("Free Buffer Corruption\r\n");
     SetBufferPoolFailureBit();
-}
+    break;
+  default:
+    break;
+  }
 
   return pBuffer;
 
 }
 
-#if 0
-/* This is too slow to use */
-unsigned char* BPL_AllocMessageBufferFromISR(void)
+unsigned char* BPL_AllocMessageBufferFromIsr(void)
 {  
   unsigned char * pBuffer = NULL;
 
-  signed portBASE_TYPE HigherPriorityTaskWoken;
-  
-  // params are: queue handle, ptr to the msg buffer, ticks to wait
-  if( pdTRUE != xQueueReceiveFromISR(QueueHandles[FREE_QINDEX], 
-                                     &pBuffer, 
-                                     &HigherPriorityTaskWoken ))
+  if ( AllocBuffer(&pBuffer) != 0 )
   {
-    PrintString("Unable to Allocate Buffer from Isr\r\n");
-    SetBufferPoolFailureBit();
-  }
-  
-  if ( HigherPriorityTaskWoken == pdTRUE )
-  {
-    portYIELD();
+    SetBufferPoolFailureBitIsr();
   }
   
   return pBuffer;
   
 }
-#endif
 
 void BPL_FreeMessageBuffer(unsigned char* pBuffer)
 {
-  // make sure the returned pointer is in range
-  if (   pBuffer < LOW_BUFFER_ADDRESS 
-      || pBuffer > HIGH_BUFFER_ADDRESS )
+  switch ( FreeBuffer(pBuffer) )
   {
+  case 1:
     PrintString("Free Buffer Corruption\r\n");
     SetBufferPoolFailureBit();
-  }
-
-  // params are: queue handle, ptr to item to queue, tick to wait if full
-  // the queue can't be full unless there is a bug, so don't wait on full
-  if( pdTRUE != xQueueSend(QueueHandles[FREE_QINDEX], &pBuffer, DONT_WAIT) )
-{
-    PrintString("Unable to add buffer to Free Queue\r\n");
+    break;
+  case 2:
+    PrintString("Buffer freed twice\r\n");
     SetBufferPoolFailureBit();
+    break;
+  default:
+    break;
   }
 
 }
 
 void BPL_FreeMessageBufferFromIsr(unsigned char* pBuffer)
 {
-  // make sure the returned pointer is in range
-  if (   pBuffer < LOW_BUFFER_ADDRESS 
-      || pBuffer > HIGH_BUFFER_ADDRESS )
+  if ( FreeBuffer(pBuffer) != 0 )
   {
-    PrintString("Free Buffer Corruption\r\n");
-    SetBufferPoolFailureBit();
+    SetBufferPoolFailureBitIsr();
   }
-
-  signed portBASE_TYPE HigherPriorityTaskWoken;
   
-  // params are: queue handle, ptr to item to queue, tick to wait if full
-  // the queue can't be full unless there is a bug, so don't wait on full
-  if( pdTRUE != xQueueSendFromISR(QueueHandles[FREE_QINDEX], 
-                                  &pBuffer, 
-                                  &HigherPriorityTaskWoken) )
-  {
-    PrintString("Unable to add buffer to Free Queue\r\n");
-    SetBufferPoolFailureBit();
-  }
+}
 
-#if 0
-  /* this should never be true when freeing a message buffer */
-  if ( HigherPriorityTaskWoken == pdTRUE )
-  {
-    portYIELD();
-  }
-#endif
+void BPL_GetStatistics(tBufferPoolStatistics* pStats)
+{
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  pStats->Count = NUM_MSG_BUFFERS;
+  pStats->InUse = InUse;
+  pStats->HighWater = HighWater;
+  
+  __set_interrupt_state(IntState);
   
 }
 
+void BPL_PrintStatistics(void)
+{
+  tBufferPoolStatistics Stats;
+  
+  BPL_GetStatistics(&Stats);
+  PrintStringAndTwoDecimals("Buffers ", Stats.Count,
+                            " High Water ", Stats.HighWater);
+  
+}
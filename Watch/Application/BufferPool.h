@@ -18,8 +18,13 @@
 /*! \file BufferPool.h
  *
  * The buffer pool is block of memory used for message allocation.  All of the 
- * free buffers are put into the free queue.
+ * free buffers are kept on an intrusive free list.  Allocation and free are 
+ * constant time and only disable interrupts for a few instructions so they can
+ * be used in task and interrupt context.
  *
+ * All buffers are HOST_MSG_BUFFER_LENGTH.  The stack library allocates the 
+ * messages from the phone with SetupMessageAndAllocateBuffer and sends 
+ * messages of at most one buffer, so a larger size class would have no user.
  */
 /******************************************************************************/
 
@@ -31,7 +36,21 @@
 #endif
 
 
-/*! Initialize memory used by the buffer pool.  The buffer pool is a queue
+/*! Statistics of the buffer pool
+ *
+ * \param Count is the number of buffers in the pool
+ * \param InUse is the number of buffers currently allocated
+ * \param HighWater is the largest number of buffers allocated at one time
+ */
+typedef struct
+{
+  unsigned char Count;
+  unsigned char InUse;
+  unsigned char HighWater;
+
+} tBufferPoolStatistics;
+
+/*! Initialize memory used by the buffer pool.  The buffer pool is a list
  * that holds free memory buffers that are used for tHostMsg messages.
  */
 void InitializeBufferPool(void);
@@ -42,20 +61,36 @@ void InitializeBufferPool(void);
  */
 unsigned char* BPL_AllocMessageBuffer(void);
 
+/*! Remove a message from the free buffer pool in interrupt context.  An 
+ * allocation failure results in a watchdog reset (without a print).
+ * 
+ * \return a pointer to a buffer
+ */
+unsigned char* BPL_AllocMessageBufferFromIsr(void);
+
 /*! Add a message to the free buffer pool.  This function performs basic memory
- * range checking.
+ * range checking and detects a buffer that is freed twice.
  * 
  * \param pBuffer points to the message buffer to be freed (added
- * to the free queue).
+ * to the free list).
  */
 void BPL_FreeMessageBuffer(unsigned char* pBuffer);
 
-/*! Add a message to the free buffer pool.  This function performs basic memory
- * range checking.
+/*! Add a message to the free buffer pool in interrupt context.  This function
+ * performs the same checks as BPL_FreeMessageBuffer.
  * 
  * \param pBuffer points to the message buffer to be freed (added
- * to the free queue).
+ * to the free list).
  */
 void BPL_FreeMessageBufferFromIsr(unsigned char* pBuffer);
 
+/*! Read the usage statistics of the buffer pool
+ *
+ * \param pStats is where the statistics are stored
+ */
+void BPL_GetStatistics(tBufferPoolStatistics* pStats);
+
+/*! Print the number of buffers and the high-water mark of the pool */
+void BPL_PrintStatistics(void);
+
 #endif /* BUFFER_POOL_H */
@@ -407,12 +407,12 @@ static void HandleButtonEvent(unsigned char ButtonIndex,
          */
         if ( Type == ButtonEventMsg )
         {
-          SetupMessageAndAllocateBuffer(&OutgoingEventMsg, Type, Options);
-          OutgoingEventMsg.pBuffer[0] = ButtonIndex;
-          OutgoingEventMsg.pBuffer[1] = QueryButtonMode();
-          OutgoingEventMsg.pBuffer[2] = ButtonPressType;
-          OutgoingEventMsg.pBuffer[3] = Type;
-          OutgoingEventMsg.pBuffer[4] = Options;
+          SetupMessageWithInlinePayload(&OutgoingEventMsg, Type, Options);
+          OutgoingEventMsg.InlinePayload[0] = ButtonIndex;
+          OutgoingEventMsg.InlinePayload[1] = QueryButtonMode();
+          OutgoingEventMsg.InlinePayload[2] = ButtonPressType;
+          OutgoingEventMsg.InlinePayload[3] = Type;
+          OutgoingEventMsg.InlinePayload[4] = Options;
           OutgoingEventMsg.Length = 5;
         }
         else
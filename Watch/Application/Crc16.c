@@ -0,0 +1,46 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Crc16.c
+ *
+ */
+/******************************************************************************/
+
+#include "Crc16.h"
+
+/* the CRC of each nibble value, a byte takes two lookups */
+static const unsigned int Crc16Table[16] = 
+{
+  0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+  0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF
+};
+
+unsigned int Crc16(unsigned int Crc, 
+                   const unsigned char* pData, 
+                   unsigned int Length)
+{
+  while ( Length-- )
+  {
+    unsigned char Byte = *pData++;
+    
+    Crc = (Crc << 4) ^ Crc16Table[((Crc >> 12) ^ (Byte >> 4)) & 0x0F];
+    Crc = (Crc << 4) ^ Crc16Table[((Crc >> 12) ^ Byte) & 0x0F];
+  }
+  
+  return Crc & 0xFFFF;
+  
+}
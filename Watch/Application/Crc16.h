@@ -0,0 +1,42 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file Crc16.h
+ *
+ * CRC-16 with the CCITT polynomial (0x1021), most significant bit first.  
+ * With CRC16_INIT the check value of "123456789" is 0x29B1.
+ */
+/******************************************************************************/
+
+#ifndef CRC16_H
+#define CRC16_H
+
+#define CRC16_INIT ( 0xFFFF )
+
+/*! Add bytes to a CRC.  This does not use the CRC module of the part so it
+ * can be called from any task.
+ *
+ * \param Crc is CRC16_INIT or the result of the previous call
+ * \param pData points to the bytes
+ * \param Length is the number of bytes
+ * \return the CRC
+ */
+unsigned int Crc16(unsigned int Crc, 
+                   const unsigned char* pData, 
+                   unsigned int Length);
+
+#endif /* CRC16_H */
@@ -30,11 +30,13 @@
 #include "hal_board_type.h"
 #include "hal_clock_control.h"
 #include "hal_rtc.h"
+#include "hal_crystal_timers.h"
 
 #include "DebugUart.h"
 #include "Statistics.h"
 #include "task.h"
 #include "Utilities.h"
+#include "Crc16.h"
 
 #define TX_BUFFER_SIZE ( 64 )
 static unsigned char TxBuffer[TX_BUFFER_SIZE];
@@ -47,6 +49,23 @@ static void WriteTxBuffer(tString * const pBuf);
 static void IncrementWriteIndex(void);
 static void IncrementReadIndex(void);
 
+typedef struct
+{
+  unsigned char Id;
+  unsigned char Arg1;
+  unsigned int Timestamp;
+  unsigned int Arg2;
+  
+} tTraceRecord;
+
+#define TRACE_RING_LENGTH ( 32 )
+
+static tTraceRecord TraceRing[TRACE_RING_LENGTH];
+static unsigned char TraceWriteIndex;
+static unsigned char TraceReadIndex;
+static unsigned char TraceCount;
+static unsigned int TraceLost;
+
 
 static unsigned char DisableSmClkCounter;
 
@@ -468,6 +487,121 @@ void PrintTimeStamp(void)
   WriteTxBuffer(" ");
 }
 
+/******************************************************************************/
+
+void TraceEvent(unsigned char Id, unsigned char Arg1, unsigned int Arg2)
+{
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  if ( TraceCount < TRACE_RING_LENGTH )
+  {
+    tTraceRecord* pRecord = &TraceRing[TraceWriteIndex];
+    
+    pRecord->Id = Id;
+    pRecord->Arg1 = Arg1;
+    pRecord->Timestamp = ReadCrystalTimerCount();
+    pRecord->Arg2 = Arg2;
+    
+    TraceWriteIndex++;
+    if ( TraceWriteIndex == TRACE_RING_LENGTH )
+    {
+      TraceWriteIndex = 0;
+    }
+    
+    TraceCount++;
+  }
+  else
+  {
+    TraceLost++;
+  }
+  
+  __set_interrupt_state(IntState);
+  
+}
+
+/* a frame is only written when all of it fits so that text does not end up 
+ * in the middle of a record 
+ */
+static void WriteTraceFrame(tTraceRecord* pRecord)
+{
+  unsigned char Frame[TRACE_FRAME_SIZE];
+  unsigned char i;
+  
+  Frame[0] = TRACE_RECORD_START;
+  Frame[1] = pRecord->Id;
+  Frame[2] = pRecord->Arg1;
+  Frame[3] = (unsigned char)pRecord->Timestamp;
+  Frame[4] = (unsigned char)(pRecord->Timestamp >> 8);
+  Frame[5] = (unsigned char)pRecord->Arg2;
+  Frame[6] = (unsigned char)(pRecord->Arg2 >> 8);
+  
+  unsigned int Crc = Crc16(CRC16_INIT, Frame, TRACE_FRAME_SIZE - 2);
+  Frame[7] = (unsigned char)Crc;
+  Frame[8] = (unsigned char)(Crc >> 8);
+  
+  for ( i = 0; i < TRACE_FRAME_SIZE; i++ )
+  {
+    TxBuffer[WriteIndex] = Frame[i];
+    IncrementWriteIndex();
+  }
+  
+  TxCount += TRACE_FRAME_SIZE;
+  
+  if ( TxBusy == 0 )
+  {
+    EnableSmClkUser(BT_DEBUG_UART_USER);
+    UCA3TXBUF = TxBuffer[ReadIndex];
+    IncrementReadIndex();
+    TxBusy = 1;
+    TxCount--;  
+  }
+  
+}
+
+void DrainTrace(void)
+{
+  tTraceRecord Record;
+  
+  for(;;)
+  {
+    portENTER_CRITICAL();
+    
+    if (   TxCount > TX_BUFFER_SIZE - TRACE_FRAME_SIZE 
+        || (TraceCount == 0 && TraceLost == 0) )
+    {
+      portEXIT_CRITICAL();
+      break;
+    }
+    
+    if ( TraceLost )
+    {
+      Record.Id = TRACE_LOST;
+      Record.Arg1 = 0;
+      Record.Timestamp = ReadCrystalTimerCount();
+      Record.Arg2 = TraceLost;
+      TraceLost = 0;
+    }
+    else
+    {
+      Record = TraceRing[TraceReadIndex];
+      
+      TraceReadIndex++;
+      if ( TraceReadIndex == TRACE_RING_LENGTH )
+      {
+        TraceReadIndex = 0;
+      }
+      
+      TraceCount--;
+    }
+    
+    WriteTraceFrame(&Record);
+    
+    portEXIT_CRITICAL();
+  }
+  
+}
+
 /* callback from FreeRTOS 
  *
  * if the bt stack is open and closed enough then memory becomes fragmented
@@ -114,4 +114,47 @@ void ByteToHexString(unsigned char Value, tString * pString);
 /*! Print the RTCPS */
 void PrintTimeStamp(void);
 
+/*! Trace event identifiers
+ *
+ * A trace record is an event id, the crystal timer count (0.9765625 ms) 
+ * and two arguments.  On the uart a record is a TRACE_FRAME_SIZE frame:
+ * TRACE_RECORD_START, Id (1), Arg1 (1), Timestamp (2), Arg2 (2) and the 
+ * Crc16 of the first seven bytes (2).  Values are little endian.  
+ *
+ * Text never contains TRACE_RECORD_START but the arguments can.  A reader 
+ * that has lost its place takes a TRACE_RECORD_START as the start of a 
+ * frame only when the CRC matches; otherwise it moves on by one byte.  
+ * Tools/TraceDecode separates the text and the records.
+ *
+ * \param TRACE_LOST Arg2 is the number of records that did not fit
+ * \param TRACE_MESSAGE Arg1 is the message type and Arg2 the options
+ * \param TRACE_UNKNOWN_MESSAGE Arg1 is the message type
+ * \param TRACE_UPDATE_DISPLAY Arg1 is the message length and Arg2 is the
+ * start row (high byte) and the number of rows (low byte)
+ * \param TRACE_BUFFER_STATUS Arg1 is the buffer select mode and Arg2 has a
+ * nibble for each buffer of the mode (see GetBufferStatusTrace)
+ */
+#define TRACE_LOST            ( 0x00 )
+#define TRACE_MESSAGE         ( 0x01 )
+#define TRACE_UNKNOWN_MESSAGE ( 0x02 )
+#define TRACE_UPDATE_DISPLAY  ( 0x03 )
+#define TRACE_BUFFER_STATUS   ( 0x04 )
+
+#define TRACE_RECORD_START    ( 0x1E )
+#define TRACE_FRAME_SIZE      ( 9 )
+
+/*! Put a record into the trace ring.  This does not format anything and can
+ * be called in interrupt context.  When the ring is full the record is lost.
+ *
+ * \param Id is the event id
+ * \param Arg1 is the first argument
+ * \param Arg2 is the second argument
+ */
+void TraceEvent(unsigned char Id, unsigned char Arg1, unsigned int Arg2);
+
+/*! Move trace records from the ring to the uart while there is room.  This is
+ * called by the idle task.
+ */
+void DrainTrace(void);
+
 #endif
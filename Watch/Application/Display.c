@@ -209,10 +209,10 @@ void GenerateLinkAlarm(void)
 {
   tMessage Msg;
   
-  SetupMessageAndAllocateBuffer(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
+  SetupMessageWithInlinePayload(&Msg,SetVibrateMode,NO_MSG_OPTIONS);
   
   tSetVibrateModePayload* pMsgData;
-  pMsgData = (tSetVibrateModePayload*) Msg.pBuffer;
+  pMsgData = (tSetVibrateModePayload*) Msg.InlinePayload;
   
   pMsgData->Enable = 1;
   pMsgData->OnDurationLsb = 0x00;
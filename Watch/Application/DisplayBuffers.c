@@ -0,0 +1,221 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file DisplayBuffers.c
+*
+* Buffer selection for reads, writes and updates of the display buffers.  
+* This does not touch the serial ram.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "Messages.h"
+#include "DisplayBuffers.h"
+
+#define TRACE_RECENT ( BIT3 )
+
+static unsigned char GetMailboxIndex(unsigned char Mode, unsigned char Type);
+
+static unsigned char NumberOfBuffers[NUMBER_OF_MODES];
+static unsigned char FrontBuffer[NUMBER_OF_MODES];
+
+// Status of buffers (2 or 3 for each of 4 display modes): 
+// 0: clean; 1: buffer read done; 2: buffer is writing; 3: buffer is written
+static unsigned char BufferStatus[NUMBER_OF_MODES][MAX_NUMBER_OF_BUFFERS];
+
+// Rules for deciding which of the two buffers to read and write
+static const unsigned char BufSelRule[2][3] =
+  {{BUFFER_WRITTEN, BUFFER_WRITING}, // for read
+   {BUFFER_WRITING, BUFFER_CLEAN, BUFFER_WRITTEN}
+  };
+
+void InitDisplayBuffers(unsigned char const * pBuffersPerMode)
+{
+  unsigned char Mode;
+  unsigned char i;
+  
+  for ( Mode = 0; Mode < NUMBER_OF_MODES; Mode++ )
+  {
+    NumberOfBuffers[Mode] = pBuffersPerMode[Mode];
+    FrontBuffer[Mode] = 0;
+    
+    for ( i = 0; i < MAX_NUMBER_OF_BUFFERS; i++ )
+    {
+      BufferStatus[Mode][i] = BUFFER_CLEAN;
+    }
+  }
+}
+
+unsigned char GetNumberOfBuffers(unsigned char Mode)
+{
+  return NumberOfBuffers[Mode];
+}
+
+unsigned char GetBufferIndex(unsigned char Mode, unsigned char Type)
+{
+  unsigned char j, i;
+  unsigned char NumberOfRules = (Type == BUFFER_TYPE_READ) ?
+    NUMBER_OF_READ_BUFFER_SEL_RULES : NUMBER_OF_WRITE_BUFFER_SEL_RULES;
+  
+  if ( NumberOfBuffers[Mode] == MAX_NUMBER_OF_BUFFERS )
+  {
+    return GetMailboxIndex(Mode, Type);
+  }
+  
+  for (j = 0; j < NumberOfRules; j++)
+  {
+    for (i = 0; i < NUMBER_OF_BUFFERS; i++)
+    {
+      if ((BufferStatus[Mode][i] & BUFFER_STATUS_MASK) == BufSelRule[Type][j]) {
+        return (Mode << 2) + i;
+      }
+    }
+  }
+
+  return GetRecentBufferIndex(Mode);
+}
+
+/* read: the frame that is waiting, then the one being written (for phones
+ * that don't mark the last write) and then the front buffer again
+ *
+ * write: the back buffer, then any buffer that isn't the front buffer, 
+ * being displayed or waiting to be displayed
+ */
+static unsigned char GetMailboxIndex(unsigned char Mode, unsigned char Type)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < MAX_NUMBER_OF_BUFFERS; i++ )
+  {
+    unsigned char Status = BufferStatus[Mode][i] & BUFFER_STATUS_MASK;
+    
+    if (   (Type == BUFFER_TYPE_READ && Status == BUFFER_WRITTEN)
+        || (Type != BUFFER_TYPE_READ && Status == BUFFER_WRITING) )
+    {
+      return (Mode << 2) + i;
+    }
+  }
+  
+  for ( i = 0; i < MAX_NUMBER_OF_BUFFERS; i++ )
+  {
+    unsigned char Status = BufferStatus[Mode][i] & BUFFER_STATUS_MASK;
+    
+    if ( Type == BUFFER_TYPE_READ && Status == BUFFER_WRITING )
+    {
+      return (Mode << 2) + i;
+    }
+    
+    if (   Type != BUFFER_TYPE_READ 
+        && Status != BUFFER_WRITTEN 
+        && Status != BUFFER_READING
+        && i != FrontBuffer[Mode] )
+    {
+      return (Mode << 2) + i;
+    }
+  }
+  
+  return (Mode << 2) + FrontBuffer[Mode];
+}
+
+unsigned char GetRecentBufferIndex(unsigned char Mode)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < NumberOfBuffers[Mode]; i++ )
+  {
+    if ( BufferStatus[Mode][i] & BUFFER_STATUS_RECENT )
+    {
+      return (Mode << 2) + i;
+    }
+  }
+  
+  return (Mode << 2) + 1;
+}
+
+unsigned char GetDrawBufferIndex(unsigned char ShownIndex)
+{
+  unsigned char Mode = ShownIndex >> 2;
+  unsigned char DrawIndex = 
+    ( NumberOfBuffers[Mode] == MAX_NUMBER_OF_BUFFERS ) ?
+    GetBufferIndex(Mode, BUFFER_TYPE_WRITE) : ShownIndex ^ 1;
+  unsigned char Status = GetBufferStatus(DrawIndex);
+  
+  /* a frame that the phone has started or finished is not overwritten */
+  if (   DrawIndex == ShownIndex
+      || Status == BUFFER_WRITING
+      || Status == BUFFER_WRITTEN )
+  {
+    return BUFFER_UNAVAILABLE;
+  }
+  
+  return DrawIndex;
+}
+
+unsigned char GetBufferStatus(unsigned char Index)
+{
+  return BufferStatus[Index >> 2][Index & 0x03] & BUFFER_STATUS_MASK;
+}
+
+void SetBufferStatus(unsigned char Index, unsigned char Status)
+{
+  unsigned char Mode = Index >> 2;
+  unsigned char Buffer = Index & 0x03;
+  unsigned char i;
+  
+  // Mark the buffer "current" and remove the "current" flag of the others
+  for ( i = 0; i < NumberOfBuffers[Mode]; i++ )
+  {
+    BufferStatus[Mode][i] &= BUFFER_STATUS_MASK;
+    
+    /* a newer frame replaces one that is waiting to be displayed */
+    if (   NumberOfBuffers[Mode] == MAX_NUMBER_OF_BUFFERS 
+        && Status == BUFFER_WRITTEN
+        && BufferStatus[Mode][i] == BUFFER_WRITTEN )
+    {
+      BufferStatus[Mode][i] = BUFFER_CLEAN;
+    }
+  }
+  
+  /* a buffer is clean after it has been displayed */
+  if ( Status == BUFFER_CLEAN )
+  {
+    FrontBuffer[Mode] = Buffer;
+  }
+  
+  BufferStatus[Mode][Buffer] = Status | BUFFER_STATUS_RECENT;
+}
+
+unsigned int GetBufferStatusTrace(unsigned char Mode)
+{
+  unsigned int Trace = 0;
+  unsigned char i;
+  
+  for ( i = 0; i < NumberOfBuffers[Mode]; i++ )
+  {
+    unsigned char Nibble = BufferStatus[Mode][i] & 0x03;
+    
+    if ( BufferStatus[Mode][i] & BUFFER_STATUS_RECENT )
+    {
+      Nibble |= TRACE_RECENT;
+    }
+    
+    Trace |= (unsigned int)Nibble << (i << 2);
+  }
+  
+  return Trace;
+}
@@ -0,0 +1,89 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file DisplayBuffers.h
+ *
+ * The state of the display buffers in the serial ram.  Each display mode has
+ * NUMBER_OF_BUFFERS (double buffering) or MAX_NUMBER_OF_BUFFERS.  A buffer 
+ * index is (Mode << 2) + Buffer.
+ *
+ * When there are three buffers for a mode they are used as a mailbox: the
+ * front buffer is what was displayed last, a written buffer is a complete 
+ * frame that is waiting to be displayed and the back buffer is the one 
+ * being written.  A write never goes to the front buffer so the phone does
+ * not have to wait for an update to finish before it starts the next frame.
+ */
+/******************************************************************************/
+
+#ifndef DISPLAY_BUFFERS_H
+#define DISPLAY_BUFFERS_H
+
+#define MAX_NUMBER_OF_BUFFERS ( 3 )
+
+/*! Set the number of buffers of each mode and mark all buffers clean
+ *
+ * \param pBuffersPerMode is NUMBER_OF_BUFFERS or MAX_NUMBER_OF_BUFFERS for 
+ * each mode
+ */
+void InitDisplayBuffers(unsigned char const * pBuffersPerMode);
+
+/*! \return the number of buffers of a mode */
+unsigned char GetNumberOfBuffers(unsigned char Mode);
+
+/*! \return the buffer index to read (BUFFER_TYPE_READ) or write
+ * (BUFFER_TYPE_WRITE)
+ *
+ * \param Mode is the buffer select mode
+ * \param Type is BUFFER_TYPE_READ or BUFFER_TYPE_WRITE
+ */
+unsigned char GetBufferIndex(unsigned char Mode, unsigned char Type);
+
+/*! \return the buffer index of the buffer that was written or displayed 
+ * last (the second buffer when no buffer has been used)
+ *
+ * \param Mode is the buffer select mode
+ */
+unsigned char GetRecentBufferIndex(unsigned char Mode);
+
+/*! \return the buffer index that the screen is copied into after an update
+ * or BUFFER_UNAVAILABLE when that buffer is the one shown or the phone has 
+ * started or finished a frame in it
+ *
+ * \param ShownIndex is the buffer index that was displayed
+ */
+unsigned char GetDrawBufferIndex(unsigned char ShownIndex);
+
+/*! \return the status of a buffer (BUFFER_CLEAN ... BUFFER_WRITTEN) */
+unsigned char GetBufferStatus(unsigned char Index);
+
+/*! Set the status of a buffer and make it the recent buffer of its mode
+ *
+ * \param Index is the buffer index
+ * \param Status is BUFFER_CLEAN, BUFFER_READING, BUFFER_WRITING or 
+ * BUFFER_WRITTEN
+ */
+void SetBufferStatus(unsigned char Index, unsigned char Status);
+
+/*! \return the status of all buffers of a mode for TRACE_BUFFER_STATUS.  
+ * Each buffer has a nibble (the first buffer in the low nibble) that holds 
+ * the status in bits 0-1 and BIT3 when it is the recent buffer.
+ *
+ * \param Mode is the buffer select mode
+ */
+unsigned int GetBufferStatusTrace(unsigned char Mode);
+
+#endif /* DISPLAY_BUFFERS_H */
@@ -0,0 +1,71 @@
+/* Generated by Tools/FontTables from Tools/FontWidths.c; do not edit. */
+
+static const unsigned char MetaWatch5PackedWidths[47] =
+{
+  0x01, 0x42, 0x22, 0x04, 0x11, 0x44, 0x20, 0x40, 0x23, 0x33,
+  0x33, 0x33, 0x33, 0x10, 0x32, 0x22, 0x42, 0x33, 0x33, 0x33,
+  0x23, 0x33, 0x43, 0x34, 0x43, 0x33, 0x32, 0x44, 0x43, 0x13,
+  0x14, 0x34, 0x40, 0x33, 0x33, 0x33, 0x23, 0x33, 0x43, 0x34,
+  0x43, 0x33, 0x32, 0x44, 0x43, 0x23, 0x20,
+};
+
+static const unsigned char MetaWatch7PackedWidths[47] =
+{
+  0x01, 0x62, 0x64, 0x24, 0x22, 0x46, 0x30, 0x30, 0x13, 0x33,
+  0x34, 0x33, 0x33, 0x00, 0x32, 0x32, 0x66, 0x44, 0x34, 0x53,
+  0x24, 0x44, 0x63, 0x55, 0x63, 0x34, 0x44, 0x66, 0x64, 0x24,
+  0x23, 0x44, 0x60, 0x44, 0x34, 0x53, 0x24, 0x44, 0x63, 0x55,
+  0x63, 0x34, 0x44, 0x66, 0x64, 0x24, 0x20,
+};
+
+static const unsigned char MetaWatch16PackedWidths[47] =
+{
+  0x13, 0xB4, 0x95, 0x19, 0x33, 0x77, 0x71, 0x51, 0x26, 0x55,
+  0x56, 0x55, 0x55, 0x11, 0x67, 0x57, 0x8A, 0x66, 0x66, 0x65,
+  0x36, 0x65, 0xA5, 0x68, 0x76, 0x56, 0x65, 0xA6, 0x76, 0x36,
+  0x35, 0x86, 0x52, 0x55, 0x55, 0x53, 0x15, 0x54, 0x91, 0x55,
+  0x55, 0x44, 0x53, 0xA6, 0x56, 0x35, 0x31,
+};
+
+static const unsigned char MetaWatchTimePackedWidths[6] =
+{
+  0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3,
+};
+
+static const unsigned char MetaWatchSecondsPackedWidths[5] =
+{
+  0x66, 0x66, 0x66, 0x66, 0x66,
+};
+
+static const unsigned char StatusIconsPackedWidths[5] =
+{
+  0x24, 0x77, 0x47, 0x44, 0x14,
+};
+
+/*! The LCD fonts in etFontType order */
+static const tFontDescriptor FontDescriptors[] =
+{
+  /* MetaWatch5 */
+  { MetaWatch5table, 1, 5, 1, 0x20, PRINTABLE_CHARACTERS,
+    MetaWatch5PackedWidths },
+  
+  /* MetaWatch7 */
+  { MetaWatch7table, 1, 7, 1, 0x20, PRINTABLE_CHARACTERS,
+    MetaWatch7PackedWidths },
+  
+  /* MetaWatch16 */
+  { MetaWatch16table, 2, 16, 1, 0x20, PRINTABLE_CHARACTERS,
+    MetaWatch16PackedWidths },
+  
+  /* MetaWatchTime */
+  { MetaWatchTimeTable, 2, 16, 2, 0x00, TOTAL_TIME_CHARACTERS,
+    MetaWatchTimePackedWidths },
+  
+  /* MetaWatchSeconds */
+  { MetaWatchSecondsTable, 1, 7, 2, 0x00, TOTAL_SECONDS_CHARACTERS,
+    MetaWatchSecondsPackedWidths },
+  
+  /* StatusIcons */
+  { StatusIconsTable, 1, 5, 0, 0x00, TOTAL_STATUS_ICONS,
+    StatusIconsPackedWidths },
+};
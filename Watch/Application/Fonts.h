@@ -55,6 +55,9 @@ typedef enum
  */
 #define MAX_FONT_COLUMNS ( 30 )
 
+/*! The number of characters (0x20 to 0x7D) of the printable fonts */
+#define PRINTABLE_CHARACTERS       ( 94 )
+
 #define TOTAL_TIME_CHARACTERS      ( 12 )
 #define TOTAL_SECONDS_CHARACTERS   ( 10 )
 #define TIME_CHARACTER_COLON_INDEX ( 10 )
@@ -78,6 +81,10 @@ typedef enum
  *
  * \param CharIn is the input character
  * \return Index into the table
+ *
+ * \note A character outside of the current font maps to index 0.  That is
+ * a space in the printable fonts, the 0 of the clock fonts and the 
+ * bluetooth icon.
  */
 unsigned char MapCharacterToIndex(unsigned char CharIn);
 
@@ -116,6 +123,11 @@ unsigned char GetCharacterWidth(unsigned char Character);
  */
 void SetFont(etFontType Type);
 
+/*! 
+ * \return The font type used for Get operations
+ */
+etFontType GetFont(void);
+
 /*! Set the font spacing for the current font*
  *
  * \param Spacing is the number of columns between characters
@@ -0,0 +1,265 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file LcdBlit.c
+*
+* The data of a tLcdLine starts at an odd offset so a row can start on either
+* byte of a word.  A leading odd byte is handled on its own, the middle of 
+* the row a word at a time and a trailing byte on its own.  Copies between
+* rows of different alignment are done a byte at a time.  A word is an 
+* unsigned short so that it is 16 bits on the host as well.
+*/
+/******************************************************************************/
+
+#include "hal_lcd.h"
+#include "LcdDisplay.h"
+#include "LcdBlit.h"
+
+/* pData = (pData & Keep) ^ Value */
+static void SetBytes(unsigned char* pData,
+                     unsigned char Bytes,
+                     unsigned char Keep,
+                     unsigned char Value)
+{
+  if ( ((unsigned int)pData & 1) && Bytes )
+  {
+    *pData = (*pData & Keep) ^ Value;
+    pData++;
+    Bytes--;
+  }
+  
+  unsigned short* pWord = (unsigned short*)pData;
+  unsigned short WordKeep = ((unsigned short)Keep << 8) | Keep;
+  unsigned short WordValue = ((unsigned short)Value << 8) | Value;
+  
+  for ( ; Bytes > 1; Bytes -= 2 )
+  {
+    *pWord = (*pWord & WordKeep) ^ WordValue;
+    pWord++;
+  }
+  
+  if ( Bytes )
+  {
+    pData = (unsigned char*)pWord;
+    *pData = (*pData & Keep) ^ Value;
+  }
+}
+
+/* pDestination = (pDestination & Keep) | (pSource ^ Flip) */
+static void MergeBytes(unsigned char* pDestination,
+                       unsigned char const* pSource,
+                       unsigned char Bytes,
+                       unsigned char Keep,
+                       unsigned char Flip)
+{
+  if ( (((unsigned int)pDestination ^ (unsigned int)pSource) & 1) == 0 )
+  {
+    if ( ((unsigned int)pDestination & 1) && Bytes )
+    {
+      *pDestination = (*pDestination & Keep) | (*pSource++ ^ Flip);
+      pDestination++;
+      Bytes--;
+    }
+    
+    unsigned short* pWord = (unsigned short*)pDestination;
+    unsigned short const* pSourceWord = (unsigned short const*)pSource;
+    unsigned short WordKeep = ((unsigned short)Keep << 8) | Keep;
+    unsigned short WordFlip = ((unsigned short)Flip << 8) | Flip;
+    
+    for ( ; Bytes > 1; Bytes -= 2 )
+    {
+      *pWord = (*pWord & WordKeep) | (*pSourceWord++ ^ WordFlip);
+      pWord++;
+    }
+    
+    pDestination = (unsigned char*)pWord;
+    pSource = (unsigned char const*)pSourceWord;
+  }
+  
+  for ( ; Bytes; Bytes-- )
+  {
+    *pDestination = (*pDestination & Keep) | (*pSource++ ^ Flip);
+    pDestination++;
+  }
+}
+
+/* limit a rectangle to the display; returns 0 if nothing is left */
+static unsigned char ClipRectangle(unsigned char StartingRow,
+                                   unsigned char* pNumberOfRows,
+                                   unsigned char StartingColumn,
+                                   unsigned char* pNumberOfColumns)
+{
+  if ( StartingRow >= NUM_LCD_ROWS || StartingColumn >= NUM_LCD_COL_BYTES )
+  {
+    return 0;
+  }
+  
+  if ( *pNumberOfRows > NUM_LCD_ROWS - StartingRow )
+  {
+    *pNumberOfRows = NUM_LCD_ROWS - StartingRow;
+  }
+  
+  if ( *pNumberOfColumns > NUM_LCD_COL_BYTES - StartingColumn )
+  {
+    *pNumberOfColumns = NUM_LCD_COL_BYTES - StartingColumn;
+  }
+  
+  return ( *pNumberOfRows && *pNumberOfColumns );
+}
+
+static void SetRectangle(tLcdLine* pBuffer,
+                         unsigned char StartingRow,
+                         unsigned char NumberOfRows,
+                         unsigned char StartingColumn,
+                         unsigned char NumberOfColumns,
+                         unsigned char Keep,
+                         unsigned char Value)
+{
+  if ( ClipRectangle(StartingRow, &NumberOfRows, 
+                     StartingColumn, &NumberOfColumns) )
+  {
+    tLcdLine* pLine = &pBuffer[StartingRow];
+    
+    for ( ; NumberOfRows; NumberOfRows--, pLine++ )
+    {
+      SetBytes(&pLine->Data[StartingColumn], NumberOfColumns, Keep, Value);
+    }
+  }
+}
+
+static void MergeRectangle(tLcdLine* pBuffer,
+                           unsigned char const* pImage,
+                           unsigned char StartingRow,
+                           unsigned char NumberOfRows,
+                           unsigned char StartingColumn,
+                           unsigned char NumberOfColumns,
+                           unsigned char Keep)
+{
+  /* the image rows are the unclipped width */
+  unsigned char Stride = NumberOfColumns;
+  
+  if ( ClipRectangle(StartingRow, &NumberOfRows, 
+                     StartingColumn, &NumberOfColumns) )
+  {
+    tLcdLine* pLine = &pBuffer[StartingRow];
+    
+    for ( ; NumberOfRows; NumberOfRows--, pLine++, pImage += Stride )
+    {
+      MergeBytes(&pLine->Data[StartingColumn], 
+                 pImage, 
+                 NumberOfColumns, 
+                 Keep, 
+                 0x00);
+    }
+  }
+}
+
+void LcdBlitFill(tLcdLine* pBuffer,
+                 unsigned char StartingRow,
+                 unsigned char NumberOfRows,
+                 unsigned char StartingColumn,
+                 unsigned char NumberOfColumns,
+                 unsigned char Value)
+{
+  SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+               StartingColumn, NumberOfColumns, 0x00, Value);
+}
+
+void LcdBlitXor(tLcdLine* pBuffer,
+                unsigned char StartingRow,
+                unsigned char NumberOfRows,
+                unsigned char StartingColumn,
+                unsigned char NumberOfColumns,
+                unsigned char Value)
+{
+  SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+               StartingColumn, NumberOfColumns, 0xFF, Value);
+}
+
+void LcdBlitClearPixels(tLcdLine* pBuffer,
+                        unsigned char StartingRow,
+                        unsigned char NumberOfRows,
+                        unsigned char FirstPixel,
+                        unsigned char NumberOfPixels)
+{
+  unsigned int EndPixel = FirstPixel + NumberOfPixels;
+  unsigned char FirstColumn = FirstPixel >> 3;
+  unsigned char LastColumn = (EndPixel - 1) >> 3;
+  
+  /* bit 0 is the leftmost pixel; keep the pixels outside of the rectangle */
+  unsigned char FirstKeep = (1 << (FirstPixel & 0x07)) - 1;
+  unsigned char LastKeep = 
+    ( EndPixel & 0x07 ) ? ~((1 << (EndPixel & 0x07)) - 1) : 0x00;
+  
+  if ( NumberOfPixels == 0 )
+  {
+    return;
+  }
+  
+  if ( FirstColumn == LastColumn )
+  {
+    SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+                 FirstColumn, 1, FirstKeep | LastKeep, 0x00);
+  }
+  else
+  {
+    SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+                 FirstColumn, 1, FirstKeep, 0x00);
+    
+    SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+                 FirstColumn + 1, LastColumn - FirstColumn - 1, 0x00, 0x00);
+    
+    SetRectangle(pBuffer, StartingRow, NumberOfRows, 
+                 LastColumn, 1, LastKeep, 0x00);
+  }
+}
+
+void LcdBlitCopy(tLcdLine* pBuffer,
+                 unsigned char const* pImage,
+                 unsigned char StartingRow,
+                 unsigned char NumberOfRows,
+                 unsigned char StartingColumn,
+                 unsigned char NumberOfColumns)
+{
+  MergeRectangle(pBuffer, pImage, StartingRow, NumberOfRows, 
+                 StartingColumn, NumberOfColumns, 0x00);
+}
+
+void LcdBlitOr(tLcdLine* pBuffer,
+               unsigned char const* pImage,
+               unsigned char StartingRow,
+               unsigned char NumberOfRows,
+               unsigned char StartingColumn,
+               unsigned char NumberOfColumns)
+{
+  MergeRectangle(pBuffer, pImage, StartingRow, NumberOfRows, 
+                 StartingColumn, NumberOfColumns, 0xFF);
+}
+
+void CopyLcdBytes(unsigned char* pDestination,
+                  unsigned char const* pSource,
+                  unsigned char Bytes,
+                  unsigned char Invert)
+{
+  MergeBytes(pDestination, pSource, Bytes, 0x00, Invert ? 0xFF : 0x00);
+}
+
+void InvertLcdBytes(unsigned char* pData, unsigned char Bytes)
+{
+  SetBytes(pData, Bytes, 0xFF, 0xFF);
+}
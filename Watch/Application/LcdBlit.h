@@ -0,0 +1,127 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file LcdBlit.h
+ *
+ * Operations on rectangles of a display buffer made of tLcdLine.  Columns 
+ * are in bytes (8 pixels).  The rows of the data are processed a word at a 
+ * time where the alignment allows it.  This is for the LCD only.
+ */
+/******************************************************************************/
+
+#ifndef LCD_BLIT_H
+#define LCD_BLIT_H
+
+/*! Set a rectangle of a display buffer to a value
+ *
+ * \param pBuffer is the display buffer (NUM_LCD_ROWS lines)
+ * \param StartingRow is the first row of the rectangle
+ * \param NumberOfRows is the height of the rectangle
+ * \param StartingColumn is the first column byte of the rectangle
+ * \param NumberOfColumns is the width of the rectangle in bytes
+ * \param Value is written to every byte of the rectangle
+ *
+ * \note The rectangle is clipped to the display
+ */
+void LcdBlitFill(tLcdLine* pBuffer,
+                 unsigned char StartingRow,
+                 unsigned char NumberOfRows,
+                 unsigned char StartingColumn,
+                 unsigned char NumberOfColumns,
+                 unsigned char Value);
+
+/*! Exclusive-or a rectangle of a display buffer with a value
+ *
+ * \param Value is xor'ed with every byte of the rectangle; 0xFF inverts it
+ *
+ * \note The other parameters are the same as LcdBlitFill
+ */
+void LcdBlitXor(tLcdLine* pBuffer,
+                unsigned char StartingRow,
+                unsigned char NumberOfRows,
+                unsigned char StartingColumn,
+                unsigned char NumberOfColumns,
+                unsigned char Value);
+
+/*! Clear the pixels in a rectangle of a display buffer.  Unlike the other 
+ * operations the rectangle does not have to start or end on a byte.
+ *
+ * \param pBuffer is the display buffer (NUM_LCD_ROWS lines)
+ * \param StartingRow is the first row of the rectangle
+ * \param NumberOfRows is the height of the rectangle
+ * \param FirstPixel is the leftmost pixel of the rectangle (0 to 95)
+ * \param NumberOfPixels is the width of the rectangle in pixels
+ *
+ * \note The rectangle is clipped to the display
+ */
+void LcdBlitClearPixels(tLcdLine* pBuffer,
+                        unsigned char StartingRow,
+                        unsigned char NumberOfRows,
+                        unsigned char FirstPixel,
+                        unsigned char NumberOfPixels);
+
+/*! Copy an image into a rectangle of a display buffer
+ *
+ * \param pBuffer is the display buffer (NUM_LCD_ROWS lines)
+ * \param pImage is the image; each row is NumberOfColumns bytes
+ * \param StartingRow is the first row of the rectangle
+ * \param NumberOfRows is the height of the rectangle
+ * \param StartingColumn is the first column byte of the rectangle
+ * \param NumberOfColumns is the width of the rectangle in bytes
+ *
+ * \note The rectangle is clipped to the display
+ */
+void LcdBlitCopy(tLcdLine* pBuffer,
+                 unsigned char const* pImage,
+                 unsigned char StartingRow,
+                 unsigned char NumberOfRows,
+                 unsigned char StartingColumn,
+                 unsigned char NumberOfColumns);
+
+/*! Or an image into a rectangle of a display buffer.  Only the pixels that 
+ * are set in the image are changed.
+ *
+ * \note The parameters are the same as LcdBlitCopy
+ */
+void LcdBlitOr(tLcdLine* pBuffer,
+               unsigned char const* pImage,
+               unsigned char StartingRow,
+               unsigned char NumberOfRows,
+               unsigned char StartingColumn,
+               unsigned char NumberOfColumns);
+
+/*! Copy bytes of line data and optionally invert them
+ *
+ * \param pDestination
+ * \param pSource
+ * \param Bytes is the number of bytes to copy
+ * \param Invert is non-zero if the bytes should be inverted
+ */
+void CopyLcdBytes(unsigned char* pDestination,
+                  unsigned char const* pSource,
+                  unsigned char Bytes,
+                  unsigned char Invert);
+
+/*! Invert bytes of line data in place
+ *
+ * \param pData
+ * \param Bytes is the number of bytes to invert
+ */
+void InvertLcdBytes(unsigned char* pData, unsigned char Bytes);
+
+#endif /* LCD_BLIT_H */
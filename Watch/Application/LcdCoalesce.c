@@ -0,0 +1,147 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdCoalesce.c
+*
+* Merges the redraw messages that wait in the display queue so that the
+* display task draws the screen once for a run of them.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "Messages.h"
+#include "MessageQueues.h"
+#include "Statistics.h"
+#include "LcdCoalesce.h"
+
+/* set by the rtc isr when its IdleUpdate is in the display queue */
+static unsigned char RtcIdleUpdatePending = 0;
+
+unsigned char QueryRtcIdleUpdatePending(void)
+{
+  return RtcIdleUpdatePending;
+}
+
+void SetRtcIdleUpdatePending(unsigned char Pending)
+{
+  RtcIdleUpdatePending = Pending;
+}
+
+/* \return 1 if the payloads of two messages are the same */
+static unsigned char SamePayload(tMessage* pMsg1, tMessage* pMsg2)
+{
+  unsigned char* pPayload1 = GetMessagePayload(pMsg1);
+  unsigned char* pPayload2 = GetMessagePayload(pMsg2);
+  unsigned char i;
+  
+  if ( pMsg1->Length != pMsg2->Length )
+  {
+    return 0;
+  }
+  
+  for ( i = 0; i < pMsg1->Length; i++ )
+  {
+    if ( pPayload1[i] != pPayload2[i] )
+    {
+      return 0;
+    }
+  }
+  
+  return 1;
+}
+
+unsigned char MergeDisplayMessage(tMessage* pMsg, tMessage* pNextMsg)
+{
+  if ( pMsg->Type != pNextMsg->Type )
+  {
+    return 0;
+  }
+  
+  switch (pMsg->Type)
+  {
+  case IdleUpdate:
+    if (   pMsg->Options > RTC_DATE_TIME_ONLY
+        || pNextMsg->Options > RTC_DATE_TIME_ONLY )
+    {
+      return 0;
+    }
+    
+    if ( pNextMsg->Options == IDLE_FULL_UPDATE )
+    {
+      pMsg->Options = IDLE_FULL_UPDATE;
+    }
+    
+    gAppStats.CoalescedIdleUpdates++;
+    return 1;
+    
+  case UpdateDisplay:
+    /* the options of both messages are used; a copy of the active buffer
+     * is only done when both messages ask for it (or both do not)
+     */
+    if (   (pMsg->Options & MODE_MASK) != (pNextMsg->Options & MODE_MASK)
+        || (   (pMsg->Options & UPDATE_COPY_MASK) 
+            != (pNextMsg->Options & UPDATE_COPY_MASK) ) )
+    {
+      return 0;
+    }
+    
+    if ( !SamePayload(pMsg, pNextMsg) )
+    {
+      pMsg->Length = 0;
+    }
+    
+    pMsg->Options |= pNextMsg->Options;
+    gAppStats.CoalescedUpdateDisplays++;
+    return 1;
+    
+  default:
+    return 0;
+  }
+}
+
+/* The rtc isr does not send another IdleUpdate while its last one is in the
+ * queue.  Once that message is taken out it is a normal date and time update.
+ */
+static void RemovedIdleUpdate(tMessage* pMsg)
+{
+  if ( pMsg->Type == IdleUpdate && pMsg->Options == RTC_DATE_TIME_ONLY )
+  {
+    pMsg->Options = DATE_TIME_ONLY;
+    RtcIdleUpdatePending = 0;
+  }
+}
+
+void CoalesceDisplayMessages(tMessage* pMsg, unsigned char Lane)
+{
+  tMessage NextMsg;
+  
+  RemovedIdleUpdate(pMsg);
+  
+  /* only this task removes messages so the peeked message is the one that
+   * is received (equivalent messages are always in the same lane)
+   */
+  while (   PeekDisplayMessage(Lane, &NextMsg)
+         && MergeDisplayMessage(pMsg, &NextMsg) )
+  {
+    RemoveDisplayMessage(Lane, &NextMsg);
+    RemovedIdleUpdate(&NextMsg);
+    FreeQueuedMessage(&NextMsg);
+  }
+  
+}
@@ -0,0 +1,75 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdCoalesce.h
+ *
+ * Merge redraw messages that wait in the display queue.  The display task 
+ * can fall behind the rtc and the phone (while a screen is being written).
+ * A redraw message that is directly followed by an equivalent one is merged
+ * so that the screen is only drawn once.  This is for the LCD only.
+ */
+/******************************************************************************/
+
+#ifndef LCD_COALESCE_H
+#define LCD_COALESCE_H
+
+#ifndef MESSAGES_H
+  #error "Messages.h must be included before LcdCoalesce.h"
+#endif
+
+/*! IdleUpdate options */
+#define IDLE_FULL_UPDATE   (0)
+#define DATE_TIME_ONLY     (1)
+/*! the date and time update sent by the rtc isr (see 
+ * QueryRtcIdleUpdatePending) 
+ */
+#define RTC_DATE_TIME_ONLY (2)
+
+/*! Merge pNextMsg into pMsg if both cause the same redraw.
+ * 
+ * A full idle update includes the date and time.  Two updates of the same
+ * mode become one update with both sets of options.  If they are for 
+ * different rows then the whole screen is updated.
+ *
+ * \param pMsg is the message that is handled
+ * \param pNextMsg is the message after it (it is not changed)
+ *
+ * \return 1 if the messages were merged
+ */
+unsigned char MergeDisplayMessage(tMessage* pMsg, tMessage* pNextMsg);
+
+/*! Take the messages that directly follow pMsg in its lane out of the queue
+ * as long as they can be merged into it.  This is called by the display 
+ * task (the only task that removes display messages).
+ *
+ * \param pMsg is the message that was received
+ * \param Lane is the lane it was received from
+ */
+void CoalesceDisplayMessages(tMessage* pMsg, unsigned char Lane);
+
+/*! \return 1 while the IdleUpdate sent by the rtc isr is in the display 
+ * queue.  The rtc isr does not send another one until it is taken out.
+ */
+unsigned char QueryRtcIdleUpdatePending(void);
+
+/*! Called by the rtc isr after it sent an IdleUpdate
+ *
+ * \param Pending is 1 if the message was put into the queue
+ */
+void SetRtcIdleUpdatePending(unsigned char Pending);
+
+#endif /* LCD_COALESCE_H */
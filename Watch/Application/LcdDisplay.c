@@ -36,6 +36,10 @@
 #include "Messages.h"
 #include "Utilities.h"
 #include "LcdDriver.h"
+#include "LcdBlit.h"
+#include "LcdText.h"
+#include "LcdIdle.h"
+#include "LcdCoalesce.h"
 #include "Wrapper.h"
 #include "MessageQueues.h"
 #include "SerialRam.h"
@@ -53,12 +57,13 @@
 #include "LcdDisplay.h"
 
 #define DISPLAY_TASK_QUEUE_LENGTH 8
+#define DISPLAY_TASK_HIGH_QUEUE_LENGTH 4
+
+/* the most messages that are handled before the stack and queue checks */
+#define DISPLAY_TASK_BATCH_LENGTH ( 8 )
 #define DISPLAY_TASK_STACK_SIZE  	(configMINIMAL_STACK_SIZE + 90)
 #define DISPLAY_TASK_PRIORITY     (tskIDLE_PRIORITY + 1)
 
-#define IDLE_FULL_UPDATE   (0)
-#define DATE_TIME_ONLY     (1)
-
 #define BAR_CODE_START_ROW (27)
 #define BAR_CODE_ROWS      (42)
 #define SPLASH_START_ROW   (29)
@@ -134,21 +139,15 @@ static void CopyColumnsIntoMyBuffer(unsigned char const* pImage,
                                     unsigned char StartingColumn,
                                     unsigned char NumberOfColumns);
 
-static void WriteIcon4w10h(unsigned char const * pIcon,
-                           unsigned char RowOffset,
-                           unsigned char ColumnOffset);
-
-static void DisplayAmPm(void);
-//static void DisplayDayOfWeek(void);
-static void DisplayDate(void);
-
 /* the internal buffer */
 #define STARTING_ROW                  ( 0 )
-#define WATCH_DRAWN_IDLE_BUFFER_ROWS  ( 30 )
 #define PHONE_IDLE_BUFFER_ROWS        ( 66 )
 
 static tLcdLine pMyBuffer[NUM_LCD_ROWS];
 
+/* Drawn is cleared when another screen is drawn in pMyBuffer */
+static tLcdIdleFields IdleFields;
+
 /******************************************************************************/
 
 static unsigned char nvIdleBufferConfig;
@@ -209,17 +208,12 @@ static void DefaultApplicationAndNotificationButtonConfiguration(void);
 
 const unsigned char pBarCodeImage[BAR_CODE_ROWS * NUM_LCD_COL_BYTES];
 const unsigned char pMetaWatchSplash[SPLASH_ROWS * NUM_LCD_COL_BYTES];
-const unsigned char Am[10*4];
-const unsigned char Pm[10*4];
 //const unsigned char DaysOfWeek[7][10*4];
 
 /******************************************************************************/
 
-static unsigned char gBitColumnMask;
-static unsigned char gColumn;
-static unsigned char gRow;
+static tLcdTextPosition gText;
 
-static void AdvanceBitColumnMask(unsigned int pixels);
 static void WriteFontCharacter(unsigned char Character);
 static void WriteFontString(tString* pString);
 
@@ -236,8 +230,7 @@ void InitializeDisplayTask(void)
 {
   InitMyBuffer();
 
-  QueueHandles[DISPLAY_QINDEX] =
-    xQueueCreate( DISPLAY_TASK_QUEUE_LENGTH, MESSAGE_QUEUE_ITEM_SIZE  );
+  CreateDisplayQueue(DISPLAY_TASK_QUEUE_LENGTH, DISPLAY_TASK_HIGH_QUEUE_LENGTH);
 
   // task function, task name, stack len , task params, priority, task handle
   xTaskCreate(DisplayTask,
@@ -289,15 +282,30 @@ static void DisplayTask(void *pvParameters)
 
   for(;;)
   {
-    if( pdTRUE == xQueueReceive(QueueHandles[DISPLAY_QINDEX],
-                                &DisplayMsg, portMAX_DELAY) )
+    unsigned char Lane = ReceiveDisplayMessage(&DisplayMsg, portMAX_DELAY);
+    unsigned char Count = 0;
+    
+    /* once awake handle whatever else is already waiting */
+    while ( Lane != DISPLAY_NO_MESSAGE )
     {
       PrintMessageType(&DisplayMsg);
+      CoalesceDisplayMessages(&DisplayMsg, Lane);
       DisplayQueueMessageHandler(&DisplayMsg);
-      SendToFreeQueue(&DisplayMsg);
-      CheckStackUsage(DisplayHandle, "Display");
-      CheckQueueUsage(QueueHandles[DISPLAY_QINDEX]);
+      FreeQueuedMessage(&DisplayMsg);
+      
+      if ( ++Count < DISPLAY_TASK_BATCH_LENGTH )
+      {
+        Lane = ReceiveDisplayMessage(&DisplayMsg, DONT_WAIT);
+      }
+      else
+      {
+        Lane = DISPLAY_NO_MESSAGE;
+      }
     }
+    
+    SendFlowControlCredits();
+    CheckStackUsage(DisplayHandle, "Display");
+    CheckQueueUsage(QueueHandles[DISPLAY_QINDEX]);
   }
 }
 
@@ -319,10 +327,18 @@ static void DisplayQueueMessageHandler(tMessage* pMsg)
     WriteBufferHandler(pMsg);
     break;
 
+  case WriteBufferPacked:
+    WriteBufferPackedHandler(pMsg);
+    break;
+
   case LoadTemplate:
     LoadTemplateHandler(pMsg);
     break;
 
+  case CachedPageMsg:
+    CachedPageHandler(pMsg);
+    break;
+
   case UpdateDisplay:
     UpdateDisplayHandler(pMsg);
     break;
@@ -469,7 +485,7 @@ static void IdleUpdateHandler(unsigned char Options)
   {
     tMessage Message;
     SetupMessage(&Message, UpdateDisplay, IDLE_MODE | FORCE_UPDATE);
-    RouteMsg(&Message);
+    RouteWatchMsg(&Message);
   }
   else
   {
@@ -510,8 +526,8 @@ static void ChangeModeHandler(unsigned char Mode, unsigned char Options)
    * has completed.
    */
   tMessage Message;
-  SetupMessageAndAllocateBuffer(&Message, StatusChangeEvent, Mode);
-  Message.pBuffer[0] = eScUpdateComplete;
+  SetupMessageWithInlinePayload(&Message, StatusChangeEvent, Mode);
+  Message.InlinePayload[0] = eScUpdateComplete;
   Message.Length = 1;
   RouteMsg(&Message);
 }
@@ -520,8 +536,8 @@ static void ModeTimeoutHandler()
 {
   /* send a message to the host indicating that a timeout occurred */
   tMessage Message;
-  SetupMessageAndAllocateBuffer(&Message, StatusChangeEvent, CurrentMode);
-  Message.pBuffer[0] = eScModeTimeout;
+  SetupMessageWithInlinePayload(&Message, StatusChangeEvent, CurrentMode);
+  Message.InlinePayload[0] = eScModeTimeout;
   Message.Length = 1;
   RouteMsg(&Message);
   
@@ -859,16 +875,16 @@ static void DrawConnectionScreen()
   CopyRowsIntoMyBuffer(pSwash, WATCH_DRAWN_IDLE_BUFFER_ROWS + 1, 32);
 
   /* local bluetooth address */
-  gRow = 65;
-  gColumn = 0;
-  gBitColumnMask = BIT4;
+  gText.Row = 65;
+  gText.Column = 0;
+  gText.BitColumnMask = BIT4;
   SetFont(MetaWatch7);
   WriteFontString(GetLocalBluetoothAddressString());
 
   /* add the firmware version */
-  gRow = 75;
-  gColumn = 0;
-  gBitColumnMask = BIT4;
+  gText.Row = 75;
+  gText.Column = 0;
+  gText.BitColumnMask = BIT4;
   DrawVersionInfo(10);
   SendMyBufferToLcd(WATCH_DRAWN_IDLE_BUFFER_ROWS, PHONE_IDLE_BUFFER_ROWS);
 }
@@ -1082,9 +1098,9 @@ static void WatchStatusScreenHandler(void)
   /* display battery voltage */
   unsigned char msd = 0;
 
-  gRow = 27+2;
-  gColumn = 8;
-  gBitColumnMask = BIT6;
+  gText.Row = 27+2;
+  gText.Column = 8;
+  gText.BitColumnMask = BIT6;
   SetFont(MetaWatch7);
 
 
@@ -1105,23 +1121,23 @@ static void WatchStatusScreenHandler(void)
   /*
    * Add Wavy line
    */
-  gRow += 12;
-  CopyRowsIntoMyBuffer(pWavyLine,gRow,NUMBER_OF_ROWS_IN_WAVY_LINE);
+  gText.Row += 12;
+  CopyRowsIntoMyBuffer(pWavyLine,gText.Row,NUMBER_OF_ROWS_IN_WAVY_LINE);
 
   /*
    * Add details
    */
 
   /* add MAC address */
-  gRow += NUMBER_OF_ROWS_IN_WAVY_LINE+2;
-  gColumn = 0;
-  gBitColumnMask = BIT4;
+  gText.Row += NUMBER_OF_ROWS_IN_WAVY_LINE+2;
+  gText.Column = 0;
+  gText.BitColumnMask = BIT4;
   WriteFontString(GetLocalBluetoothAddressString());
 
   /* add the firmware version */
-  gRow += 12;
-  gColumn = 0;
-  gBitColumnMask = BIT4;
+  gText.Row += 12;
+  gText.Column = 0;
+  gText.BitColumnMask = BIT4;
   DrawVersionInfo(12);
 
   /* display entire buffer */
@@ -1151,9 +1167,9 @@ static void DrawVersionInfo(unsigned char RowHeight)
   WriteFontCharacter(GetMsp430HardwareRevision());
 
   /* stack version */
-  gRow += RowHeight;
-  gColumn = 0;
-  gBitColumnMask = BIT4;
+  gText.Row += RowHeight;
+  gText.Column = 0;
+  gText.BitColumnMask = BIT4;
   tVersion Version = GetWrapperVersion();
   WriteFontString("Stk ");
   WriteFontString(Version.pSwVer);
@@ -1189,8 +1205,8 @@ static void ListPairedDevicesHandler(void)
   tString BluetoothAddress[12+1];
   tString BluetoothName[12+1];
 
-  gRow = 4;
-  gColumn = 0;
+  gText.Row = 4;
+  gText.Column = 0;
   SetFont(MetaWatch7);
 
   unsigned char i;
@@ -1198,15 +1214,15 @@ static void ListPairedDevicesHandler(void)
   {
     QueryLinkKeys(i, BluetoothAddress, BluetoothName, 12);
 
-    gColumn = 0;
-    gBitColumnMask = BIT4;
+    gText.Column = 0;
+    gText.BitColumnMask = BIT4;
     WriteFontString(BluetoothName);
-    gRow += 12;
+    gText.Row += 12;
 
-    gColumn = 0;
-    gBitColumnMask = BIT4;
+    gText.Column = 0;
+    gText.BitColumnMask = BIT4;
     WriteFontString(BluetoothAddress);
-    gRow += 12+5;
+    gText.Row += 12+5;
   }
 
   SendMyBufferToLcd(STARTING_ROW, NUM_LCD_ROWS);
@@ -1246,7 +1262,7 @@ static void ConfigureDisplayHandler(tMessage* pMsg)
 
 static void ConfigureIdleBufferSizeHandler(tMessage* pMsg)
 {
-  nvIdleBufferConfig = pMsg->pBuffer[0] & IDLE_BUFFER_CONFIG_MASK;
+  nvIdleBufferConfig = GetMessagePayload(pMsg)[0] & IDLE_BUFFER_CONFIG_MASK;
   //if ( nvIdleBufferConfig == WATCH_CONTROLS_TOP ) IdleUpdateHandler();
 }
 
@@ -1286,19 +1302,15 @@ unsigned char GetIdleBufferConfiguration(void)
 static void InitMyBuffer(void)
 {
   int row;
-  int col;
 
-  // Clear the display buffer.  Step through the rows
   for(row = STARTING_ROW; row < NUM_LCD_ROWS; row++)
   {
-    // clear a horizontal line
-    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
-    {
-      pMyBuffer[row].Row = row+FIRST_LCD_LINE_OFFSET;
-      pMyBuffer[row].Data[col] = 0x00;
-      pMyBuffer[row].Dummy = 0x00;
-    }
+    pMyBuffer[row].Row = row+FIRST_LCD_LINE_OFFSET;
+    pMyBuffer[row].Dummy = 0x00;
   }
+  
+  // Clear the display buffer
+  FillMyBuffer(STARTING_ROW, NUM_LCD_ROWS, 0x00);
 }
 
 
@@ -1306,39 +1318,32 @@ static void FillMyBuffer(unsigned char StartingRow,
                          unsigned char NumberOfRows,
                          unsigned char FillValue)
 {
-  int row = StartingRow;
-  int col;
-
-  // Clear the display buffer.  Step through the rows
-  for( ; row < NUM_LCD_ROWS && row < StartingRow+NumberOfRows; row++ )
-  {
-    // clear a horizontal line
-    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
-    {
-      pMyBuffer[row].Data[col] = FillValue;
-    }
-  }
+  LcdBlitFill(pMyBuffer, 
+              StartingRow, 
+              NumberOfRows, 
+              0, 
+              NUM_LCD_COL_BYTES, 
+              FillValue);
 }
 
 static void SendMyBufferToLcd(unsigned char StartingRow, unsigned char NumberOfRows)
 {
-  int row = StartingRow;
-  int col;
-
   /*
    * flip the bits before sending to LCD task because it will
    * dma this portion of the screen
   */
   if ( QueryInvertDisplay() == NORMAL_DISPLAY )
   {
-    for( ; row < NUM_LCD_ROWS && row < StartingRow+NumberOfRows; row++)
-    {
-      for(col = 0; col < NUM_LCD_COL_BYTES; col++)
-      {
-        pMyBuffer[row].Data[col] = ~(pMyBuffer[row].Data[col]);
-      }
-    }
+    LcdBlitXor(pMyBuffer, 
+               StartingRow, 
+               NumberOfRows, 
+               0, 
+               NUM_LCD_COL_BYTES, 
+               0xFF);
   }
+  
+  IdleFields.Drawn = 0;
+  
   tLcdLine *pStartLcdLine = &pMyBuffer[StartingRow];
   UpdateMyDisplay((unsigned char*)pStartLcdLine, NumberOfRows);
 }
@@ -1347,20 +1352,12 @@ static void CopyRowsIntoMyBuffer(unsigned char const* pImage,
                                  unsigned char StartingRow,
                                  unsigned char NumberOfRows)
 {
-
-  unsigned char DestRow = StartingRow;
-  unsigned char SourceRow = 0;
-  unsigned char col = 0;
-
-  while ( DestRow < NUM_LCD_ROWS && SourceRow < NumberOfRows )
-  {
-    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
-    {
-      pMyBuffer[DestRow].Data[col] = pImage[SourceRow*NUM_LCD_COL_BYTES+col];
-    }
-    DestRow ++;
-    SourceRow ++;
-  }
+  LcdBlitCopy(pMyBuffer,
+              pImage,
+              StartingRow,
+              NumberOfRows,
+              0,
+              NUM_LCD_COL_BYTES);
 }
 
 static void CopyColumnsIntoMyBuffer(unsigned char const* pImage,
@@ -1369,285 +1366,88 @@ static void CopyColumnsIntoMyBuffer(unsigned char const* pImage,
                                     unsigned char StartingColumn,
                                     unsigned char NumberOfColumns)
 {
-  unsigned char DestRow = StartingRow;
-  unsigned char RowCounter = 0;
-  unsigned char DestColumn = StartingColumn;
-  unsigned char ColumnCounter = 0;
-  unsigned int SourceIndex = 0;
-
-  /* copy rows into display buffer */
-  while ( DestRow < NUM_LCD_ROWS && RowCounter < NumberOfRows )
-  {
-    DestColumn = StartingColumn;
-    ColumnCounter = 0;
-    while ( DestColumn < NUM_LCD_COL_BYTES && ColumnCounter < NumberOfColumns )
-    {
-      pMyBuffer[DestRow].Data[DestColumn] = pImage[SourceIndex];
-
-      DestColumn ++;
-      ColumnCounter ++;
-      SourceIndex ++;
-    }
-
-    DestRow ++;
-    RowCounter ++;
-  }
-}
-
-static void DrawStatusIconCross(unsigned char bool)
-{
-	if ( !bool )
-	{
-		WriteFontCharacter(STATUS_ICON_CROSS);
-	}
+  LcdBlitCopy(pMyBuffer,
+              pImage,
+              StartingRow,
+              NumberOfRows,
+              StartingColumn,
+              NumberOfColumns);
 }
 
-static void DrawDateTime(unsigned char OnceConnected)
+static unsigned char GetBatteryIcon(void)
 {
-  unsigned char msd;
-  unsigned char lsd;
-
-  /* display hour */
-  int Hour = RTCHOUR;
-
-  /* if required convert to twelve hour format */
-  if ( GetTimeFormat() == TWELVE_HOUR )
-  {
-    Hour %= 12;
-    if (Hour == 0) Hour = 12;
-  }
-  
-  msd = Hour / 10;
-  lsd = Hour % 10;
-
-  // clean date&time area
-  FillMyBuffer(STARTING_ROW, WATCH_DRAWN_IDLE_BUFFER_ROWS, 0x00);
-
-  if ( DisplayDisconnectWarning && (!QueryPhoneConnected()) )
-  {
-    CopyColumnsIntoMyBuffer(pPhoneDisconnectedIdlePageIcon,
-                            10,
-                            IDLE_PAGE_ICON_SIZE_IN_ROWS,
-                            1,
-                            IDLE_PAGE_ICON_SIZE_IN_COLS);
-
-
-    SetFont(MetaWatch16);
-
-    gColumn = 3;
-    gBitColumnMask = BIT4;
-    gRow = 11;
-    WriteFontString("Link Lost");
-
-  }
-  else
-  {
-
-    gRow = 10;
-    if ( nvDisplaySeconds )
-    {
-      gColumn = 0;
-      gBitColumnMask = BIT6;
-    }
-    else
-    {
-      gColumn = 1;
-      gBitColumnMask = BIT2;
-    }
-    SetFont(MetaWatchTime);
-
-    /* if first digit is zero then leave location blank */
-    if ( msd == 0 && GetTimeFormat() == TWELVE_HOUR )
-    {
-      WriteFontCharacter(TIME_CHARACTER_SPACE_INDEX);
-    }
-    else
-    {
-      WriteFontCharacter(msd);
-    }
-
-    WriteFontCharacter(lsd);
-
-    WriteFontCharacter(TIME_CHARACTER_COLON_INDEX);
-
-    /* display minutes */
-    int Minutes = RTCMIN;
-    msd = Minutes / 10;
-    lsd = Minutes % 10;
-    WriteFontCharacter(msd);
-    WriteFontCharacter(lsd);
-
-    if ( nvDisplaySeconds )
-    {
-      int Seconds = RTCSEC;
-      msd = Seconds / 10;
-      lsd = Seconds % 10;
-
-      SetFont(MetaWatchSeconds);
-
-      int mask = gBitColumnMask;
-      gRow = 10;
-      gColumn = 10;
-      WriteFontCharacter(msd);
-      gRow = 19;
-      gColumn = 10;
-      gBitColumnMask = mask;
-      WriteFontCharacter(lsd);
-
-    }
-
-    if ( GetTimeFormat() == TWELVE_HOUR ) DisplayAmPm();
-
-  }
-
-  SetFont(StatusIcons);
-  gRow = 2;
+  unsigned int bV = ReadBatterySenseAverage();
+  unsigned char Icon = STATUS_ICON_BATTERY_HALF;
 
-  if ( OnceConnected )
+  if ( bV < 3500 )
   {
-    char bluetooth = QueryBluetoothOn();
-    char connected = QueryPhoneConnected();
-
-    if ( (!bluetooth) || (bluetooth&&connected) ) {
-      gColumn = 8;
-      gBitColumnMask = BIT5;
-    }
-    else
-    {
-      gColumn = 8;
-      gBitColumnMask = BIT1;
-    }
-
-    DrawStatusIconCross( bluetooth );
-    WriteFontCharacter(STATUS_ICON_BLUETOOTH);
-
-    if (bluetooth) {
-      AdvanceBitColumnMask(1);
-      DrawStatusIconCross( connected );
-      WriteFontCharacter(STATUS_ICON_PHONE);
-    }
+    Icon = STATUS_ICON_BATTERY_EMPTY;
   }
-
-	gColumn = 10;
-	gBitColumnMask = BIT0;
-	if ( QueryBatteryCharging() )
-	{
-		WriteFontCharacter(STATUS_ICON_SPARK);
-	}
-
-	unsigned int bV = ReadBatterySenseAverage();
-
-	gColumn = 10;
-	gBitColumnMask = BIT6;
-
-	if ( bV < 3500 )
-	{
-	  WriteFontCharacter(STATUS_ICON_BATTERY_EMPTY);
-	}
-	else if ( bV > 4000 )
-	{
-		WriteFontCharacter(STATUS_ICON_BATTERY_FULL);
-	}
-	else
-	{
-		WriteFontCharacter(STATUS_ICON_BATTERY_HALF);
-	}
-
-  DisplayDate();
-
-  // Invert the clock (because it looks good!)
-  int row=0;
-  int col=0;
-  for( ; row < NUM_LCD_ROWS && row < WATCH_DRAWN_IDLE_BUFFER_ROWS; row++)
+  else if ( bV > 4000 )
   {
-    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
-    {
-      pMyBuffer[row].Data[col] = ~(pMyBuffer[row].Data[col]);
-    }
+    Icon = STATUS_ICON_BATTERY_FULL;
   }
-
-  SendMyBufferToLcd(STARTING_ROW, WATCH_DRAWN_IDLE_BUFFER_ROWS);
-}
-
-static void DisplayAmPm(void)
-{
-  int Hour = RTCHOUR;
-  unsigned char const *pIcon = ( Hour >= 12 ) ? Pm : Am;
-  WriteIcon4w10h(pIcon,16,0);
+  
+  return Icon;
 }
 
-static void DisplayDate(void)
+static void DrawDateTime(unsigned char OnceConnected)
 {
-  gBitColumnMask = BIT2;
-  gRow = 2;
-  gColumn = 0;
-  SetFont(MetaWatch5);
-  WriteFontString((tString *)DaysOfTheWeek[GetLanguage()][RTCDOW]);
-
-  if ( OnceConnected() )
-  {
-	WriteFontCharacter(' ');
-
-  int First;
-  int Second;
-
-  /* determine if month or day is displayed first */
-  if ( GetDateFormat() == MONTH_FIRST )
+  tLcdIdleState State;
+  unsigned char FirstRow;
+  
+  State.Hour = RTCHOUR;
+  State.Minutes = RTCMIN;
+  State.Seconds = RTCSEC;
+  State.Year = RTCYEAR;
+  State.Month = RTCMON;
+  State.Day = RTCDAY;
+  State.DayOfWeek = RTCDOW;
+  State.Language = GetLanguage();
+  State.pDayOfWeek = DaysOfTheWeek[State.Language][State.DayOfWeek];
+  State.Battery = GetBatteryIcon();
+  State.Charging = QueryBatteryCharging();
+  State.BluetoothOn = QueryBluetoothOn();
+  State.PhoneConnected = QueryPhoneConnected();
+  State.OnceConnected = OnceConnected;
+  State.LinkLost = DisplayDisconnectWarning && (!State.PhoneConnected);
+  State.DisplaySeconds = nvDisplaySeconds;
+  State.TimeFormat = GetTimeFormat();
+  State.DateFormat = GetDateFormat();
+  State.Invert = ( QueryInvertDisplay() != NORMAL_DISPLAY );
+  
+  /* the LCD rows may have been written by another screen or a phone */
+  if ( QueryLcdRowsWritten(STARTING_ROW, WATCH_DRAWN_IDLE_BUFFER_ROWS) )
   {
-    First = RTCMON;
-    Second = RTCDAY;
+    IdleFields.Drawn = 0;
   }
-  else
+  
+  unsigned char Rows = DrawLcdIdle(pMyBuffer, &IdleFields, &State, &FirstRow);
+  
+  if ( Rows == 0 )
   {
-    First = RTCDAY;
-    Second = RTCMON;
+    return;
   }
-
-  WriteFontCharacter(First/10+'0');
-  WriteFontCharacter(First%10+'0');
-  WriteFontCharacter('.');
-  WriteFontCharacter(Second/10+'0');
-  WriteFontCharacter(Second%10+'0');
-
-  WriteFontCharacter('.');
-
-  int year = RTCYEAR;
-  WriteFontCharacter(year/1000+'0');
-  year %= 1000;
-  WriteFontCharacter(year/100+'0');
-  year %= 100;
-  WriteFontCharacter(year/10+'0');
-  year %= 10;
-  WriteFontCharacter(year+'0');
-
+  
+  /* The clock is inverted (because it looks good!).  For a normal display
+   * that cancels the flip done before sending to the LCD so the bits are 
+   * only flipped when the display is inverted.  They are flipped back 
+   * afterwards so that the next update can redraw parts of the buffer.
+   */
+  if ( State.Invert )
+  {
+    LcdBlitXor(pMyBuffer, FirstRow, Rows, 0, NUM_LCD_COL_BYTES, 0xFF);
   }
-}
-
-/* these items are 4w by 10h */
-static void WriteIcon4w10h(unsigned char const * pIcon,
-                           unsigned char RowOffset,
-                           unsigned char ColumnOffset)
-{
-
-  /* copy digit into correct position */
-  unsigned char RowNumber;
-  unsigned char Column;
-
-  for ( Column = 0; Column < 4; Column++ )
+  
+  UpdateMyDisplay((unsigned char*)&pMyBuffer[FirstRow], Rows);
+  ClearLcdRowsWritten(FirstRow, Rows);
+  
+  if ( State.Invert )
   {
-    for ( RowNumber = 0; RowNumber < 10; RowNumber++ )
-    {
-      // RM: Changed to |= to stop the icon overwriting the first time digit
-      pMyBuffer[RowNumber+RowOffset].Data[Column+ColumnOffset] |=
-        pIcon[RowNumber+(Column*10)];
-    }
+    LcdBlitXor(pMyBuffer, FirstRow, Rows, 0, NUM_LCD_COL_BYTES, 0xFF);
   }
 }
 
-unsigned char* GetTemplatePointer(unsigned char TemplateSelect)
-{
-  return NULL;
-}
 
 const unsigned char pBarCodeImage[BAR_CODE_ROWS * NUM_LCD_COL_BYTES] =
 {
@@ -1731,21 +1531,6 @@ const unsigned char pMetaWatchSplash[SPLASH_ROWS * NUM_LCD_COL_BYTES] =
   0x06,0xC1,0xFC,0x30,0x03,0x46,0x10,0x01,0x22,0xE0,0x83,0x40
 };
 
-const unsigned char Am[10*4] =
-{
-  0x00,0x00,0x9C,0xA2,0xA2,0xA2,0xBE,0xA2,0xA2,0x00,
-  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-};
-
-const unsigned char Pm[10*4] =
-{
-  0x00,0x00,0x9E,0xA2,0xA2,0x9E,0x82,0x82,0x82,0x00,
-  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-};
 /*
 const unsigned char DaysOfWeek[7][10*4] =
 {
@@ -1844,70 +1629,14 @@ unsigned char QueryInvertDisplay(void)
 
 /******************************************************************************/
 
-static unsigned int CharacterMask;
-static unsigned char CharacterRows;
-static unsigned char CharacterWidth;
-static unsigned int bitmap[MAX_FONT_ROWS];
-
-static void AdvanceBitColumnMask(unsigned int pixels)
-{
-  int i=0;
-  for(i = 0; i < pixels; i++)
-  {
-    gBitColumnMask = gBitColumnMask << 1;
-    if ( gBitColumnMask == 0 )
-    {
-      gBitColumnMask = BIT0;
-      gColumn++;
-    }
-  }
-}
-
-/* fonts can be up to 16 bits wide */
 static void WriteFontCharacter(unsigned char Character)
 {
-  CharacterMask = BIT0;
-  CharacterRows = GetCharacterHeight();
-  CharacterWidth = GetCharacterWidth(Character);
-  GetCharacterBitmap(Character,(unsigned int*)&bitmap);
-
-  if ( gRow + CharacterRows > NUM_LCD_ROWS )
-  {
-    PrintString("Not enough rows to display character\r\n");
-    return;
-  }
-
-  /* do things bit by bit */
-  unsigned char i;
-  unsigned char row;
-
-  for (i = 0 ; i < CharacterWidth && gColumn < NUM_LCD_COL_BYTES; i++ )
-  {
-  	for(row = 0; row < CharacterRows; row++)
-    {
-      if ( (CharacterMask & bitmap[row]) != 0 )
-      {
-        pMyBuffer[gRow+row].Data[gColumn] |= gBitColumnMask;
-      }
-    }
-
-    /* the shift direction seems backwards... */
-    CharacterMask = CharacterMask << 1;
-    AdvanceBitColumnMask(1);
-  }
-
-  /* add spacing between characters */
-  AdvanceBitColumnMask(GetFontSpacing());
+  WriteLcdCharacter(pMyBuffer, &gText, Character);
 }
 
-void WriteFontString(tString *pString)
+static void WriteFontString(tString *pString)
 {
-  unsigned char i = 0;
-
-  while (pString[i] != 0 && gColumn < NUM_LCD_COL_BYTES)
-  {
-    WriteFontCharacter(pString[i++]);
-  }
+  WriteLcdString(pMyBuffer, &gText, pString);
 }
 
 unsigned char QueryButtonMode(void)
@@ -1926,10 +1655,22 @@ unsigned char LcdRtcUpdateHandlerIsr(void)
     if (QueryDisplaySeconds() || lastMin != RTCMIN)
     {
       lastMin = RTCMIN;
-      tMessage Msg;
-      SetupMessage(&Msg, IdleUpdate, DATE_TIME_ONLY);
-      SendMessageToQueueFromIsr(DISPLAY_QINDEX, &Msg);
-      ExitLpm = 1;
+      
+      /* the pending update reads the rtc when it is drawn so it replaces
+       * this one 
+       */
+      if ( QueryRtcIdleUpdatePending() )
+      {
+        gAppStats.CoalescedIdleUpdates++;
+      }
+      else
+      {
+        tMessage Msg;
+        SetupMessage(&Msg, IdleUpdate, RTC_DATE_TIME_ONLY);
+        SetRtcIdleUpdatePending(
+          SendMessageToQueueFromIsr(DISPLAY_QINDEX, &Msg));
+        ExitLpm = 1;
+      }
     }
   }
 
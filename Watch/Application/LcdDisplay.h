@@ -57,12 +57,6 @@ unsigned char GetIdleBufferConfiguration(void);
  */
 unsigned char QueryInvertDisplay(void);
 
-/*! Get pointer to an LCD screen template
- *
- *\return NULL - NOT IMPLEMENTED - end result is to have phone be able to program
- * templates into the watch.
- */
-unsigned char* GetTemplatePointer(unsigned char TemplateSelect);
 
 /*!
  * \return 1 if the idle page being display is the normal idle page and
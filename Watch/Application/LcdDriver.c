@@ -21,6 +21,7 @@
  */
 /******************************************************************************/
 #include "FreeRTOS.h"
+#include "semphr.h"
 
 #include "hal_board_type.h"
 #include "hal_clock_control.h"
@@ -31,6 +32,8 @@
 #include "DebugUart.h"
 #include "LcdDriver.h"
 #include "LcdDisplay.h"
+#include "LcdBlit.h"
+#include "Crc16.h"
 
 /******************************************************************************/
 
@@ -45,9 +48,32 @@ static unsigned char LCD_STATIC_COMMAND[] = {LCD_STATIC_CMD, 0x00, 0x00};
 /* errata - DMA variables cannot be function scope */
 static unsigned char LcdDmaBusy = 0;
 
+/* 
+ * The LCD SPI clock is 1 MHz so a burst of lines takes about 1 ms.  When 
+ * more than LCD_DMA_BLOCKING_SIZE bytes are left the task waits on a 
+ * semaphore that is given by the DMA interrupt so that other tasks can run 
+ * (or the part can sleep) while the data is shifted out.
+ */
+#define LCD_DMA_BLOCKING_SIZE ( 32 )
+
+static xSemaphoreHandle LcdDmaDone;
+static unsigned char LcdDmaWaiting = 0;
+
+/* hash of what each row of the panel shows (when the valid bit is set) */
+static unsigned int LcdRowHash[NUM_LCD_ROWS];
+static unsigned char LcdRowHashValid[NUM_LCD_ROWS / 8];
+
+/* rows written since their owner last called ClearLcdRowsWritten */
+static unsigned char LcdRowWritten[NUM_LCD_ROWS / 8];
+
 /******************************************************************************/
 
 static void WriteLineToLcd(unsigned char* pData,unsigned char Size);
+static void StartLineToLcd(unsigned char* pData,unsigned char Size);
+static void FinishLineToLcd(void);
+static void WaitForLcdDma(void);
+static void InvalidateLcdRow(unsigned char Row);
+static void InvalidateLcdRows(void);
 
 
 /******************************************************************************/
@@ -82,12 +108,24 @@ void LcdPeripheralInit(void)
   /* remove reset */
   LCD_SPI_UCBxCTL1 &= ~UCSWRST;
   
+  /* the semaphore is given by the dma interrupt */
+  vSemaphoreCreateBinary(LcdDmaDone);
+  xSemaphoreTake(LcdDmaDone, DONT_WAIT);
+  
 
 }
 
 /*! Writes a single line to the LCD */
 void WriteLcdHandler(tLcdMessagePayload* pLcdMessage)
 {
+  StartLcdLineWrite(pLcdMessage);
+  WaitForLcdLineWrite();
+}
+
+void StartLcdLineWrite(tLcdMessagePayload* pLcdMessage)
+{
+  InvalidateLcdRow(pLcdMessage->RowNumber);
+  
   pLcdMessage->LcdCommand = LCD_WRITE_CMD;
   pLcdMessage->RowNumber += FIRST_LCD_LINE_OFFSET;
   
@@ -97,11 +135,7 @@ void WriteLcdHandler(tLcdMessagePayload* pLcdMessage)
   /* flip bits */
   if ( QueryInvertDisplay() == NORMAL_DISPLAY )
   {
-  	unsigned char i;
-    for (i = 0; i < 12; i++ )
-    {
-      pLcdMessage->pLine[i] = ~(pLcdMessage->pLine[i]); 
-    }
+    InvertLcdBytes(pLcdMessage->pLine, NUM_LCD_COL_BYTES);
   }
 
   pLcdMessage->Dummy1 = 0x00; 
@@ -112,13 +146,129 @@ void WriteLcdHandler(tLcdMessagePayload* pLcdMessage)
    */
   unsigned char Size = 16;
   
-  WriteLineToLcd(pData,Size);
+  StartLineToLcd(pData,Size);
+  
+}
+
+void WaitForLcdLineWrite(void)
+{
+  FinishLineToLcd();
+}
+
+static void InvalidateLcdRow(unsigned char Row)
+{
+  if ( Row < NUM_LCD_ROWS )
+  {
+    LcdRowHashValid[Row >> 3] &= ~(1 << (Row & 0x07));
+    LcdRowWritten[Row >> 3] |= 1 << (Row & 0x07);
+  }
+}
+
+static void InvalidateLcdRows(void)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < sizeof(LcdRowHashValid); i++ )
+  {
+    LcdRowHashValid[i] = 0;
+    LcdRowWritten[i] = 0xFF;
+  }
+}
+
+unsigned char QueryLcdRowsWritten(unsigned char StartingRow,
+                                  unsigned char NumberOfRows)
+{
+  unsigned char Row;
+  
+  for ( Row = StartingRow; 
+        Row < NUM_LCD_ROWS && Row < StartingRow + NumberOfRows; 
+        Row++ )
+  {
+    if ( LcdRowWritten[Row >> 3] & (1 << (Row & 0x07)) )
+    {
+      return 1;
+    }
+  }
+  
+  return 0;
+}
+
+void ClearLcdRowsWritten(unsigned char StartingRow, unsigned char NumberOfRows)
+{
+  unsigned char Row;
+  
+  for ( Row = StartingRow; 
+        Row < NUM_LCD_ROWS && Row < StartingRow + NumberOfRows; 
+        Row++ )
+  {
+    LcdRowWritten[Row >> 3] &= ~(1 << (Row & 0x07));
+  }
+}
+
+/* The hash is the CRC-16 of the row and the invert setting (it changes what 
+ * the panel shows).  A changed row is only skipped when its CRC is the same 
+ * as before, which is about 1 in 65536 changes; clearing the lcd writes
+ * every row again.
+ */
+static unsigned int HashLcdRow(unsigned char* pData)
+{
+  unsigned char Invert = ( QueryInvertDisplay() != NORMAL_DISPLAY );
+  unsigned int Hash = Crc16(CRC16_INIT, pData, NUM_LCD_COL_BYTES);
+  
+  return Crc16(Hash, &Invert, 1);
+}
+
+unsigned char AddLcdBurstLine(tLcdBurst* pBurst,
+                              unsigned char Index,
+                              unsigned char Row,
+                              unsigned char* pData)
+{
+  tLcdLine* pLine = &pBurst->Line[Index];
+  unsigned int Hash = HashLcdRow(pData);
+  unsigned char Bit = 1 << (Row & 0x07);
+  
+  if (   (LcdRowHashValid[Row >> 3] & Bit) 
+      && LcdRowHash[Row] == Hash )
+  {
+    return 0;
+  }
+  
+  LcdRowHash[Row] = Hash;
+  LcdRowHashValid[Row >> 3] |= Bit;
+  LcdRowWritten[Row >> 3] |= Bit;
+  
+  pLine->Row = Row + FIRST_LCD_LINE_OFFSET;
+  pLine->Dummy = 0x00;
+  
+  /* flip bits */
+  CopyLcdBytes(pLine->Data, 
+               pData, 
+               NUM_LCD_COL_BYTES, 
+               QueryInvertDisplay() == NORMAL_DISPLAY);
+  
+  return 1;
+}
+
+void StartLcdBurstWrite(tLcdBurst* pBurst, unsigned char Count)
+{
+  unsigned char* pData = &pBurst->LcdCommand;
+  
+  /* 1 for the command, the lines, and then 1 more dummy byte (this is the 
+   * row byte of the next line when the burst isn't full)
+   */
+  unsigned char Size = 1 + Count * sizeof(tLcdLine) + 1;
+  
+  pBurst->LcdCommand = LCD_WRITE_CMD;
+  pData[Size - 1] = 0x00;
+  
+  StartLineToLcd(pData,Size);
   
 }
 
 
 void ClearLcd(void)
 {
+  InvalidateLcdRows();
   WriteLineToLcd(LCD_CLEAR_COMMAND,LCD_CLEAR_CMD_SIZE);   
 }
     
@@ -128,6 +278,13 @@ void PutLcdIntoStaticMode(void)
 }
     
 static void WriteLineToLcd(unsigned char* pData,unsigned char Size)
+{
+  StartLineToLcd(pData,Size);
+  FinishLineToLcd();
+}
+
+/* with DMA this returns while the line is being sent */
+static void StartLineToLcd(unsigned char* pData,unsigned char Size)
 {  
   EnableSmClkUser(LCD_USER);
   LCD_CS_ASSERT();
@@ -156,8 +313,6 @@ static void WriteLineToLcd(unsigned char* pData,unsigned char Size)
   
   /* start the transfer */
   DMA2CTL |= DMAEN;
-  
-  while(LcdDmaBusy);
     
 #else
 
@@ -168,7 +323,15 @@ static void WriteLineToLcd(unsigned char* pData,unsigned char Size)
   }
 
 #endif
-    
+
+}
+
+static void FinishLineToLcd(void)
+{
+#ifdef DMA
+  WaitForLcdDma();
+#endif
+  
   /* wait for shift to complete ( ~3 us ) */
   while( (LCD_SPI_UCBxSTAT & 0x01) != 0 );
   
@@ -180,6 +343,14 @@ static void WriteLineToLcd(unsigned char* pData,unsigned char Size)
 
 void UpdateMyDisplay(unsigned char * pBuffer,unsigned int TotalLines)
 {  
+  tLcdLine* pLine = (tLcdLine*)pBuffer;
+  unsigned int i;
+  
+  for ( i = 0; i < TotalLines; i++ )
+  {
+    InvalidateLcdRow(pLine[i].Row - FIRST_LCD_LINE_OFFSET);
+  }
+  
   EnableSmClkUser(LCD_USER);
   LCD_CS_ASSERT();
   
@@ -213,7 +384,7 @@ void UpdateMyDisplay(unsigned char * pBuffer,unsigned int TotalLines)
   /* start the transfer */
   DMA2CTL |= DMAEN;
   
-  while(LcdDmaBusy);
+  WaitForLcdDma();
 
 #else
 
@@ -244,7 +415,42 @@ void UpdateMyDisplay(unsigned char * pBuffer,unsigned int TotalLines)
   PutLcdIntoStaticMode();
 }
 
-void LcdDmaIsr(void)
+/* the interrupt only gives the semaphore when the task is waiting on it */
+static void WaitForLcdDma(void)
 {
+  unsigned char Block = 0;
+  
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  if ( LcdDmaBusy && DMA2SZ > LCD_DMA_BLOCKING_SIZE )
+  {
+    LcdDmaWaiting = 1;
+    Block = 1;
+  }
+  
+  __set_interrupt_state(IntState);
+  
+  if ( Block )
+  {
+    xSemaphoreTake(LcdDmaDone, portMAX_DELAY);
+  }
+  
+  while(LcdDmaBusy);
+}
+
+unsigned char LcdDmaIsr(signed portBASE_TYPE* pTaskWoken)
+{
+  unsigned char ExitLpm = 0;
+  
   LcdDmaBusy = 0;
+  
+  if ( LcdDmaWaiting )
+  {
+    LcdDmaWaiting = 0;
+    xSemaphoreGiveFromISR(LcdDmaDone, pTaskWoken);
+    ExitLpm = 1;
+  }
+  
+  return ExitLpm;
 }
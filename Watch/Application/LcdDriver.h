@@ -33,9 +33,85 @@ void LcdPeripheralInit(void);
  */
 void WriteLcdHandler(tLcdMessagePayload* pLcdMessage);
 
+/*! Start writing a line to the LCD.  The line is sent by DMA so the caller 
+ * can do other work (with a different DMA channel) until 
+ * WaitForLcdLineWrite is called.
+ *
+ * \param pLcdMessage is a pointer to a Lcd Message.  It cannot be changed 
+ * until the write is finished.
+ */
+void StartLcdLineWrite(tLcdMessagePayload* pLcdMessage);
+
+/*! Wait for the line(s) started by StartLcdLineWrite or StartLcdBurstWrite 
+ * to be sent 
+ */
+void WaitForLcdLineWrite(void);
+
+/*! Number of lines that can be sent to the LCD with one write command */
+#define LCD_BURST_LINES ( 8 )
+
+/*! Lines are sent to the LCD in one transaction (chip select) with one DMA
+ * transfer.  The LCD requires one more dummy byte after the last line.
+ *
+ * \param LcdCommand is the write command
+ * \param Line are the lines
+ * \param Trailer is room for the extra dummy byte 
+ */
+typedef struct
+{
+  unsigned char LcdCommand;
+  tLcdLine Line[LCD_BURST_LINES];
+  unsigned char Trailer;
+  
+} tLcdBurst;
+
+/*! Put a line into a burst unless the panel already shows it.  The data is
+ * inverted (when required) as it is copied.
+ *
+ * A hash of each row on the panel is kept so that a row that has not changed
+ * is not sent again.  The hash is updated when the line is added, so the
+ * burst must be sent.
+ *
+ * \param pBurst is the burst
+ * \param Index is the position of the line in the burst
+ * \param Row is the row of the line on the LCD (starting at 0)
+ * \param pData is the NUM_LCD_COL_BYTES of line data
+ * \return 1 if the line was added, 0 if the panel already shows it
+ */
+unsigned char AddLcdBurstLine(tLcdBurst* pBurst,
+                              unsigned char Index,
+                              unsigned char Row,
+                              unsigned char* pData);
+
+/*! Start writing the first Count lines of a burst to the LCD.  The burst
+ * cannot be changed until WaitForLcdLineWrite returns.
+ *
+ * \param pBurst is the burst
+ * \param Count is the number of lines (1 to LCD_BURST_LINES)
+ */
+void StartLcdBurstWrite(tLcdBurst* pBurst, unsigned char Count);
+
 /*! Clear the LCD */
 void ClearLcd(void);
 
+/*! Check whether any of a range of rows has been written to the LCD since 
+ * ClearLcdRowsWritten was called for them.  This lets the code that owns 
+ * part of the screen know that the LCD no longer shows what it sent.
+ *
+ * \param StartingRow is the first row (0 based)
+ * \param NumberOfRows
+ * \return 1 if any of the rows has been written, 0 otherwise
+ */
+unsigned char QueryLcdRowsWritten(unsigned char StartingRow,
+                                  unsigned char NumberOfRows);
+
+/*! Mark a range of rows as not written (usually right after writing them)
+ *
+ * \param StartingRow is the first row (0 based)
+ * \param NumberOfRows
+ */
+void ClearLcdRowsWritten(unsigned char StartingRow, unsigned char NumberOfRows);
+
 /*! Draw the display generated by the watch firmware
  *
  * \param pBuffer is a pointer to the buffer to draw
@@ -48,8 +124,12 @@ void UpdateMyDisplay(unsigned char * pBuffer,unsigned int TotalLines);
 
 /*! Callback from the DMA interrupt service routing that lets LCD task know 
  * that the dma has finished
+ *
+ * \param pTaskWoken is set to pdTRUE when the task that was woken should 
+ * run before the interrupted one
+ * \return 1 if the processor should exit low power mode
  */
-void LcdDmaIsr(void);
+unsigned char LcdDmaIsr(signed portBASE_TYPE* pTaskWoken);
 
 /*! Write the command that puts the LCD into static mode for power savings */
 void PutLcdIntoStaticMode(void);
@@ -0,0 +1,408 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdIdle.c
+*
+* Each field remembers the value it last drew and the rows and pixels it 
+* covers.  Only the fields whose value changed are cleared and redrawn and 
+* only the rows between the first and last of them are reported.  With 
+* seconds on that is usually the 7 rows of one seconds digit.  The AM/PM 
+* icon is or'ed over the hours so the hours, minutes and AM/PM are one field.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "hal_board_type.h"
+#include "Fonts.h"
+#include "Icons.h"
+#include "Display.h"
+#include "LcdDisplay.h"
+#include "LcdBlit.h"
+#include "LcdText.h"
+#include "LcdIdle.h"
+
+/* the seconds are drawn just after the minutes */
+#define SECONDS_COLUMN           ( 10 )
+#define SECONDS_BIT_COLUMN_MASK  ( BIT4 )
+#define SECONDS_FIRST_PIXEL      ( SECONDS_COLUMN * 8 + 4 )
+#define SECONDS_TENS_ROW         ( 10 )
+#define SECONDS_ONES_ROW         ( 19 )
+
+#define LCD_PIXELS_PER_ROW       ( NUM_LCD_COL_BYTES * 8 )
+
+typedef struct
+{
+  unsigned char StartingRow;
+  unsigned char NumberOfRows;
+  unsigned char FirstPixel;
+  unsigned char NumberOfPixels;
+  
+} tIdleField;
+
+static const tIdleField IdleFields[LCD_IDLE_FIELDS] =
+{
+  /* date, bluetooth, charging and battery */
+  { 2, 5, 0, LCD_PIXELS_PER_ROW },
+  
+  /* hours, minutes and AM/PM */
+  { 10, 16, 0, SECONDS_FIRST_PIXEL },
+  
+  { SECONDS_TENS_ROW, 7, 
+    SECONDS_FIRST_PIXEL, LCD_PIXELS_PER_ROW - SECONDS_FIRST_PIXEL },
+  
+  { SECONDS_ONES_ROW, 7, 
+    SECONDS_FIRST_PIXEL, LCD_PIXELS_PER_ROW - SECONDS_FIRST_PIXEL },
+};
+
+static const unsigned char Am[10*4] =
+{
+  0x00,0x00,0x9C,0xA2,0xA2,0xA2,0xBE,0xA2,0xA2,0x00,
+  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const unsigned char Pm[10*4] =
+{
+  0x00,0x00,0x9E,0xA2,0xA2,0x9E,0x82,0x82,0x82,0x00,
+  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tLcdLine* pIdleBuffer;
+static tLcdTextPosition gText;
+
+static void DrawStatusIconCross(unsigned char bool)
+{
+  if ( !bool )
+  {
+    WriteLcdCharacter(pIdleBuffer, &gText, STATUS_ICON_CROSS);
+  }
+}
+
+/* these items are 4w by 10h */
+static void WriteIcon4w10h(unsigned char const * pIcon,
+                           unsigned char RowOffset,
+                           unsigned char ColumnOffset)
+{
+  unsigned char RowNumber;
+  unsigned char Column;
+
+  for ( Column = 0; Column < 4; Column++ )
+  {
+    for ( RowNumber = 0; RowNumber < 10; RowNumber++ )
+    {
+      // RM: Changed to |= to stop the icon overwriting the first time digit
+      pIdleBuffer[RowNumber+RowOffset].Data[Column+ColumnOffset] |=
+        pIcon[RowNumber+(Column*10)];
+    }
+  }
+}
+
+static void DisplayDate(tLcdIdleState const* pState)
+{
+  gText.BitColumnMask = BIT2;
+  gText.Row = 2;
+  gText.Column = 0;
+  SetFont(MetaWatch5);
+  WriteLcdString(pIdleBuffer, &gText, (tString *)pState->pDayOfWeek);
+
+  if ( pState->OnceConnected )
+  {
+    unsigned char First;
+    unsigned char Second;
+    unsigned int Year = pState->Year;
+    
+    WriteLcdCharacter(pIdleBuffer, &gText, ' ');
+
+    /* determine if month or day is displayed first */
+    if ( pState->DateFormat == MONTH_FIRST )
+    {
+      First = pState->Month;
+      Second = pState->Day;
+    }
+    else
+    {
+      First = pState->Day;
+      Second = pState->Month;
+    }
+
+    WriteLcdCharacter(pIdleBuffer, &gText, First/10+'0');
+    WriteLcdCharacter(pIdleBuffer, &gText, First%10+'0');
+    WriteLcdCharacter(pIdleBuffer, &gText, '.');
+    WriteLcdCharacter(pIdleBuffer, &gText, Second/10+'0');
+    WriteLcdCharacter(pIdleBuffer, &gText, Second%10+'0');
+
+    WriteLcdCharacter(pIdleBuffer, &gText, '.');
+
+    WriteLcdCharacter(pIdleBuffer, &gText, Year/1000+'0');
+    Year %= 1000;
+    WriteLcdCharacter(pIdleBuffer, &gText, Year/100+'0');
+    Year %= 100;
+    WriteLcdCharacter(pIdleBuffer, &gText, Year/10+'0');
+    Year %= 10;
+    WriteLcdCharacter(pIdleBuffer, &gText, Year+'0');
+  }
+}
+
+static void DrawIdleStatus(tLcdIdleState const* pState)
+{
+  SetFont(StatusIcons);
+  gText.Row = 2;
+
+  if ( pState->OnceConnected )
+  {
+    unsigned char bluetooth = pState->BluetoothOn;
+    unsigned char connected = pState->PhoneConnected;
+
+    if ( (!bluetooth) || (bluetooth&&connected) ) {
+      gText.Column = 8;
+      gText.BitColumnMask = BIT5;
+    }
+    else
+    {
+      gText.Column = 8;
+      gText.BitColumnMask = BIT1;
+    }
+
+    DrawStatusIconCross( bluetooth );
+    WriteLcdCharacter(pIdleBuffer, &gText, STATUS_ICON_BLUETOOTH);
+
+    if (bluetooth) {
+      AdvanceLcdText(&gText, 1);
+      DrawStatusIconCross( connected );
+      WriteLcdCharacter(pIdleBuffer, &gText, STATUS_ICON_PHONE);
+    }
+  }
+
+  gText.Column = 10;
+  gText.BitColumnMask = BIT0;
+  if ( pState->Charging )
+  {
+    WriteLcdCharacter(pIdleBuffer, &gText, STATUS_ICON_SPARK);
+  }
+
+  gText.Column = 10;
+  gText.BitColumnMask = BIT6;
+  WriteLcdCharacter(pIdleBuffer, &gText, pState->Battery);
+
+  DisplayDate(pState);
+}
+
+static void DrawIdleClock(tLcdIdleState const* pState)
+{
+  unsigned char Hour = pState->Hour;
+  unsigned char msd;
+  unsigned char lsd;
+
+  if ( pState->LinkLost )
+  {
+    LcdBlitCopy(pIdleBuffer,
+                pPhoneDisconnectedIdlePageIcon,
+                10,
+                IDLE_PAGE_ICON_SIZE_IN_ROWS,
+                1,
+                IDLE_PAGE_ICON_SIZE_IN_COLS);
+
+    SetFont(MetaWatch16);
+
+    gText.Column = 3;
+    gText.BitColumnMask = BIT4;
+    gText.Row = 11;
+    WriteLcdString(pIdleBuffer, &gText, "Link Lost");
+    return;
+  }
+
+  /* if required convert to twelve hour format */
+  if ( pState->TimeFormat == TWELVE_HOUR )
+  {
+    Hour %= 12;
+    if (Hour == 0) Hour = 12;
+  }
+  
+  msd = Hour / 10;
+  lsd = Hour % 10;
+
+  gText.Row = 10;
+  if ( pState->DisplaySeconds )
+  {
+    gText.Column = 0;
+    gText.BitColumnMask = BIT6;
+  }
+  else
+  {
+    gText.Column = 1;
+    gText.BitColumnMask = BIT2;
+  }
+  SetFont(MetaWatchTime);
+
+  /* if first digit is zero then leave location blank */
+  if ( msd == 0 && pState->TimeFormat == TWELVE_HOUR )
+  {
+    WriteLcdCharacter(pIdleBuffer, &gText, TIME_CHARACTER_SPACE_INDEX);
+  }
+  else
+  {
+    WriteLcdCharacter(pIdleBuffer, &gText, msd);
+  }
+
+  WriteLcdCharacter(pIdleBuffer, &gText, lsd);
+
+  WriteLcdCharacter(pIdleBuffer, &gText, TIME_CHARACTER_COLON_INDEX);
+
+  /* display minutes */
+  msd = pState->Minutes / 10;
+  lsd = pState->Minutes % 10;
+  WriteLcdCharacter(pIdleBuffer, &gText, msd);
+  WriteLcdCharacter(pIdleBuffer, &gText, lsd);
+
+  if ( pState->TimeFormat == TWELVE_HOUR ) 
+  {
+    WriteIcon4w10h(( pState->Hour >= 12 ) ? Pm : Am, 16, 0);
+  }
+}
+
+static void DrawIdleSecondsDigit(unsigned char Row, unsigned char Digit)
+{
+  SetFont(MetaWatchSeconds);
+  gText.Row = Row;
+  gText.Column = SECONDS_COLUMN;
+  gText.BitColumnMask = SECONDS_BIT_COLUMN_MASK;
+  WriteLcdCharacter(pIdleBuffer, &gText, Digit);
+}
+
+unsigned char DrawLcdIdle(tLcdLine* pBuffer,
+                          tLcdIdleFields* pFields,
+                          tLcdIdleState const* pState,
+                          unsigned char* pFirstRow)
+{
+  unsigned char ShowSeconds = pState->DisplaySeconds && !pState->LinkLost;
+  unsigned char Tens = pState->Seconds / 10;
+  unsigned char Ones = pState->Seconds % 10;
+  unsigned long Value[LCD_IDLE_FIELDS];
+  unsigned char Field;
+  
+  /* a change to any of these moves things so everything is redrawn */
+  unsigned int Layout = pState->DisplaySeconds
+                      | (pState->TimeFormat << 1)
+                      | (pState->DateFormat << 2)
+                      | (pState->Language << 3)
+                      | (pState->LinkLost << 5)
+                      | (pState->OnceConnected << 6)
+                      | (pState->Invert << 7);
+  
+  Value[LCD_IDLE_STATUS_FIELD] = (unsigned long)pState->Year
+                               | ((unsigned long)pState->Month << 12)
+                               | ((unsigned long)pState->Day << 16)
+                               | ((unsigned long)pState->DayOfWeek << 21)
+                               | ((unsigned long)pState->Battery << 24)
+                               | ((unsigned long)pState->Charging << 28)
+                               | ((unsigned long)pState->BluetoothOn << 29)
+                               | ((unsigned long)pState->PhoneConnected << 30);
+  
+  Value[LCD_IDLE_CLOCK_FIELD] = 
+    pState->LinkLost ? 0 : (pState->Hour << 8) | pState->Minutes;
+  Value[LCD_IDLE_SECONDS_TENS_FIELD] = ShowSeconds ? Tens : 0;
+  Value[LCD_IDLE_SECONDS_ONES_FIELD] = ShowSeconds ? Ones : 0;
+  
+  unsigned char FullUpdate = !pFields->Drawn || Layout != pFields->Layout;
+  unsigned char FirstRow = WATCH_DRAWN_IDLE_BUFFER_ROWS;
+  unsigned char LastRow = 0;
+  
+  pIdleBuffer = pBuffer;
+  
+  if ( FullUpdate )
+  {
+    // clean date&time area
+    LcdBlitFill(pBuffer, 
+                0, 
+                WATCH_DRAWN_IDLE_BUFFER_ROWS, 
+                0, 
+                NUM_LCD_COL_BYTES, 
+                0x00);
+    FirstRow = 0;
+    LastRow = WATCH_DRAWN_IDLE_BUFFER_ROWS;
+  }
+  
+  for ( Field = 0; Field < LCD_IDLE_FIELDS; Field++ )
+  {
+    tIdleField const* pField = &IdleFields[Field];
+    
+    if ( !FullUpdate && Value[Field] == pFields->Value[Field] )
+    {
+      continue;
+    }
+    
+    pFields->Value[Field] = Value[Field];
+    
+    if ( !FullUpdate )
+    {
+      unsigned char Pixels = pField->NumberOfPixels;
+      
+      /* without seconds the minutes use the space of the seconds */
+      if ( Field == LCD_IDLE_CLOCK_FIELD && !pState->DisplaySeconds )
+      {
+        Pixels = LCD_PIXELS_PER_ROW - pField->FirstPixel;
+      }
+      
+      LcdBlitClearPixels(pBuffer,
+                         pField->StartingRow,
+                         pField->NumberOfRows,
+                         pField->FirstPixel,
+                         Pixels);
+      
+      if ( pField->StartingRow < FirstRow )
+      {
+        FirstRow = pField->StartingRow;
+      }
+      
+      if ( pField->StartingRow + pField->NumberOfRows > LastRow )
+      {
+        LastRow = pField->StartingRow + pField->NumberOfRows;
+      }
+    }
+    
+    switch ( Field )
+    {
+    case LCD_IDLE_STATUS_FIELD:
+      DrawIdleStatus(pState);
+      break;
+      
+    case LCD_IDLE_CLOCK_FIELD:
+      DrawIdleClock(pState);
+      break;
+      
+    case LCD_IDLE_SECONDS_TENS_FIELD:
+      if ( ShowSeconds ) DrawIdleSecondsDigit(SECONDS_TENS_ROW, Tens);
+      break;
+      
+    case LCD_IDLE_SECONDS_ONES_FIELD:
+      if ( ShowSeconds ) DrawIdleSecondsDigit(SECONDS_ONES_ROW, Ones);
+      break;
+    }
+  }
+  
+  pFields->Layout = Layout;
+  pFields->Drawn = 1;
+  
+  *pFirstRow = FirstRow;
+  
+  return ( LastRow > FirstRow ) ? LastRow - FirstRow : 0;
+}
@@ -0,0 +1,117 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdIdle.h
+ *
+ * Draw the part of the idle screen that the watch controls (the date, the 
+ * status icons and the clock) into a display buffer made of tLcdLine.  The
+ * area is split into fields that remember what they last drew so that only
+ * the fields that changed are redrawn.  This is for the LCD only.
+ */
+/******************************************************************************/
+
+#ifndef LCD_IDLE_H
+#define LCD_IDLE_H
+
+/*! the watch drawn idle area is the top rows of the display */
+#define WATCH_DRAWN_IDLE_BUFFER_ROWS  ( 30 )
+
+/*! What the idle area shows.  The display task takes a copy of the rtc and
+ * the settings for each update.
+ *
+ * \param Hour is 0 to 23
+ * \param Minutes
+ * \param Seconds
+ * \param Year is 4 digits
+ * \param Month is 1 to 12
+ * \param Day is 1 to 31
+ * \param DayOfWeek is 0 to 6
+ * \param pDayOfWeek is the name of the day in the current language
+ * \param Battery is the status icon of the battery level
+ * \param Charging is 1 when the battery is charging
+ * \param BluetoothOn is 1 when the radio is on
+ * \param PhoneConnected is 1 when the phone is connected
+ * \param OnceConnected is 1 when the phone has connected since power up
+ * \param LinkLost is 1 when the link lost warning replaces the clock
+ * \param DisplaySeconds is 1 when the seconds are shown
+ * \param TimeFormat is TWELVE_HOUR or TWENTY_FOUR_HOUR
+ * \param DateFormat is MONTH_FIRST or DAY_FIRST
+ * \param Language selects the day names
+ * \param Invert is 1 when the display is inverted
+ */
+typedef struct
+{
+  unsigned char Hour;
+  unsigned char Minutes;
+  unsigned char Seconds;
+  unsigned int Year;
+  unsigned char Month;
+  unsigned char Day;
+  unsigned char DayOfWeek;
+  tString const* pDayOfWeek;
+  unsigned char Battery;
+  unsigned char Charging;
+  unsigned char BluetoothOn;
+  unsigned char PhoneConnected;
+  unsigned char OnceConnected;
+  unsigned char LinkLost;
+  unsigned char DisplaySeconds;
+  unsigned char TimeFormat;
+  unsigned char DateFormat;
+  unsigned char Language;
+  unsigned char Invert;
+  
+} tLcdIdleState;
+
+#define LCD_IDLE_STATUS_FIELD        ( 0 )
+#define LCD_IDLE_CLOCK_FIELD         ( 1 )
+#define LCD_IDLE_SECONDS_TENS_FIELD  ( 2 )
+#define LCD_IDLE_SECONDS_ONES_FIELD  ( 3 )
+#define LCD_IDLE_FIELDS              ( 4 )
+
+/*! What the fields of the idle area last drew
+ *
+ * \param Value is the value each field last drew
+ * \param Layout holds the settings that move the fields
+ * \param Drawn is cleared when the buffer rows were used for something else
+ * so that all of the fields are redrawn
+ */
+typedef struct
+{
+  unsigned long Value[LCD_IDLE_FIELDS];
+  unsigned int Layout;
+  unsigned char Drawn;
+  
+} tLcdIdleFields;
+
+/*! Draw the fields of the idle area that changed since the last call.  
+ * Everything is redrawn when Drawn is 0 or a setting that moves the fields
+ * changed.
+ *
+ * \param pBuffer is the display buffer (NUM_LCD_ROWS lines); it is not 
+ * inverted
+ * \param pFields is what the fields last drew in this buffer
+ * \param pState is what to show
+ * \param pFirstRow is set to the first row that changed
+ * \return the number of rows from *pFirstRow that changed (0 if none did)
+ */
+unsigned char DrawLcdIdle(tLcdLine* pBuffer,
+                          tLcdIdleFields* pFields,
+                          tLcdIdleState const* pState,
+                          unsigned char* pFirstRow);
+
+#endif /* LCD_IDLE_H */
@@ -0,0 +1,301 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file LcdText.c
+*
+* Each row of a character is shifted to the bit column of the position and 
+* or'ed into the (up to three) bytes that it covers instead of drawing it a
+* pixel at a time.
+*/
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "hal_board_type.h"
+#include "DebugUart.h"
+#include "Fonts.h"
+#include "LcdDisplay.h"
+#include "LcdText.h"
+
+/* the width of a row in pixels */
+#define LCD_TEXT_PIXELS ( NUM_LCD_COL_BYTES * 8 )
+
+static unsigned char CharacterRows;
+static unsigned char CharacterWidth;
+static unsigned int bitmap[MAX_FONT_ROWS];
+
+/* The clock digits are redrawn every second at the same few bit alignments so
+ * copies of them that are already shifted to those alignments are kept.  
+ * An entry holds the characters of one clock font at one alignment.  
+ * The hours and minutes use two or three alignments and the seconds one, 
+ * so three entries cover the idle screen with or without seconds.  
+ * The number of entries is set for the board in hal_board_type.h; the 
+ * cache is left out when it is 0.
+ */
+#ifndef DIGIT_CACHE_ENTRIES
+#define DIGIT_CACHE_ENTRIES ( 0 )
+#endif
+
+#define DIGIT_CACHE_ROWS    ( 16 )
+#define SHIFTED_ROW_BYTES   ( 3 )
+
+static void ShiftCharacterRow(unsigned int Bits, 
+                              unsigned char Shift,
+                              unsigned char* pShifted);
+
+#if DIGIT_CACHE_ENTRIES > 0
+
+typedef struct
+{
+  unsigned char Valid;
+  etFontType Font;
+  unsigned char Shift;
+  unsigned char 
+    Rows[TOTAL_TIME_CHARACTERS][DIGIT_CACHE_ROWS][SHIFTED_ROW_BYTES];
+  
+} tDigitCacheEntry;
+
+static tDigitCacheEntry DigitCache[DIGIT_CACHE_ENTRIES];
+static unsigned char NextDigitCacheEntry;
+
+/*! Get the pre-shifted rows of a clock character 
+ *
+ * An entry for the current font and alignment is filled when it is first 
+ * needed; the oldest entry is replaced when they are all in use.
+ *
+ * \param Character is the index of the character in the current font
+ * \param Shift is the bit position of the leftmost pixel
+ * \return pointer to the shifted rows or 0 if the character is not cached
+ */
+static unsigned char const* GetCachedCharacter(unsigned char Character,
+                                               unsigned char Shift)
+{
+  etFontType Font = GetFont();
+  unsigned char Characters;
+  
+  switch (Font)
+  {
+  case MetaWatchTime:    Characters = TOTAL_TIME_CHARACTERS;    break;
+  case MetaWatchSeconds: Characters = TOTAL_SECONDS_CHARACTERS; break;
+  default:               Characters = 0;                        break;
+  }
+  
+  if ( Character >= Characters )
+  {
+    return 0;
+  }
+  
+  unsigned char i;
+  tDigitCacheEntry* pEntry = 0;
+  
+  for ( i = 0; i < DIGIT_CACHE_ENTRIES; i++ )
+  {
+    if (   DigitCache[i].Valid 
+        && DigitCache[i].Font == Font 
+        && DigitCache[i].Shift == Shift )
+    {
+      pEntry = &DigitCache[i];
+      break;
+    }
+  }
+  
+  if ( pEntry == 0 )
+  {
+    pEntry = &DigitCache[NextDigitCacheEntry];
+    
+    NextDigitCacheEntry++;
+    if ( NextDigitCacheEntry >= DIGIT_CACHE_ENTRIES )
+    {
+      NextDigitCacheEntry = 0;
+    }
+    
+    pEntry->Valid = 1;
+    pEntry->Font = Font;
+    pEntry->Shift = Shift;
+    
+    unsigned char Rows = GetCharacterHeight();
+    unsigned char c;
+    unsigned char row;
+    
+    for ( c = 0; c < Characters; c++ )
+    {
+      unsigned char Width = GetCharacterWidth(c);
+      unsigned int WidthMask = ( Width < 16 ) ? (1 << Width) - 1 : 0xFFFF;
+      
+      GetCharacterBitmap(c,(unsigned int*)&bitmap);
+      
+      for ( row = 0; row < Rows; row++ )
+      {
+        ShiftCharacterRow(bitmap[row] & WidthMask, 
+                          Shift,
+                          pEntry->Rows[c][row]);
+      }
+    }
+  }
+  
+  return &pEntry->Rows[Character][0][0];
+}
+
+#else
+
+static unsigned char const* GetCachedCharacter(unsigned char Character,
+                                               unsigned char Shift)
+{
+  return 0;
+}
+
+#endif
+
+void AdvanceLcdText(tLcdTextPosition* pPosition, unsigned int Pixels)
+{
+  unsigned int i;
+  
+  /* whole bytes first */
+  pPosition->Column += Pixels >> 3;
+  Pixels &= 0x07;
+  
+  for ( i = 0; i < Pixels; i++ )
+  {
+    pPosition->BitColumnMask = pPosition->BitColumnMask << 1;
+    if ( pPosition->BitColumnMask == 0 )
+    {
+      pPosition->BitColumnMask = BIT0;
+      pPosition->Column++;
+    }
+  }
+}
+
+/* split a row of a character into the three bytes that it covers */
+static void ShiftCharacterRow(unsigned int Bits, 
+                              unsigned char Shift,
+                              unsigned char* pShifted)
+{
+  unsigned int Low = (Bits & 0xFF) << Shift;
+  unsigned int High = (Bits >> 8) << Shift;
+  
+  pShifted[0] = (unsigned char)Low;
+  pShifted[1] = (unsigned char)((Low >> 8) | High);
+  pShifted[2] = (unsigned char)(High >> 8);
+}
+
+/* fonts can be up to 16 bits wide; bit 0 of a bitmap row is the leftmost 
+ * pixel and so is bit 0 of a byte in the buffer 
+ */
+void WriteLcdCharacter(tLcdLine* pBuffer, 
+                       tLcdTextPosition* pPosition,
+                       unsigned char Character)
+{
+  CharacterRows = GetCharacterHeight();
+  CharacterWidth = GetCharacterWidth(Character);
+
+  if ( pPosition->Row + CharacterRows > NUM_LCD_ROWS )
+  {
+    PrintString("Not enough rows to display character\r\n");
+    return;
+  }
+
+  unsigned char Shift = 0;
+  while ( (pPosition->BitColumnMask >> Shift) > 1 )
+  {
+    Shift++;
+  }
+  
+  /* characters are at most 16 pixels wide; the part past the edge is lost */
+  unsigned int WidthMask = 
+    ( CharacterWidth < 16 ) ? (1 << CharacterWidth) - 1 : 0xFFFF;
+  unsigned char Bytes = (Shift + CharacterWidth + 7) >> 3;
+  
+  /* a clipped character moves the position to the edge only */
+  unsigned int Left = (pPosition->Column << 3) + Shift;
+  unsigned int Advance = CharacterWidth;
+  
+  if ( pPosition->Column >= NUM_LCD_COL_BYTES )
+  {
+    Bytes = 0;
+    Advance = 0;
+  }
+  else 
+  {
+    if ( pPosition->Column + Bytes > NUM_LCD_COL_BYTES )
+    {
+      Bytes = NUM_LCD_COL_BYTES - pPosition->Column;
+    }
+    
+    if ( Left + Advance > LCD_TEXT_PIXELS )
+    {
+      Advance = LCD_TEXT_PIXELS - Left;
+    }
+  }
+  
+  /* clock digits are copied from the cache when they are in it */
+  unsigned char const* pCached = GetCachedCharacter(Character, Shift);
+  
+  if ( pCached == 0 )
+  {
+    GetCharacterBitmap(Character,(unsigned int*)&bitmap);
+  }
+  
+  unsigned char row;
+  unsigned char Shifted[SHIFTED_ROW_BYTES];
+  
+  for ( row = 0; row < CharacterRows && Bytes; row++ )
+  {
+    unsigned char const* pShifted;
+    unsigned char* pData = 
+      &pBuffer[pPosition->Row + row].Data[pPosition->Column];
+    
+    if ( pCached )
+    {
+      pShifted = pCached;
+      pCached += SHIFTED_ROW_BYTES;
+    }
+    else
+    {
+      ShiftCharacterRow(bitmap[row] & WidthMask, Shift, Shifted);
+      pShifted = Shifted;
+    }
+    
+    switch ( Bytes )
+    {
+    case 3:
+      pData[2] |= pShifted[2];
+      /* fall through */
+    case 2:
+      pData[1] |= pShifted[1];
+      /* fall through */
+    default:
+      pData[0] |= pShifted[0];
+      break;
+    }
+  }
+
+  /* move past the character and add spacing between characters */
+  AdvanceLcdText(pPosition, Advance + GetFontSpacing());
+}
+
+void WriteLcdString(tLcdLine* pBuffer, 
+                    tLcdTextPosition* pPosition,
+                    tString* pString)
+{
+  unsigned char i = 0;
+
+  while (pString[i] != 0 && pPosition->Column < NUM_LCD_COL_BYTES)
+  {
+    WriteLcdCharacter(pBuffer, pPosition, pString[i++]);
+  }
+}
@@ -0,0 +1,77 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file LcdText.h
+ *
+ * Draw characters of the current font (see Fonts.h) into a display buffer 
+ * made of tLcdLine.  This is for the LCD only.
+ */
+/******************************************************************************/
+
+#ifndef LCD_TEXT_H
+#define LCD_TEXT_H
+
+/*! Where the next character is drawn
+ *
+ * \param Row is the buffer row of the top of the character
+ * \param Column is the column byte of the leftmost pixel
+ * \param BitColumnMask is the bit of the leftmost pixel in the column byte
+ * (BIT0 is the leftmost pixel of a byte)
+ */
+typedef struct
+{
+  unsigned char Row;
+  unsigned char Column;
+  unsigned char BitColumnMask;
+  
+} tLcdTextPosition;
+
+/*! Move a text position to the right
+ *
+ * \param pPosition is the text position
+ * \param Pixels is the number of pixels to move
+ */
+void AdvanceLcdText(tLcdTextPosition* pPosition, unsigned int Pixels);
+
+/*! Or a character of the current font into a display buffer and move the
+ * position past it and the font spacing
+ *
+ * \param pBuffer is the display buffer (NUM_LCD_ROWS lines)
+ * \param pPosition is the text position
+ * \param Character is the character code
+ *
+ * \note Pixels past the right edge are clipped and the position stops at 
+ * the edge before the spacing is added.  Nothing is drawn when the 
+ * character does not fit above the bottom of the display.
+ */
+void WriteLcdCharacter(tLcdLine* pBuffer, 
+                       tLcdTextPosition* pPosition,
+                       unsigned char Character);
+
+/*! Write the characters of a string until the position reaches the right 
+ * edge
+ *
+ * \param pString is a zero terminated string
+ *
+ * \note The other parameters are the same as WriteLcdCharacter
+ */
+void WriteLcdString(tLcdLine* pBuffer, 
+                    tLcdTextPosition* pPosition,
+                    tString* pString);
+
+#endif /* LCD_TEXT_H */
@@ -23,8 +23,10 @@
 #include "FreeRTOS.h"           
 #include "queue.h"              
 #include "task.h"
+#include "semphr.h"
 
 #include "hal_board_type.h"
+#include "hal_crystal_timers.h"
 
 #include "Messages.h"
 #include "BufferPool.h"
@@ -37,17 +39,103 @@ static unsigned char AllQueuesReady = 0;
 static void AllQueuesReadyCheck(void);
 #endif
 
-static void SendMsgToQ(unsigned char Qindex, tMessage* pMsg);
+static void SendMsgToQ(unsigned char Qindex,
+                       tMessage* pMsg,
+                       unsigned char Flags);
+static xQueueHandle GetDestinationQueue(unsigned char Qindex, tMessage* pMsg);
+static void CountEnqueue(unsigned char Qindex,
+                         tMessage* pMsg,
+                         unsigned char Queued);
+static void CountDequeue(unsigned char Qindex, tMessage* pMsg);
+static void ReturnFlowControlCredit(tMessage* pMsg);
+static unsigned char GetFlowControlFlags(tMessage* pMsg);
+
+static void RouteMsgWithFlags(tMessage* pMsg, unsigned char Flags);
 
 xQueueHandle QueueHandles[TOTAL_QUEUES];
 
+/* QueueHandles[DISPLAY_QINDEX] is the low priority lane of the display queue.
+ * The doorbell is given after a message is put into either lane so the 
+ * display task can wait on both.  It only holds one give and does not count
+ * messages.  The display task looks at both lanes before it waits on the 
+ * doorbell so a message that was already taken out (while its doorbell was
+ * not given yet) only costs one extra look at the lanes.
+ */
+static xQueueHandle DisplayHighLane;
+static xSemaphoreHandle DisplayDoorbell;
+
+/* telemetry is kept for each queue and for each message type in the 
+ * message type list (unlisted types are counted as InvalidMessage)
+ */
+typedef struct
+{
+  unsigned int Enqueued;
+  unsigned int Dropped;
+  unsigned char MaxDepth;
+  unsigned int Latency[QUEUE_LATENCY_BINS];
+  
+} tQueueTelemetry;
+
+typedef struct
+{
+  unsigned int Enqueued;
+  unsigned int Dropped;
+  unsigned int MaxLatency;
+  
+} tMessageTypeTelemetry;
+
+#define MESSAGE_TYPE_SLOT(Name, Value, Queue, Flags) Name##Slot,
+
+typedef enum
+{
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_SLOT)
+  MessageTypeSlots
+  
+} eMessageTypeSlot;
+
+#define MESSAGE_TYPE_TO_SLOT(Name, Value, Queue, Flags) [Value] = Name##Slot,
+
+static const unsigned char TypeSlot[MaxMessageType + 1] =
+{
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_TO_SLOT)
+};
+
+#define MESSAGE_TYPE_OF_SLOT(Name, Value, Queue, Flags) Value,
+
+static const unsigned char SlotType[MessageTypeSlots] =
+{
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_OF_SLOT)
+};
+
+static tQueueTelemetry QueueTelemetry[TOTAL_QUEUES];
+static tMessageTypeTelemetry TypeTelemetry[MessageTypeSlots];
+
+/* Credit based flow control of the bulk display messages from the host.
+ * Outstanding is the number of credits the host has (or has used for 
+ * messages that have not been freed yet).  Returned is the number of 
+ * credits that will be given back to the host in the next credit message.
+ * Only messages that were queued with MSG_CREDIT return a credit.  Some of 
+ * the queue and the buffers are kept for the messages of the watch.
+ */
+#define FLOW_CONTROL_QUEUE_RESERVE  ( 2 )
+#define FLOW_CONTROL_BUFFER_RESERVE ( 4 )
+
+/* credits are not sent one at a time unless the host has run out */
+#define FLOW_CONTROL_CREDIT_BATCH   ( 2 )
+
+static unsigned char DisplayLowLaneLength;
+static unsigned char FlowControlEnabled;
+static unsigned char FlowControlOutstanding;
+static unsigned char FlowControlReturned;
+
 /* most messages do not have a buffer so there really isn't anything to free */
 void SendToFreeQueue(tMessage* pMsg)
 {
-  if ( pMsg->pBuffer != 0 )
+  if (   pMsg->pBuffer != 0 
+      && pMsg->pBuffer != MSG_INLINE_PAYLOAD )
   {
-    /* The free queue is different.  
-     * It holds pointers to buffers not messages 
+    /* The free "queue" is different.  
+     * It is a list of buffers not messages 
      */
     BPL_FreeMessageBuffer(pMsg->pBuffer);
   }
@@ -56,12 +144,19 @@ void SendToFreeQueue(tMessage* pMsg)
   
 void SendToFreeQueueIsr(tMessage* pMsg)
 {
-  if ( pMsg->pBuffer != 0 )
+  if (   pMsg->pBuffer != 0 
+      && pMsg->pBuffer != MSG_INLINE_PAYLOAD )
   {
     BPL_FreeMessageBufferFromIsr(pMsg->pBuffer);
   }
 }
 
+void FreeQueuedMessage(tMessage* pMsg)
+{
+  ReturnFlowControlCredit(pMsg);
+  SendToFreeQueue(pMsg);
+}
+
 #ifdef MESSAGE_QUEUE_DEBUG
 static void AllQueuesReadyCheck(void)
 {
@@ -69,8 +164,9 @@ static void AllQueuesReadyCheck(void)
   {
     unsigned char Result = 1;
     
+    /* buffers are not kept in a queue so the free queue is never created */
     unsigned char i;
-    for (i = 0; i < TOTAL_QUEUES; i++ )
+    for (i = FREE_QINDEX + 1; i < TOTAL_QUEUES; i++ )
     {
       if ( QueueHandles[i] == NULL )
       {
@@ -103,17 +199,102 @@ void PrintQueueNameIsFull(unsigned char Qindex)
 }
   
 
+/* The serial port profile task queue only holds the first part of a 
+ * message so an inline payload has to be copied into a buffer.  This is done
+ * to the queued copy; the caller's message is not changed.
+ *
+ * \return 0 if there was no buffer (the message is dropped)
+ */
+static unsigned char MoveInlinePayloadToBuffer(tMessage* pQueuedMsg, 
+                                               unsigned char* pBuffer)
+{
+  unsigned char i;
+  
+  if ( pBuffer == NULL )
+  {
+    return 0;
+  }
+  
+  for ( i = 0; i < MSG_INLINE_PAYLOAD_LENGTH; i++ )
+  {
+    pBuffer[i] = pQueuedMsg->InlinePayload[i];
+  }
+  
+  pQueuedMsg->pBuffer = pBuffer;
+  return 1;
+  
+}
+
+/* The stack library routes messages with its own tMessage, which ends after
+ * pBuffer.  Only the fields it has are read from the caller.  The inline 
+ * payload is only read when the application set up the message that way.
+ * The flags and the timestamp are only written to the queued copy.
+ */
+static void CopyMessageForQueue(tMessage* pQueuedMsg,
+                                tMessage* pMsg,
+                                unsigned char Flags)
+{
+  unsigned char i;
+  
+  pQueuedMsg->Length = pMsg->Length;
+  pQueuedMsg->Type = pMsg->Type;
+  pQueuedMsg->Options = pMsg->Options;
+  pQueuedMsg->Flags = Flags;
+  pQueuedMsg->pBuffer = pMsg->pBuffer;
+  
+  if ( pMsg->pBuffer == MSG_INLINE_PAYLOAD )
+  {
+    for ( i = 0; i < MSG_INLINE_PAYLOAD_LENGTH; i++ )
+    {
+      pQueuedMsg->InlinePayload[i] = pMsg->InlinePayload[i];
+    }
+  }
+  
+  pQueuedMsg->Timestamp = ReadCrystalTimerCount();
+  
+}
+
 /* if the queue is full, don't wait */
-static void SendMsgToQ(unsigned char Qindex, tMessage* pMsg)
+static void SendMsgToQ(unsigned char Qindex,
+                       tMessage* pMsg,
+                       unsigned char Flags)
 {
+  tMessage QueuedMsg;
+  CopyMessageForQueue(&QueuedMsg, pMsg, Flags);
+  
+  /* the copy is freed because the flags are not in the caller's message */
   if ( Qindex == FREE_QINDEX )
   {
-    SendToFreeQueue(pMsg);  
+    FreeQueuedMessage(&QueuedMsg);  
+    return;
+  }
+  
+  /* the allocation has already reported that the pool is empty */
+  if (   Qindex == SPP_TASK_QINDEX 
+      && QueuedMsg.pBuffer == MSG_INLINE_PAYLOAD
+      && !MoveInlinePayloadToBuffer(&QueuedMsg, BPL_AllocMessageBuffer()) )
+  {
+    CountEnqueue(Qindex, pMsg, 0);
+    FreeQueuedMessage(&QueuedMsg);
+    return;
   }
-  else if ( errQUEUE_FULL ==  xQueueSend(QueueHandles[Qindex],pMsg,DONT_WAIT) )
+  
+  if ( errQUEUE_FULL ==  xQueueSend(GetDestinationQueue(Qindex, pMsg),
+                                     &QueuedMsg,
+                                     DONT_WAIT) )
   {
+    CountEnqueue(Qindex, pMsg, 0);
     PrintQueueNameIsFull(Qindex);
-    SendToFreeQueue(pMsg);
+    FreeQueuedMessage(&QueuedMsg);
+  }
+  else
+  {
+    if ( Qindex == DISPLAY_QINDEX )
+    {
+      xSemaphoreGive(DisplayDoorbell);
+    }
+    
+    CountEnqueue(Qindex, pMsg, 1);
   }
   
 }
@@ -133,24 +314,49 @@ static void SendMessageToQueueWait(unsigned char Qindex, tMessage* pMsg)
 #endif
 
 /* send a message to a specific queue from an isr 
- * routing requires 25 us
  * putting a message into a queue (in interrupt context) requires 28 us
- * this requires 1/2 the time of using route
+ * (a buffer allocation does not use a queue)
  */
-void SendMessageToQueueFromIsr(unsigned char Qindex, tMessage* pMsg)
+unsigned char SendMessageToQueueFromIsr(unsigned char Qindex, tMessage* pMsg)
 {
   signed portBASE_TYPE HigherPriorityTaskWoken;
+  unsigned char Result = 1;
   
   if ( Qindex == FREE_QINDEX )
   {
     SendToFreeQueueIsr(pMsg);  
+    return 0;
   }
-  else if ( errQUEUE_FULL == xQueueSendFromISR(QueueHandles[Qindex],
-                                               pMsg,
-                                               &HigherPriorityTaskWoken))
+  
+  tMessage QueuedMsg;
+  CopyMessageForQueue(&QueuedMsg, pMsg, 0);
+  
+  if (   Qindex == SPP_TASK_QINDEX 
+      && QueuedMsg.pBuffer == MSG_INLINE_PAYLOAD
+      && !MoveInlinePayloadToBuffer(&QueuedMsg, 
+                                    BPL_AllocMessageBufferFromIsr()) )
   {
+    CountEnqueue(Qindex, pMsg, 0);
+    return 0;
+  }
+  
+  if ( errQUEUE_FULL == xQueueSendFromISR(GetDestinationQueue(Qindex, pMsg),
+                                          &QueuedMsg,
+                                          &HigherPriorityTaskWoken))
+  {
+    CountEnqueue(Qindex, pMsg, 0);
     PrintQueueNameIsFull(Qindex);
-    SendToFreeQueueIsr(pMsg);
+    SendToFreeQueueIsr(&QueuedMsg);
+    Result = 0;
+  }
+  else
+  {
+    if ( Qindex == DISPLAY_QINDEX )
+    {
+      xSemaphoreGiveFromISR(DisplayDoorbell, &HigherPriorityTaskWoken);
+    }
+    
+    CountEnqueue(Qindex, pMsg, 1);
   }
   
   
@@ -167,133 +373,427 @@ void SendMessageToQueueFromIsr(unsigned char Qindex, tMessage* pMsg)
   }
 #endif
   
+  return Result;
+  
 }
 
-static unsigned char LastMessageType = 0;
-static unsigned char AddNewline = 0;
+#if TOTAL_QUEUES > ( ROUTE_QINDEX_MASK + 1 )
+  #error "Routing table entries cannot hold all of the queue indices"
+#endif
 
-void PrintMessageType(tMessage* pMsg)
+/* Message types that are not in the list are zero (free queue, no print) */
+#define MESSAGE_TYPE_ROUTE(Name, Value, Queue, Flags) \
+  [Value] = ( Queue##_QINDEX | (Flags) ),
+
+static const unsigned char RouteTable[MaxMessageType + 1] =
 {
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_ROUTE)
+};
 
-  unsigned char MessageType = pMsg->Type;
+static xQueueHandle GetDestinationQueue(unsigned char Qindex, tMessage* pMsg)
+{
+  if (   Qindex == DISPLAY_QINDEX
+      && (RouteTable[pMsg->Type] & ROUTE_URGENT) )
+  {
+    return DisplayHighLane;
+  }
+  
+  return QueueHandles[Qindex];
+}
+
+void CreateDisplayQueue(unsigned char LowLength, unsigned char HighLength)
+{
+  QueueHandles[DISPLAY_QINDEX] = 
+    xQueueCreate( LowLength, MESSAGE_QUEUE_ITEM_SIZE );
+  
+  DisplayLowLaneLength = LowLength;
+  
+  DisplayHighLane = xQueueCreate( HighLength, MESSAGE_QUEUE_ITEM_SIZE );
   
-  /* if the message is the same as the last then print an asterix */
-  if ( MessageType == IdleUpdate) //LastMessageType )
+  /* a queue of one zero length item is a binary semaphore (that starts out
+   * empty) 
+   */
+  DisplayDoorbell = xQueueCreate( 1, 0 );
+  
+}
+
+unsigned char ReceiveDisplayMessage(tMessage* pMsg, portTickType TicksToWait)
+{
+  for(;;)
   {
-    PrintString("*");
-    AddNewline = 1;
-    return;
+    if ( xQueueReceive(DisplayHighLane, pMsg, DONT_WAIT) == pdTRUE )
+    {
+      CountDequeue(DISPLAY_QINDEX, pMsg);
+      return DISPLAY_HIGH_LANE;
+    }
+    
+    if ( pdTRUE == xQueueReceive(QueueHandles[DISPLAY_QINDEX], 
+                                 pMsg, 
+                                 DONT_WAIT) )
+    {
+      CountDequeue(DISPLAY_QINDEX, pMsg);
+      return DISPLAY_LOW_LANE;
+    }
+    
+    /* both lanes are empty; a message sent after they were looked at gives 
+     * the doorbell after it is in its lane 
+     */
+    if ( xSemaphoreTake(DisplayDoorbell, TicksToWait) != pdTRUE )
+    {
+      return DISPLAY_NO_MESSAGE;
+    }
+  }
+}
+
+static xQueueHandle GetDisplayLane(unsigned char Lane)
+{
+  return ( Lane == DISPLAY_HIGH_LANE ) ? 
+    DisplayHighLane : QueueHandles[DISPLAY_QINDEX];
+}
+
+unsigned char PeekDisplayMessage(unsigned char Lane, tMessage* pMsg)
+{
+  return ( xQueuePeek(GetDisplayLane(Lane), pMsg, DONT_WAIT) == pdTRUE );
+}
+
+void RemoveDisplayMessage(unsigned char Lane, tMessage* pMsg)
+{
+  if ( xQueueReceive(GetDisplayLane(Lane), pMsg, DONT_WAIT) == pdTRUE )
+  {
+    CountDequeue(DISPLAY_QINDEX, pMsg);
+  }
+}
+
+unsigned char ReceiveMessage(unsigned char Qindex,
+                             tMessage* pMsg,
+                             portTickType TicksToWait)
+{
+  if ( pdTRUE != xQueueReceive(QueueHandles[Qindex], pMsg, TicksToWait) )
+  {
+    return 0;
+  }
+  
+  CountDequeue(Qindex, pMsg);
+  return 1;
+  
+}
+
+/* called when a message is put into a queue or dropped because the queue 
+ * is full.  This is also called from interrupts.
+ */
+static void CountEnqueue(unsigned char Qindex,
+                         tMessage* pMsg,
+                         unsigned char Queued)
+{
+  tQueueTelemetry* pQueue = &QueueTelemetry[Qindex];
+  tMessageTypeTelemetry* pType = &TypeTelemetry[TypeSlot[pMsg->Type]];
+  
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  if ( Queued )
+  {
+    unsigned char Depth = QueueHandles[Qindex]->uxMessagesWaiting;
+    
+    if ( Qindex == DISPLAY_QINDEX )
+    {
+      Depth += DisplayHighLane->uxMessagesWaiting;
+    }
+    
+    if ( Depth > pQueue->MaxDepth )
+    {
+      pQueue->MaxDepth = Depth;
+    }
+    
+    pQueue->Enqueued++;
+    pType->Enqueued++;
   }
   else
   {
-    if ( AddNewline )
+    pQueue->Dropped++;
+    pType->Dropped++;
+  }
+  
+  __set_interrupt_state(IntState);
+  
+}
+
+/* called by the task that owns the queue when it takes a message out */
+static void CountDequeue(unsigned char Qindex, tMessage* pMsg)
+{
+  unsigned int Latency = ReadCrystalTimerCount() - pMsg->Timestamp;
+  tMessageTypeTelemetry* pType = &TypeTelemetry[TypeSlot[pMsg->Type]];
+  
+  /* bin n holds 2^(n-1) to 2^n - 1 ticks */
+  unsigned char Bin = 0;
+  unsigned int Range = Latency;
+  
+  while ( Range != 0 && Bin < QUEUE_LATENCY_BINS - 1 )
+  {
+    Range >>= 1;
+    Bin++;
+  }
+  
+  QueueTelemetry[Qindex].Latency[Bin]++;
+  
+  if ( Latency > pType->MaxLatency )
+  {
+    pType->MaxLatency = Latency;
+  }
+  
+}
+
+/* Messages from the phone are routed by the stack library with RouteMsg 
+ * (the application uses RouteWatchMsg for the flow controlled types).  A 
+ * flow controlled message from the phone uses a credit when flow control is
+ * enabled.  Messages that were queued before flow control was enabled are 
+ * already left out of the first window.
+ */
+static unsigned char GetFlowControlFlags(tMessage* pMsg)
+{
+  if (   FlowControlEnabled 
+      && (RouteTable[pMsg->Type] & ROUTE_CREDIT) )
+  {
+    return MSG_CREDIT;
+  }
+  
+  return 0;
+}
+
+/* A message uses its credit until it is freed (this includes messages that 
+ * were dropped).  This is only called for the application's queued copy of
+ * a message; the stack library frees its own tMessage, where the flags are 
+ * padding, with SendToFreeQueue.
+ */
+static void ReturnFlowControlCredit(tMessage* pMsg)
+{
+  if (   FlowControlEnabled 
+      && (pMsg->Flags & MSG_CREDIT) 
+      && (RouteTable[pMsg->Type] & ROUTE_CREDIT) )
+  {
+    unsigned short IntState = __get_interrupt_state();
+    __disable_interrupt();
+    
+    /* a message from before flow control was last enabled is not counted */
+    if ( FlowControlOutstanding > 0 )
     {
-      //PrintString("\r\n");   
+      FlowControlOutstanding--;
+      FlowControlReturned++;
     }
+    
+    __set_interrupt_state(IntState);
+  }
+}
+
+static void SendCreditMsg(unsigned char Credits)
+{
+  tMessage OutgoingMsg;
+  tBufferPoolStatistics Stats;
+  
+  BPL_GetStatistics(&Stats);
   
-    AddNewline = 0;
-  }
-  LastMessageType = MessageType;
-  
-  
-
-  /*
-   * this does not follow 80 character width rule because it is easier to
-   * maintain this way 
-  */
-  switch (MessageType)
-  {
-  case InvalidMessage:             PrintStringAndHexByte("InvalidMessage 0x",MessageType);         break;
-  case GetDeviceType:              PrintStringAndHexByte("GetDeviceType 0x",MessageType);          break;
-  case GetDeviceTypeResponse:      PrintStringAndHexByte("GetDeviceTypeResponse 0x",MessageType);  break;
-  case GetInfoString:              PrintStringAndHexByte("GetInfoString 0x",MessageType);          break;
-  case GetInfoStringResponse:      PrintStringAndHexByte("GetInfoStringResponse 0x",MessageType);  break;
-  case DiagnosticLoopback:         PrintStringAndHexByte("DiagnosticLoopback 0x",MessageType);     break;
-  case EnterShippingModeMsg:       PrintStringAndHexByte("EnterShippingModeMsg 0x",MessageType);   break;
-  case SoftwareResetMsg:           PrintStringAndHexByte("SoftwareResetMsg 0x",MessageType);       break;
-  case ConnectionTimeoutMsg:       PrintStringAndHexByte("ConnectionTimeoutMsg 0x",MessageType);   break;
-  case TurnRadioOnMsg:             PrintStringAndHexByte("TurnRadioOnMsg 0x",MessageType);         break;
-  case TurnRadioOffMsg:            PrintStringAndHexByte("TurnRadioOffMsg 0x",MessageType);        break;
-  case ReadRssiMsg:                PrintStringAndHexByte("ReadRssiMsg 0x",MessageType);               break;
-  case PairingControlMsg:          PrintStringAndHexByte("PairingControlMsg 0x",MessageType);         break;
-  case ReadRssiResponseMsg:        PrintStringAndHexByte("ReadRssiResponseMsg 0x",MessageType);       break;
-  case SniffControlMsg:            PrintStringAndHexByte("SniffControlMsg 0x",MessageType);           break;
-  case LinkAlarmMsg:               PrintStringAndHexByte("LinkAlarmMsg 0x",MessageType);              break;
-  case OledWriteBufferMsg:         PrintStringAndHexByte("OledWriteBufferMsg 0x",MessageType);        break;
-  case OledConfigureModeMsg:       PrintStringAndHexByte("OledConfigureModeMsg 0x",MessageType);      break;
-  case OledChangeModeMsg:          PrintStringAndHexByte("OledChangeModeMsg 0x",MessageType);         break;
-  case OledWriteScrollBufferMsg:   PrintStringAndHexByte("OledWriteScrollBufferMsg 0x",MessageType);  break;
-  case OledScrollMsg:              PrintStringAndHexByte("OledScrollMsg 0x",MessageType);          break;
-  case OledShowIdleBufferMsg:      PrintStringAndHexByte("OledShowIdleBufferMsg 0x",MessageType);  break;
-  case OledCrownMenuMsg:           PrintStringAndHexByte("OledCrownMenuMsg 0x",MessageType);       break;
-  case OledCrownMenuButtonMsg:     PrintStringAndHexByte("OledCrownMenuButtonMsg 0x",MessageType); break;
-  case AdvanceWatchHandsMsg:       PrintStringAndHexByte("AdvanceWatchHandsMsg 0x",MessageType);   break;
-  case SetVibrateMode:             PrintStringAndHexByte("SetVibrateMode 0x",MessageType);         break;
-  case ButtonStateMsg:             /*PrintStringAndHexByte("ButtonStateMsg 0x",MessageType);*/         break;
-  case SetRealTimeClock:           PrintStringAndHexByte("SetRealTimeClock 0x",MessageType);       break;
-  case GetRealTimeClock:           PrintStringAndHexByte("GetRealTimeClock 0x",MessageType);       break;
-  case GetRealTimeClockResponse:   PrintStringAndHexByte("GetRealTimeClockResponse 0x",MessageType);break;
-  case StatusChangeEvent:          PrintStringAndHexByte("StatusChangeEvent 0x",MessageType);       break;
-  case NvalOperationMsg:           PrintStringAndHexByte("NvalOperationMsg 0x",MessageType);        break;
-  case NvalOperationResponseMsg:   PrintStringAndHexByte("NvalOperationResponseMsg 0x",MessageType); break;
-  case GeneralPurposePhoneMsg:     PrintStringAndHexByte("GeneralPurposePhoneMsg 0x",MessageType); break;
-  case GeneralPurposeWatchMsg:     PrintStringAndHexByte("GeneralPurposeWatchMsg 0x",MessageType); break;
-  case ButtonEventMsg:             PrintStringAndHexByte("ButtonEventMsg 0x",MessageType);         break;
-  case WriteBuffer:                /*PrintStringAndHexByte("WriteBuffer 0x",MessageType);*/            break;
-  case ConfigureDisplay:           PrintStringAndHexByte("ConfigureDisplay 0x",MessageType);       break;
-  case ConfigureIdleBufferSize:    PrintStringAndHexByte("ConfigureIdleBufferSize 0x",MessageType);break;
-  case UpdateDisplay:              PrintStringAndHexByte("UpdateDisplay 0x",MessageType);          break;
-  case LoadTemplate:               PrintStringAndHexByte("LoadTemplate 0x",MessageType);           break;
-  case EnableButtonMsg:            PrintStringAndHexByte("EnableButtonMsg 0x",MessageType);        break;
-  case DisableButtonMsg:           PrintStringAndHexByte("DisableButtonMsg 0x",MessageType);       break;
-  case ReadButtonConfigMsg:        PrintStringAndHexByte("ReadButtonConfigMsg 0x",MessageType);    break;
-  case ReadButtonConfigResponse:   PrintStringAndHexByte("ReadButtonConfigResponse 0x",MessageType);break;
-  case BatteryChargeControl:       /*PrintStringAndHexByte("BatteryChargeControl 0x",MessageType);*/   break;
-  case IdleUpdate:                 PrintStringAndHexByte("IdleUpdate 0x",MessageType);             break;
-  case WatchDrawnScreenTimeout:    PrintStringAndHexByte("WatchDrawnScreenTimeout 0x",MessageType);break;
-  case SplashTimeoutMsg:           PrintStringAndHexByte("SplashTimeoutMsg 0x",MessageType);       break;
-  case ChangeModeMsg:              /*PrintStringAndHexByte("ChangeModeMsg 0x",MessageType);*/          break;
-  case ModeTimeoutMsg:             PrintStringAndHexByte("ModeTimeoutMsg 0x",MessageType);         break;
-  case WatchStatusMsg:             PrintStringAndHexByte("WatchStatusMsg 0x",MessageType);         break;
-  case MenuModeMsg:                PrintStringAndHexByte("MenuModeMsg 0x",MessageType);            break;
-  case BarCode:                    PrintStringAndHexByte("BarCode 0x",MessageType);                break;
-  case ListPairedDevicesMsg:       PrintStringAndHexByte("ListPairedDevicesMsg 0x",MessageType);   break;
-  case ConnectionStateChangeMsg:   PrintStringAndHexByte("ConnectionStateChangeMsg 0x",MessageType);  break;
-  case ModifyTimeMsg:              PrintStringAndHexByte("ModifyTimeMsg 0x",MessageType);          break;
-  case MenuButtonMsg:              PrintStringAndHexByte("MenuButtonMsg 0x",MessageType);          break;
-  case ToggleSecondsMsg:           PrintStringAndHexByte("ToggleSecondsMsg 0x",MessageType);       break;
-  case LedChange:                  PrintStringAndHexByte("LedChange 0x",MessageType);              break;
-  case AccelerometerHostMsg:       PrintStringAndHexByte("AccelerometerHostMsg 0x",MessageType);       break;           
-  //case AccelerometerHostMsg:       PrintString("-");       break;           
-  case AccelerometerEnableMsg:     PrintStringAndHexByte("AccelerometerEnableMsg 0x",MessageType);     break;           
-  case AccelerometerDisableMsg:    PrintStringAndHexByte("AccelerometerDisableMsg 0x",MessageType);    break;           
-  case AccelerometerSendDataMsg:   PrintStringAndHexByte("AccelerometerSendDataMsg 0x",MessageType);   break;           
-  //case AccelerometerSendDataMsg:   PrintString("_");   break;           
-  case AccelerometerAccessMsg:     PrintStringAndHexByte("AccelerometerAccessMsg 0x",MessageType);     break;           
-  case AccelerometerResponseMsg:   PrintStringAndHexByte("AccelerometerResponseMsg 0x",MessageType);   break;           
-  case AccelerometerSetupMsg:      PrintStringAndHexByte("AccelerometerSetupMsg 0x",MessageType);      break;
-  case QueryMemoryMsg:             PrintStringAndHexByte("QueryMemoryMsg 0x",MessageType);             break;
-  case RamTestMsg:                 PrintStringAndHexByte("RamTestMsg 0x",MessageType);                 break;
-  case RateTestMsg:                PrintStringAndHexByte("RateTestMsg 0x",MessageType);                break;
-  case BatteryConfigMsg:           PrintStringAndHexByte("BatteryConfigMsg 0x",MessageType);           break;
-  case LowBatteryWarningMsgHost:   PrintStringAndHexByte("LowBatteryWarningMsgHost 0x",MessageType);   break; 
-  case LowBatteryBtOffMsgHost:     PrintStringAndHexByte("LowBatteryBtOffMsgHost 0x",MessageType);     break; 
-  case ReadBatteryVoltageMsg:      PrintStringAndHexByte("ReadBatteryVoltageMsg 0x",MessageType);      break;
-  case ReadBatteryVoltageResponse: PrintStringAndHexByte("ReadBatteryVoltageResponse 0x",MessageType); break;
-  case ReadLightSensorMsg:         PrintStringAndHexByte("ReadLightSensorMsg 0x",MessageType);         break;
-  case ReadLightSensorResponse:    PrintStringAndHexByte("ReadLightSensorResponse 0x",MessageType);    break;
-  case LowBatteryWarningMsg:       PrintStringAndHexByte("LowBatteryWarningMsg 0x",MessageType);       break; 
-  case LowBatteryBtOffMsg:         PrintStringAndHexByte("LowBatteryBtOffMsg 0x",MessageType);         break; 
-  case RadioPowerControlMsg:       PrintStringAndHexByte("RadioPowerControlMsg 0x",MessageType);       break;
-  case AdvertisingDataMsg:         PrintStringAndHexByte("AdvertisingDataMsg 0x",MessageType);         break;
-  case CallbackTimeoutMsg:         /*PrintStringAndHexByte("CallbackTimeoutMsg 0x",MessageType);*/         break;
-  case SetCallbackTimerMsg:        /*PrintStringAndHexByte("SetCallbackTimerMsg 0x",MessageType);*/        break;
-  case UpdateConnParameterMsg:     PrintStringAndHexByte("UpdateConnParameterMsg 0x",MessageType);     break;
-  default:                         PrintStringAndHexByte("Unknown Message Type 0x",MessageType);       break;
-  }  
+  SetupMessageWithInlinePayload(&OutgoingMsg,
+                                FlowControlCreditMsg,
+                                NO_MSG_OPTIONS);
+  
+  OutgoingMsg.InlinePayload[0] = Credits;
+  OutgoingMsg.InlinePayload[1] = 
+    DisplayLowLaneLength - QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting;
+  OutgoingMsg.InlinePayload[2] = Stats.Count - Stats.InUse;
+  OutgoingMsg.Length = 3;
+  RouteMsg(&OutgoingMsg);
+}
+
+void FlowControlHandler(tMessage* pMsg)
+{
+  tBufferPoolStatistics Stats;
+  signed int QueueWindow;
+  signed int BufferWindow;
+  signed int Window;
+  
+  FlowControlEnabled = 0;
+  FlowControlOutstanding = 0;
+  FlowControlReturned = 0;
+  
+  if ( pMsg->Options != FLOW_CONTROL_ENABLE_OPTION )
+  {
+    return;
+  }
+  
+  BPL_GetStatistics(&Stats);
+  
+  QueueWindow = (signed int)DisplayLowLaneLength 
+    - QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting 
+    - FLOW_CONTROL_QUEUE_RESERVE;
+  
+  BufferWindow = (signed int)Stats.Count - Stats.InUse 
+    - FLOW_CONTROL_BUFFER_RESERVE;
+  
+  Window = ( QueueWindow < BufferWindow ) ? QueueWindow : BufferWindow;
+  
+  /* the host always has to be able to send something */
+  if ( Window < 1 )
+  {
+    Window = 1;
+  }
+  
+  FlowControlOutstanding = Window;
+  FlowControlEnabled = 1;
+  
+  SendCreditMsg(Window);
+  
+}
+
+void SendFlowControlCredits(void)
+{
+  unsigned char Credits = 0;
+  
+  portENTER_CRITICAL();
+  
+  if (   FlowControlReturned >= FLOW_CONTROL_CREDIT_BATCH 
+      || (FlowControlReturned > 0 && FlowControlOutstanding == 0) )
+  {
+    Credits = FlowControlReturned;
+    FlowControlOutstanding += Credits;
+    FlowControlReturned = 0;
+  }
+  
+  portEXIT_CRITICAL();
+  
+  if ( Credits )
+  {
+    SendCreditMsg(Credits);
+  }
+  
+}
+
+static unsigned char* PutTelemetryWord(unsigned char* pData, unsigned int Value)
+{
+  *pData++ = (unsigned char)Value;
+  *pData++ = (unsigned char)(Value >> 8);
+  return pData;
+}
+
+static void ClearTelemetry(unsigned char* pData, unsigned int Size)
+{
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  while ( Size-- )
+  {
+    *pData++ = 0;
+  }
+  
+  __set_interrupt_state(IntState);
+}
+
+/* each record is type, enqueued, dropped and max latency */
+#define TYPE_TELEMETRY_RECORD_LENGTH ( 7 )
+
+void QueueTelemetryHandler(tMessage* pMsg)
+{
+  tMessage OutgoingMsg;
+  unsigned char Select = pMsg->Options & QUEUE_TELEMETRY_SELECT_MASK;
+  unsigned char i;
+  
+  SetupMessageAndAllocateBuffer(&OutgoingMsg,
+                                QueueTelemetryResponse,
+                                pMsg->Options);
+  
+  unsigned char* pData = OutgoingMsg.pBuffer;
+  
+  if ( Select == QUEUE_TELEMETRY_TYPES_OPTION )
+  {
+    unsigned char FirstType = 0;
+    
+    if ( pMsg->pBuffer != NULL && pMsg->Length > 0 )
+    {
+      FirstType = GetMessagePayload(pMsg)[0];
+    }
+    
+    /* the first byte is filled in with the next type to ask for */
+    pData[0] = 0;
+    pData++;
+    
+    for ( i = 0; i < MessageTypeSlots; i++ )
+    {
+      tMessageTypeTelemetry* pType = &TypeTelemetry[i];
+      
+      if (   SlotType[i] < FirstType 
+          || (pType->Enqueued == 0 && pType->Dropped == 0) )
+      {
+        continue;
+      }
+      
+      if (   pData + TYPE_TELEMETRY_RECORD_LENGTH 
+           > OutgoingMsg.pBuffer + HOST_MSG_MAX_PAYLOAD_LENGTH )
+      {
+        OutgoingMsg.pBuffer[0] = SlotType[i];
+        break;
+      }
+      
+      *pData++ = SlotType[i];
+      pData = PutTelemetryWord(pData, pType->Enqueued);
+      pData = PutTelemetryWord(pData, pType->Dropped);
+      pData = PutTelemetryWord(pData, pType->MaxLatency);
+    }
+  }
+  else if ( Select > FREE_QINDEX && Select < TOTAL_QUEUES )
+  {
+    tQueueTelemetry* pQueue = &QueueTelemetry[Select];
+    
+    pData = PutTelemetryWord(pData, pQueue->Enqueued);
+    pData = PutTelemetryWord(pData, pQueue->Dropped);
+    *pData++ = pQueue->MaxDepth;
+    
+    for ( i = 0; i < QUEUE_LATENCY_BINS; i++ )
+    {
+      pData = PutTelemetryWord(pData, pQueue->Latency[i]);
+    }
+  }
+  
+  OutgoingMsg.Length = pData - OutgoingMsg.pBuffer;
+  
+  if ( pMsg->Options & QUEUE_TELEMETRY_CLEAR_OPTION )
+  {
+    ClearTelemetry((unsigned char*)QueueTelemetry, sizeof(QueueTelemetry));
+    ClearTelemetry((unsigned char*)TypeTelemetry, sizeof(TypeTelemetry));
+  }
+  
+  RouteMsg(&OutgoingMsg);
+  
+}
+
+/* this is called for every message so it only writes a trace record (the 
+ * name of the type is in Messages.h) 
+ */
+void PrintMessageType(tMessage* pMsg)
+{
+  unsigned char MessageType = pMsg->Type;
+  
+  /* unlisted types share the slot of InvalidMessage */
+  if ( TypeSlot[MessageType] == InvalidMessageSlot 
+      && MessageType != InvalidMessage )
+  {
+    TraceEvent(TRACE_UNKNOWN_MESSAGE, MessageType, 0);
+  }
+  else if ( RouteTable[MessageType] & ROUTE_PRINT )
+  {
+    TraceEvent(TRACE_MESSAGE, MessageType, pMsg->Options);
+  }
 }
 
 void RouteMsg(tMessage* pMsg)
+{
+  RouteMsgWithFlags(pMsg, GetFlowControlFlags(pMsg));
+}
+
+void RouteWatchMsg(tMessage* pMsg)
+{
+  RouteMsgWithFlags(pMsg, 0);
+}
+
+static void RouteMsgWithFlags(tMessage* pMsg, unsigned char Flags)
 {
 #ifdef MESSAGE_QUEUE_DEBUG
   AllQueuesReadyCheck();
@@ -310,94 +810,16 @@ void RouteMsg(tMessage* pMsg)
   else
 #endif
   {
-    switch (pMsg->Type)
+    unsigned char Route = RouteTable[pMsg->Type];
+    
+    /* a handler that reads the payload would use a null pointer */
+    if ( (Route & ROUTE_BUFFER) && pMsg->pBuffer == NULL )
     {
-    case InvalidMessage:                SendMsgToQ(FREE_QINDEX,pMsg);       break;
-    case GetDeviceType:                 SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case GetDeviceTypeResponse:         SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case GetInfoString:                 SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case GetInfoStringResponse:         SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case DiagnosticLoopback:            SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case EnterShippingModeMsg:          SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case SoftwareResetMsg:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ConnectionTimeoutMsg:          SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case TurnRadioOnMsg:                SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case TurnRadioOffMsg:               SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case ReadRssiMsg:                   SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case PairingControlMsg:             SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case ReadRssiResponseMsg:           SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case SniffControlMsg:               SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case LinkAlarmMsg:                  SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledWriteBufferMsg:            SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledConfigureModeMsg:          SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledChangeModeMsg:             SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledWriteScrollBufferMsg:      SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledScrollMsg:                 SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledShowIdleBufferMsg:         SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledCrownMenuMsg:              SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case OledCrownMenuButtonMsg:        SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case AdvanceWatchHandsMsg:          SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case SetVibrateMode:                SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ButtonStateMsg:                SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case SetRealTimeClock:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case GetRealTimeClock:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case GetRealTimeClockResponse:      SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case StatusChangeEvent:             SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case NvalOperationMsg:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case NvalOperationResponseMsg:      SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case GeneralPurposePhoneMsg:        SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case GeneralPurposeWatchMsg:        SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ButtonEventMsg:                SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case WriteBuffer:                   SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ConfigureDisplay:              SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ConfigureIdleBufferSize:       SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case UpdateDisplay:                 SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case LoadTemplate:                  SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case EnableButtonMsg:               SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case DisableButtonMsg:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ReadButtonConfigMsg:           SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ReadButtonConfigResponse:      SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case BatteryChargeControl:          SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case IdleUpdate:                    SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case WatchDrawnScreenTimeout:       SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case SplashTimeoutMsg:              SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ChangeModeMsg:                 SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ModeTimeoutMsg:                SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case WatchStatusMsg:                SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case MenuModeMsg:                   SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case BarCode:                       SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ListPairedDevicesMsg:          SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ConnectionStateChangeMsg:      SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ModifyTimeMsg:                 SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case MenuButtonMsg:                 SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case ToggleSecondsMsg:              SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case LedChange:                     SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case AccelerometerHostMsg:          SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case AccelerometerEnableMsg:        SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case AccelerometerDisableMsg:       SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;       
-    case AccelerometerSendDataMsg:      SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;        
-    case AccelerometerAccessMsg:        SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;        
-    case AccelerometerResponseMsg:      SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;        
-    case AccelerometerSetupMsg:         SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case QueryMemoryMsg:                SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case RamTestMsg:                    SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case RateTestMsg:                   SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case BatteryConfigMsg:              SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case LowBatteryWarningMsgHost:      SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case LowBatteryBtOffMsgHost:        SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case ReadBatteryVoltageMsg:         SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ReadBatteryVoltageResponse:    SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case ReadLightSensorMsg:            SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case ReadLightSensorResponse:       SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case LowBatteryWarningMsg:          SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case LowBatteryBtOffMsg:            SendMsgToQ(DISPLAY_QINDEX,pMsg);    break;
-    case AdvertisingDataMsg:            SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case CallbackTimeoutMsg:            SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case SetCallbackTimerMsg:           SendMsgToQ(BACKGROUND_QINDEX,pMsg); break;
-    case RadioPowerControlMsg:          SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    case UpdateConnParameterMsg:        SendMsgToQ(SPP_TASK_QINDEX,pMsg);   break;
-    default:                            SendMsgToQ(FREE_QINDEX,pMsg);       break;
+      PrintStringAndHexByte("Message without buffer 0x",pMsg->Type);
+      Route = FREE_QINDEX;
     }
+    
+    SendMsgToQ(Route & ROUTE_QINDEX_MASK, pMsg, Flags);
   }
 }
 
@@ -414,9 +836,33 @@ void SetupMessage(tMessage* pMsg,
   pMsg->Length = 0;
   pMsg->Type = Type;
   pMsg->Options = Options;
+  pMsg->Flags = 0;
   pMsg->pBuffer = NULL;  
 }
 
+void SetupMessageWithInlinePayload(tMessage* pMsg,
+                                   unsigned char Type,
+                                   unsigned char Options)
+{
+  pMsg->Length = 0;
+  pMsg->Type = Type;
+  pMsg->Options = Options;
+  pMsg->Flags = 0;
+  pMsg->pBuffer = MSG_INLINE_PAYLOAD;
+  
+}
+
+unsigned char* GetMessagePayload(tMessage* pMsg)
+{
+  if ( pMsg->pBuffer == MSG_INLINE_PAYLOAD )
+  {
+    return pMsg->InlinePayload;
+  }
+  
+  return pMsg->pBuffer;
+  
+}
+
 void SetupMessageAndAllocateBuffer(tMessage* pMsg,
                                    unsigned char Type,
                                    unsigned char Options)
@@ -424,10 +870,23 @@ void SetupMessageAndAllocateBuffer(tMessage* pMsg,
   pMsg->Length = 0;
   pMsg->Type = Type;
   pMsg->Options = Options;
+  pMsg->Flags = 0;
   pMsg->pBuffer = BPL_AllocMessageBuffer();
 
 }
 
+void SetupMessageAndAllocateBufferFromIsr(tMessage* pMsg,
+                                          unsigned char Type,
+                                          unsigned char Options)
+{
+  pMsg->Length = 0;
+  pMsg->Type = Type;
+  pMsg->Options = Options;
+  pMsg->Flags = 0;
+  pMsg->pBuffer = BPL_AllocMessageBufferFromIsr();
+
+}
+
 /* \return 1 when all task queues are empty and the part can go into sleep 
  * mode 
  */
@@ -440,6 +899,7 @@ unsigned char AllTaskQueuesEmpty(void)
       //&& 
   if (   QueueHandles[BACKGROUND_QINDEX]->uxMessagesWaiting == 0 
       && QueueHandles[DISPLAY_QINDEX]->uxMessagesWaiting == 0 
+      && DisplayHighLane->uxMessagesWaiting == 0 
       && QueueHandles[SPP_TASK_QINDEX]->uxMessagesWaiting == 0 )
   {  
     result = 1; 
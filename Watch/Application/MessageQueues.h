@@ -31,6 +31,12 @@
   #error "queue.h must be included before MessageQueues.h"
 #endif
 
+/*! Queue items are a whole tMessage (14 bytes, the stack library's message is
+ * 6 bytes).  The background queue (8) and both display lanes (8 + 4) hold
+ * 280 bytes of items in the 6000 byte FreeRTOS heap (configTOTAL_HEAP_SIZE).
+ * That is 160 bytes more than 6 byte items.  The spp task queue is created by
+ * the stack library with its own item size.
+ */
 #define MESSAGE_QUEUE_ITEM_SIZE ( ( unsigned int ) sizeof( tMessage ) )
 
 #define FREE_QINDEX        ( 0 )
@@ -39,11 +45,108 @@
 #define SPP_TASK_QINDEX    ( 3 )
 #define TOTAL_QUEUES       ( 4 )
 
+/*! Routing table entry format
+ *
+ * The routing table is generated from MESSAGE_TYPE_LIST in Messages.h and
+ * holds one byte per message type.
+ *
+ * \param ROUTE_QINDEX_MASK selects the destination queue index
+ * \param ROUTE_PRINT is set when the message type is printed by
+ * PrintMessageType
+ * \param ROUTE_BUFFER is set when the handler of the message reads the
+ * payload (a message without a buffer is not routed)
+ * \param ROUTE_URGENT puts a display message into the high priority lane
+ * \param ROUTE_CREDIT is set for the message types the host sends in bulk to
+ * the display (they use a flow control credit when the stack library routes
+ * them with RouteMsg; the watch routes its own with RouteWatchMsg)
+ */
+#define ROUTE_QINDEX_MASK  ( 0x03 )
+#define ROUTE_PRINT        ( BIT2 )
+#define ROUTE_BUFFER       ( BIT3 )
+#define ROUTE_URGENT       ( BIT4 )
+#define ROUTE_CREDIT       ( BIT5 )
+
+/*! The display queue has two lanes.  QueueHandles[DISPLAY_QINDEX] is the low
+ * priority lane.  It holds bulk buffer writes and the messages that have to 
+ * stay in order with them.  Interactive and time critical messages 
+ * (ROUTE_URGENT) use the high priority lane.  The display task always 
+ * drains the high priority lane first.
+ */
+#define DISPLAY_LOW_LANE   ( 0 )
+#define DISPLAY_HIGH_LANE  ( 1 )
+#define DISPLAY_NO_MESSAGE ( 0xFF )
+
 
 /*! Array of all of the queue handles */
 extern xQueueHandle QueueHandles[TOTAL_QUEUES];
 
 
+/*! Create both lanes of the display queue.  This is called by the display 
+ * task.
+ *
+ * \param LowLength is the length of the low priority lane
+ * \param HighLength is the length of the high priority lane
+ */
+void CreateDisplayQueue(unsigned char LowLength, unsigned char HighLength);
+
+/*! Wait for the next display message.  A message in the high priority lane 
+ * is always received before a message in the low priority lane.
+ *
+ * \param pMsg is where the message is stored
+ * \param TicksToWait is portMAX_DELAY or DONT_WAIT
+ * \return the lane the message came from or DISPLAY_NO_MESSAGE
+ */
+unsigned char ReceiveDisplayMessage(tMessage* pMsg, portTickType TicksToWait);
+
+/*! Look at the next message in a display lane without removing it 
+ *
+ * \param Lane is DISPLAY_LOW_LANE or DISPLAY_HIGH_LANE
+ * \param pMsg is where the message is stored
+ * \return 1 if there is a message in the lane
+ */
+unsigned char PeekDisplayMessage(unsigned char Lane, tMessage* pMsg);
+
+/*! Remove the next message from a display lane (after it was peeked).  This
+ * does not wait.
+ *
+ * \param Lane is DISPLAY_LOW_LANE or DISPLAY_HIGH_LANE
+ * \param pMsg is where the message is stored
+ */
+void RemoveDisplayMessage(unsigned char Lane, tMessage* pMsg);
+
+/*! Take the next message out of a task queue.  The time the message spent in
+ * the queue is added to the queue telemetry.
+ *
+ * \param Qindex is the queue index (not the display queue)
+ * \param pMsg is where the message is stored
+ * \param TicksToWait is portMAX_DELAY or DONT_WAIT
+ * \return 1 if a message was received
+ */
+unsigned char ReceiveMessage(unsigned char Qindex,
+                             tMessage* pMsg,
+                             portTickType TicksToWait);
+
+/*! Send the queue telemetry (the response to a QueueTelemetryMsg) to the 
+ * host.  The format is described with the QUEUE_TELEMETRY options in 
+ * Messages.h.
+ *
+ * \param pMsg is the QueueTelemetryMsg
+ */
+void QueueTelemetryHandler(tMessage* pMsg);
+
+/*! Enable or disable credit based flow control of the bulk display messages
+ * from the host.  Enabling it grants the first window of credits.
+ *
+ * \param pMsg is the FlowControlMsg
+ */
+void FlowControlHandler(tMessage* pMsg);
+
+/*! Send the credits of the flow controlled messages that have been freed 
+ * since the last call to the host.  This is called by the display task when
+ * it has finished a batch of messages.
+ */
+void SendFlowControlCredits(void);
+
 /*! \return 1 when all task queues are empty and the part can go into sleep 
  * mode 
  */
@@ -65,19 +168,42 @@ void SendToFreeQueue(tMessage* pMsg);
  */
 void SendToFreeQueueIsr(tMessage* pMsg);
 
+/*! Free a message that was taken out of a task queue.  A flow controlled 
+ * message from the host returns its credit.  SendToFreeQueue does not 
+ * return credits because the stack library frees its own messages (which do
+ * not have the flags) with it.
+ *
+ * \param pMsg A pointer to the message that was received
+ */
+void FreeQueuedMessage(tMessage* pMsg);
+
 /*! Route a message to the appropriate task (queue). This operation is a copy.
+ * The destination is looked up in the routing table in constant time.
+ * This is how the stack library routes the messages from the host; a flow
+ * controlled message uses a credit.
  *
  * \param pMsg A pointer to a message buffer
  */
 void RouteMsg(tMessage* pMsg);
 
+/*! Route a message the watch sends to itself.  This is RouteMsg without
+ * flow control; the application uses it for the flow controlled types 
+ * (ROUTE_CREDIT) so that it does not use the host's credits.
+ *
+ * \param pMsg A pointer to a message buffer
+ */
+void RouteWatchMsg(tMessage* pMsg);
+
 /*! Send a message to a queue from an ISR.  This requires 1/2 the time of 
  * RouteMsgFromIsr.
  *
  * \param Qindex is the queue index to place the message in
  * \param pMsg A pointer to a message buffer
+ *
+ * \return 1 if the message was put into the queue, 0 if it was freed (or
+ * there was no buffer for its inline payload)
  */
-void SendMessageToQueueFromIsr(unsigned char Qindex,tMessage* pMsg);
+unsigned char SendMessageToQueueFromIsr(unsigned char Qindex,tMessage* pMsg);
 
 /*! Let routing know handle of wrapper queue.  This function is used so that the
  * number of queues can change without affecting the stack.
@@ -100,6 +226,28 @@ void SetupMessage(tMessage* pMsg,
                   unsigned char Type,
                   unsigned char Options);
 
+/*! Set the message parameters and use the inline payload of the message 
+ * instead of a buffer.  Safe to call when in interrupt context.
+ *
+ * \param pMsg is a pointer to a message
+ * \param Type is the message type
+ * \param Options are the message options
+ *
+ * \note The payload is limited to MSG_INLINE_PAYLOAD_LENGTH bytes.  A buffer
+ * is allocated for the queued copy when the message is sent to the serial 
+ * port profile task (the message itself is not changed so it can be sent 
+ * again).  The message is dropped when there is no buffer.
+ */
+void SetupMessageWithInlinePayload(tMessage* pMsg,
+                                   unsigned char Type,
+                                   unsigned char Options);
+
+/*! \return a pointer to the payload of a message (inline or in a buffer)
+ *
+ * \param pMsg is a pointer to a message
+ */
+unsigned char* GetMessagePayload(tMessage* pMsg);
+
 /*! Set the message parameters.
  *
  * The pMsg->pBuffer pMsg will point to a message buffer after a call to 
@@ -110,16 +258,27 @@ void SetupMessage(tMessage* pMsg,
  * \param Type is the message type
  * \param Options are the message options
  *
- * \note This cannot be called from an ISR.  It was chosen to not allow buffers
- * to be allocated from ISRs because of the amount of time it can take
+ * \note Use SetupMessageAndAllocateBufferFromIsr in interrupt context.
  *
  */
 void SetupMessageAndAllocateBuffer(tMessage* pMsg,
                                    unsigned char Type,
                                    unsigned char Options);
 
+/*! Set the message parameters and allocate a buffer from interrupt context.
+ *
+ * \param pMsg is a pointer to a message
+ * \param Type is the message type
+ * \param Options are the message options
+ *
+ * \note The message should be sent with SendMessageToQueueFromIsr.
+ */
+void SetupMessageAndAllocateBufferFromIsr(tMessage* pMsg,
+                                          unsigned char Type,
+                                          unsigned char Options);
+
 
-/*! Print the message type
+/*! Trace the message type (and options) of messages with ROUTE_PRINT
  *
  * \param pMsg is a pointer to a message 
  *
@@ -35,24 +35,55 @@
   (HOST_MSG_BUFFER_LENGTH - HOST_MSG_HEADER_LENGTH - HOST_MSG_CRC_LENGTH)
 
 
+/*! Number of payload bytes that can be carried inside of a message */
+#define MSG_INLINE_PAYLOAD_LENGTH ( 6 )
+
+/*! pBuffer has this value when the payload is in InlinePayload.  It is odd so
+ * it can never be a buffer from the pool.
+ */
+#define MSG_INLINE_PAYLOAD ( (unsigned char *)1 )
+
 /*! Message Format
  *
  * \param Length is the length of the message.  This is only used for messages
  * sent to the host
  * \param Type is the type of the message
  * \param Options is the option byte of the message
- * \param pBuffer can point to a message buffer
+ * \param Flags are set by the application when the message is queued 
+ * (MSG_CREDIT)
+ * \param pBuffer can point to a message buffer (or be MSG_INLINE_PAYLOAD)
+ * \param InlinePayload holds a small payload so that a buffer does not 
+ * have to be allocated
+ * \param Timestamp is the crystal timer count when the message was put into 
+ * a task queue (it is only valid in the queue)
  *
+ * \note The serial port profile task (stack library) only knows about the 
+ * first four fields.  Their layout cannot change.  An inline payload is 
+ * moved into a buffer before a message is put into its queue.  Flags and the
+ * fields after pBuffer are not valid in a message of the stack library; they
+ * only exist in the application's messages and queue items.
+ * Flags is the byte that pads the library's message in front of pBuffer so
+ * the offsets of the library's fields do not change.
+ *
+ * \note The payload should be accessed with GetMessagePayload.
  */
 typedef struct
 {
   unsigned char Length;
   unsigned char Type;
   unsigned char Options;
+  unsigned char Flags;
   unsigned char * pBuffer;
+  unsigned char InlinePayload[MSG_INLINE_PAYLOAD_LENGTH];
+  unsigned int Timestamp;
 
 } tMessage;
 
+/*! Flags: a flow controlled message that the host sent with a credit (the 
+ * credit is returned when the message is freed) 
+ */
+#define MSG_CREDIT ( BIT0 )
+
 
 
 /*! Host Message Packet Format
@@ -106,6 +137,24 @@ typedef struct
 #define WRITE_BUFFER_ONE_LINE      ( 0x10 )
 #define WRITE_BUFFER_ONE_LINE_MASK ( 0x10 )
 
+/*! Payload of the WriteBufferPacked message
+ *
+ * A start row, the number of rows and then the rows compressed in the 
+ * template format (see Templates.h).  The options are the same as 
+ * WriteBuffer.  When WRITE_BUFFER_PACKED_XOR_OPTION is set the rows are 
+ * xor'ed with what is already in the buffer so that only the changes have
+ * to be sent.
+ *
+ * There is room for HOST_MSG_MAX_PAYLOAD_LENGTH - 2 (24) bytes of commands.
+ * Blank or unchanged rows cost one byte for up to 64 rows.  A row of data 
+ * that does not compress costs 13 bytes, so only one fits (WriteBuffer 
+ * carries two).
+ */
+#define WRITE_BUFFER_PACKED_START_ROW_INDEX ( 0 )
+#define WRITE_BUFFER_PACKED_COUNT_INDEX     ( 1 )
+#define WRITE_BUFFER_PACKED_DATA_INDEX      ( 2 )
+#define WRITE_BUFFER_PACKED_XOR_OPTION      ( BIT6 )
+
 /*! The serial ram message is formatted so that it can be overlaid onto the
  * message from the host (so that a buffer allocation does not have to be
  * performed and there is one less message copy).
@@ -156,148 +205,160 @@ typedef struct
 #define LCD_MESSAGE_LINE_INDEX       ( 4 )
 
 
+/*! Message type list
+ *
+ * Every message type is described once here.  The list generates the
+ * eMessageType enumeration and the routing table in MessageQueues.c so a
+ * message type cannot be added without also being routed.
+ *
+ * \param Name is the enumeration name of the message
+ * \param Value is the message type value sent over the air
+ * \param Queue is the destination queue (without the _QINDEX suffix)
+ * \param Flags are the routing flags defined in MessageQueues.h
+ *
+ * \note this does not follow 80 character width rule because it is easier to
+ * maintain this way
+ */
+#define MESSAGE_TYPE_LIST(X) \
+  X( InvalidMessage,             0x00, FREE,       ROUTE_PRINT                               ) \
+                                                                                               \
+  X( GetDeviceType,              0x01, BACKGROUND, ROUTE_PRINT                               ) \
+  X( GetDeviceTypeResponse,      0x02, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( GetInfoString,              0x03, BACKGROUND, ROUTE_PRINT                               ) \
+  X( GetInfoStringResponse,      0x04, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( DiagnosticLoopback,         0x05, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( EnterShippingModeMsg,       0x06, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( SoftwareResetMsg,           0x07, BACKGROUND, ROUTE_PRINT                               ) \
+  X( ConnectionTimeoutMsg,       0x08, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( TurnRadioOnMsg,             0x09, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( TurnRadioOffMsg,            0x0a, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( ReadRssiMsg,                0x0b, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( PairingControlMsg,          0x0c, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( ReadRssiResponseMsg,        0x0d, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( SniffControlMsg,            0x0e, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( LinkAlarmMsg,               0x0f, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+                                                                                               \
+  /* OLED display related commands */                                                          \
+  X( OledWriteBufferMsg,         0x10, DISPLAY,    ROUTE_PRINT | ROUTE_BUFFER | ROUTE_CREDIT ) \
+  X( OledConfigureModeMsg,       0x11, DISPLAY,    ROUTE_PRINT                               ) \
+  X( OledChangeModeMsg,          0x12, DISPLAY,    ROUTE_PRINT                               ) \
+  X( OledWriteScrollBufferMsg,   0x13, DISPLAY,    ROUTE_PRINT | ROUTE_BUFFER | ROUTE_CREDIT ) \
+  X( OledScrollMsg,              0x14, DISPLAY,    ROUTE_PRINT                               ) \
+  X( OledShowIdleBufferMsg,      0x15, DISPLAY,    ROUTE_PRINT                               ) \
+  X( OledCrownMenuMsg,           0x16, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( OledCrownMenuButtonMsg,     0x17, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+                                                                                               \
+  /* Status and control */                                                                     \
+                                                                                               \
+  /* move the hands hours, mins and seconds */                                                 \
+  X( AdvanceWatchHandsMsg,       0x20, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  /* config and (dis)enable vibrate */                                                         \
+  X( SetVibrateMode,             0x23, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  X( ButtonStateMsg,             0x24, BACKGROUND, 0                                         ) \
+                                                                                               \
+  /* Sets the RTC */                                                                           \
+  X( SetRealTimeClock,           0x26, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( GetRealTimeClock,           0x27, BACKGROUND, ROUTE_PRINT                               ) \
+  X( GetRealTimeClockResponse,   0x28, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  /* osal nv */                                                                                \
+  X( NvalOperationMsg,           0x30, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( NvalOperationResponseMsg,   0x31, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  /* status of the current display operation */                                                \
+  X( StatusChangeEvent,          0x33, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  X( ButtonEventMsg,             0x34, SPP_TASK,   ROUTE_PRINT                               ) \
+                                                                                               \
+  X( GeneralPurposePhoneMsg,     0x35, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( GeneralPurposeWatchMsg,     0x36, BACKGROUND, ROUTE_PRINT                               ) \
+                                                                                               \
+  /* LCD display related commands */                                                           \
+  X( WriteBuffer,                0x40, DISPLAY,    ROUTE_BUFFER | ROUTE_CREDIT               ) \
+  X( ConfigureDisplay,           0x41, DISPLAY,    ROUTE_PRINT                               ) \
+  X( ConfigureIdleBufferSize,    0x42, DISPLAY,    ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( UpdateDisplay,              0x43, DISPLAY,    ROUTE_PRINT | ROUTE_CREDIT                ) \
+  X( LoadTemplate,               0x44, DISPLAY,    ROUTE_PRINT | ROUTE_BUFFER | ROUTE_CREDIT ) \
+  X( CachedPageMsg,              0x45, DISPLAY,    ROUTE_PRINT | ROUTE_BUFFER | ROUTE_CREDIT ) \
+  X( EnableButtonMsg,            0x46, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( DisableButtonMsg,           0x47, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( ReadButtonConfigMsg,        0x48, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( ReadButtonConfigResponse,   0x49, BACKGROUND, ROUTE_PRINT                               ) \
+  X( WriteBufferPacked,          0x4a, DISPLAY,    ROUTE_BUFFER | ROUTE_CREDIT               ) \
+                                                                                               \
+  X( BatteryChargeControl,       0x52, BACKGROUND, 0                                         ) \
+  X( BatteryConfigMsg,           0x53, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( LowBatteryWarningMsgHost,   0x54, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( LowBatteryBtOffMsgHost,     0x55, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( ReadBatteryVoltageMsg,      0x56, BACKGROUND, ROUTE_PRINT                               ) \
+  X( ReadBatteryVoltageResponse, 0x57, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( ReadLightSensorMsg,         0x58, BACKGROUND, ROUTE_PRINT                               ) \
+  X( ReadLightSensorResponse,    0x59, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( LowBatteryWarningMsg,       0x5a, DISPLAY,    ROUTE_PRINT                               ) \
+  X( LowBatteryBtOffMsg,         0x5b, DISPLAY,    ROUTE_PRINT                               ) \
+                                                                                               \
+  /* User Reserved 0x60-0x70-0x80-0x90 */                                                      \
+                                                                                               \
+  /* Watch/Internal Use Only */                                                                \
+  X( IdleUpdate,                 0xa0, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( WatchDrawnScreenTimeout,    0xa2, DISPLAY,    ROUTE_PRINT                               ) \
+  X( SplashTimeoutMsg,           0xa3, DISPLAY,    ROUTE_PRINT                               ) \
+  X( ChangeModeMsg,              0xa6, DISPLAY,    0                                         ) \
+  X( ModeTimeoutMsg,             0xa7, DISPLAY,    ROUTE_PRINT                               ) \
+  X( WatchStatusMsg,             0xa8, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( MenuModeMsg,                0xa9, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( BarCode,                    0xaa, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( ListPairedDevicesMsg,       0xab, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( ConnectionStateChangeMsg,   0xac, DISPLAY,    ROUTE_PRINT                               ) \
+  X( ModifyTimeMsg,              0xad, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( MenuButtonMsg,              0xae, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+  X( ToggleSecondsMsg,           0xaf, DISPLAY,    ROUTE_PRINT | ROUTE_URGENT                ) \
+                                                                                               \
+  /* BLE messages */                                                                           \
+  X( SetCallbackTimerMsg,        0xb0, BACKGROUND, ROUTE_BUFFER                              ) \
+  X( CallbackTimeoutMsg,         0xb1, SPP_TASK,   0                                         ) \
+  X( UpdateConnParameterMsg,     0xb2, SPP_TASK,   ROUTE_PRINT                               ) \
+                                                                                               \
+  X( LedChange,                  0xc0, BACKGROUND, ROUTE_PRINT                               ) \
+                                                                                               \
+  X( QueryMemoryMsg,             0xd0, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( RamTestMsg,                 0xd1, DISPLAY,    ROUTE_PRINT                               ) \
+  X( RateTestMsg,                0xd2, BACKGROUND, ROUTE_PRINT                               ) \
+  X( QueueTelemetryMsg,          0xd3, BACKGROUND, ROUTE_PRINT                               ) \
+  X( QueueTelemetryResponse,     0xd4, SPP_TASK,   ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( FlowControlMsg,             0xd5, BACKGROUND, ROUTE_PRINT                               ) \
+  X( FlowControlCreditMsg,       0xd6, SPP_TASK,   ROUTE_BUFFER                              ) \
+                                                                                               \
+  X( AccelerometerHostMsg,       0xe0, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( AccelerometerEnableMsg,     0xe1, BACKGROUND, ROUTE_PRINT                               ) \
+  X( AccelerometerDisableMsg,    0xe2, BACKGROUND, ROUTE_PRINT                               ) \
+  X( AccelerometerSendDataMsg,   0xe3, BACKGROUND, ROUTE_PRINT                               ) \
+  X( AccelerometerAccessMsg,     0xe4, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+  X( AccelerometerResponseMsg,   0xe5, BACKGROUND, ROUTE_PRINT                               ) \
+  X( AccelerometerSetupMsg,      0xe6, BACKGROUND, ROUTE_PRINT | ROUTE_BUFFER                ) \
+                                                                                               \
+  X( RadioPowerControlMsg,       0xf0, SPP_TASK,   ROUTE_PRINT                               ) \
+  X( AdvertisingDataMsg,         0xf1, SPP_TASK,   ROUTE_PRINT                               )
+
 /*! Message type enumeration
  *
  * for this processor the default is 16 bits for an enumeration
  */
+#define MESSAGE_TYPE_ENUM(Name, Value, Queue, Flags) Name = Value,
+
 typedef enum
 {
-  InvalidMessage = 0x00,
-
-  GetDeviceType = 0x01,
-  GetDeviceTypeResponse = 0x02,
-  GetInfoString = 0x03,
-  GetInfoStringResponse = 0x04,
-  DiagnosticLoopback = 0x05,
-  EnterShippingModeMsg = 0x06,
-  SoftwareResetMsg = 0x07,
-  ConnectionTimeoutMsg = 0x08,
-  TurnRadioOnMsg = 0x09,
-  TurnRadioOffMsg = 0x0a,
-  ReadRssiMsg = 0x0b,
-  PairingControlMsg = 0x0c,
-  ReadRssiResponseMsg = 0x0d,
-  SniffControlMsg = 0x0e,
-  LinkAlarmMsg = 0x0f,
-
-  /*
-   * OLED display related commands
-   */
-  OledWriteBufferMsg = 0x10,
-  OledConfigureModeMsg = 0x11,
-  OledChangeModeMsg = 0x12,
-  OledWriteScrollBufferMsg = 0x13,
-  OledScrollMsg = 0x14,
-  OledShowIdleBufferMsg = 0x15,
-  OledCrownMenuMsg = 0x16,
-  OledCrownMenuButtonMsg = 0x17,
-
-  /*
-   * Status and control
-   */
-
-  /* move the hands hours, mins and seconds */
-  AdvanceWatchHandsMsg = 0x20,
-
-  /* config and (dis)enable vibrate */
-  SetVibrateMode = 0x23,
-
-  ButtonStateMsg = 0x24,
-
-  /* Sets the RTC */
-  SetRealTimeClock = 0x26,
-  GetRealTimeClock = 0x27,
-  GetRealTimeClockResponse = 0x28,
-
-  /* osal nv */
-  NvalOperationMsg = 0x30,
-  NvalOperationResponseMsg = 0x31,
-
-  /* status of the current display operation */
-  StatusChangeEvent = 0x33,
-
-  ButtonEventMsg = 0x34,
-
-  GeneralPurposePhoneMsg = 0x35,
-  GeneralPurposeWatchMsg = 0x36,
-  /*
-   * LCD display related commands
-   */
-  WriteBuffer = 0x40,
-  ConfigureDisplay = 0x41,
-  ConfigureIdleBufferSize = 0x42,
-  UpdateDisplay = 0x43,
-  LoadTemplate = 0x44,
-  Unused_0x45 = 0x45,
-  EnableButtonMsg = 0x46,
-  DisableButtonMsg = 0x47,
-  ReadButtonConfigMsg = 0x48,
-  ReadButtonConfigResponse = 0x49,
-  Unused_0x4a = 0x4a,
-
-  /* */
-  BatteryChargeControl = 0x52,
-  BatteryConfigMsg = 0x53,
-  LowBatteryWarningMsgHost = 0x54,
-  LowBatteryBtOffMsgHost = 0x55,
-  ReadBatteryVoltageMsg = 0x56,
-  ReadBatteryVoltageResponse = 0x57,
-  ReadLightSensorMsg = 0x58,
-  ReadLightSensorResponse = 0x59,
-  LowBatteryWarningMsg = 0x5a,
-  LowBatteryBtOffMsg = 0x5b,
-
-  /*****************************************************************************
-   *
-   * User Reserved 0x60-0x70-0x80-0x90
-   *
-   ****************************************************************************/
-
-  /*****************************************************************************
-   *
-   * Watch/Internal Use Only
-   *
-   ****************************************************************************/
-  IdleUpdate = 0xa0,
-  WatchDrawnScreenTimeout = 0xa2,
-  SplashTimeoutMsg = 0xa3,
-  Unused_0xa4 = 0xa4,
-  Unused_0xa5 = 0xa5,
-  ChangeModeMsg = 0xa6,
-  ModeTimeoutMsg = 0xa7,
-  WatchStatusMsg = 0xa8,
-  MenuModeMsg = 0xa9,
-  BarCode = 0xaa,
-  ListPairedDevicesMsg = 0xab,
-  ConnectionStateChangeMsg = 0xac,
-  ModifyTimeMsg = 0xad,
-  MenuButtonMsg = 0xae,
-  ToggleSecondsMsg = 0xaf,
-
-  // BLE messages
-  SetCallbackTimerMsg = 0xb0,
-  CallbackTimeoutMsg = 0xb1,
-  UpdateConnParameterMsg = 0xb2,
-  
-  LedChange = 0xc0,
-
-  QueryMemoryMsg = 0xd0,
-  RamTestMsg = 0xd1,
-  RateTestMsg = 0xd2,
-
-  AccelerometerHostMsg = 0xe0,
-  AccelerometerEnableMsg  = 0xe1,
-  AccelerometerDisableMsg = 0xe2,
-  AccelerometerSendDataMsg = 0xe3,
-  AccelerometerAccessMsg = 0xe4,
-  AccelerometerResponseMsg = 0xe5,
-  AccelerometerSetupMsg = 0xe6,
-
-  RadioPowerControlMsg = 0xf0,
-  AdvertisingDataMsg = 0xf1
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_ENUM)
+
+  /* the largest value that fits into the Type field of a message */
+  MaxMessageType = 0xff
 
 } eMessageType;
 
+#undef MESSAGE_TYPE_ENUM
+
 
 #define LED_OFF_OPTION      ( 0x00 )
 #define LED_ON_OPTION       ( 0x01 )
@@ -417,7 +478,8 @@ typedef struct
 /*! Load Template Strucutre
  *
  * /param TemplateSelect (the first bye of payload) selects what will be filled
- * into display memory.
+ * into display memory.  0 clears the buffer, 1 fills it and the rest are the 
+ * templates in flash (see Templates.h).
  */
 typedef struct
 {
@@ -425,6 +487,23 @@ typedef struct
 
 } tLoadTemplatePayload;
 
+/*! Cached page message
+ *
+ * Cached pages are full screens that are kept in the serial ram outside of
+ * the display buffers (only the 256 Kbit part has room for them).  The 
+ * first byte of the payload is the page number.  The buffer select bits of
+ * the options select the mode (scroll mode can't be used).
+ *
+ * CACHED_PAGE_SAVE copies the most recent buffer of the mode into the page.
+ * CACHED_PAGE_LOAD copies the page into the draw buffer of the mode.
+ * CACHED_PAGE_SHOW loads the page and then updates the display.
+ */
+#define CACHED_PAGE_INDEX          ( 0 )
+#define CACHED_PAGE_OPERATION_MASK ( BIT4 | BIT5 )
+#define CACHED_PAGE_SAVE           ( 0 )
+#define CACHED_PAGE_LOAD           ( BIT4 )
+#define CACHED_PAGE_SHOW           ( BIT5 )
+
 /* options */
 #define IDLE_BUFFER_SELECT         ( 0x00 )
 #define APPLICATION_BUFFER_SELECT  ( 0x01 )
@@ -688,6 +767,54 @@ typedef struct
 #define READ_RSSI_FAILURE_OPTION ( 2 )
 
 
+/******************************************************************************/
+
+/*! Options for the queue telemetry message
+ *
+ * The lower bits select the queue (BACKGROUND_QINDEX, DISPLAY_QINDEX or 
+ * SPP_TASK_QINDEX) or QUEUE_TELEMETRY_TYPES_OPTION for the message types.
+ * When QUEUE_TELEMETRY_CLEAR_OPTION is set all of the counts are cleared 
+ * after the response is made.
+ *
+ * Queue response: enqueued (2), dropped (2), max depth (1), 
+ * latency histogram (QUEUE_LATENCY_BINS x 2).  Bin 0 counts latencies of 0 
+ * ticks and bin n counts 2^(n-1) to 2^n - 1 ticks.  The last bin also counts
+ * everything larger.  A tick is 0.9765625 ms.  Latency is not measured for
+ * the serial port profile task.
+ *
+ * Message type request: the first byte of the payload is the first message
+ * type to report.
+ * Message type response: the next message type to ask for (1) (0 when there
+ * are no more) and then a record for each message type that was routed: 
+ * type (1), enqueued (2), dropped (2), max latency (2).
+ *
+ * All values are little endian.
+ */
+#define QUEUE_TELEMETRY_SELECT_MASK  ( 0x0F )
+#define QUEUE_TELEMETRY_TYPES_OPTION ( 0x0F )
+#define QUEUE_TELEMETRY_CLEAR_OPTION ( BIT7 )
+
+#define QUEUE_LATENCY_BINS ( 8 )
+
+
+/******************************************************************************/
+
+/*! Options for the flow control message
+ *
+ * When flow control is enabled the host may only send bulk display messages
+ * (WriteBuffer, WriteBufferPacked, LoadTemplate, UpdateDisplay and the OLED 
+ * buffer writes) when
+ * it has a credit.  Each of these messages uses one credit.  The watch grants
+ * the first window in response to FLOW_CONTROL_ENABLE_OPTION and then 
+ * returns credits with FlowControlCreditMsg as the messages are consumed.
+ *
+ * FlowControlCreditMsg payload: credits granted (1), free display queue 
+ * entries (1), free message buffers (1)
+ */
+#define FLOW_CONTROL_DISABLE_OPTION ( 0 )
+#define FLOW_CONTROL_ENABLE_OPTION  ( 1 )
+
+
 /******************************************************************************/
 
 #define CONFIGURE_DISPLAY_OPTION_RESERVED             ( 0 )
@@ -174,6 +174,10 @@ static void MenuExitHandler(void);
 /******************************************************************************/
 
 #define DISPLAY_TASK_QUEUE_LENGTH 8
+#define DISPLAY_TASK_HIGH_QUEUE_LENGTH 4
+
+/* the most messages that are handled before the stack and queue checks */
+#define DISPLAY_TASK_BATCH_LENGTH ( 8 )
 #define DISPLAY_TASK_STACK_SIZE 	(configMINIMAL_STACK_SIZE + 90)    
 #define DISPLAY_TASK_PRIORITY     (tskIDLE_PRIORITY + 1)
 
@@ -251,8 +255,7 @@ static void NormalIdleScreenButtonConfiguration(void);
  */
 void InitializeDisplayTask(void)
 {
-  QueueHandles[DISPLAY_QINDEX] = 
-    xQueueCreate( DISPLAY_TASK_QUEUE_LENGTH, MESSAGE_QUEUE_ITEM_SIZE );
+  CreateDisplayQueue(DISPLAY_TASK_QUEUE_LENGTH, DISPLAY_TASK_HIGH_QUEUE_LENGTH);
   
   // prams are: task function, task name, stack len , task params, priority, task handle
   xTaskCreate(DisplayTask, 
@@ -494,17 +497,32 @@ static void DisplayTask(void *pvParameters)
   
   for(;;)
   {
-    if( xQueueReceive(QueueHandles[DISPLAY_QINDEX], &DisplayMsg, portMAX_DELAY) )
+    unsigned char Lane = ReceiveDisplayMessage(&DisplayMsg, portMAX_DELAY);
+    unsigned char Count = 0;
+    
+    /* once awake handle whatever else is already waiting */
+    while ( Lane != DISPLAY_NO_MESSAGE )
     {
       DisplayQueueMessageHandler(&DisplayMsg);
       
-      SendToFreeQueue(&DisplayMsg);
-      
-      CheckStackUsage(DisplayHandle,"Display");
-      
-      CheckQueueUsage(QueueHandles[DISPLAY_QINDEX]);
+      FreeQueuedMessage(&DisplayMsg);
       
+      if ( ++Count < DISPLAY_TASK_BATCH_LENGTH )
+      {
+        Lane = ReceiveDisplayMessage(&DisplayMsg, DONT_WAIT);
+      }
+      else
+      {
+        Lane = DISPLAY_NO_MESSAGE;
+      }
     }
+    
+    SendFlowControlCredits();
+    
+    CheckStackUsage(DisplayHandle,"Display");
+    
+    CheckQueueUsage(QueueHandles[DISPLAY_QINDEX]);
+    
   }
 }
 
@@ -564,7 +582,7 @@ static void WriteBufferHandler(tMessage* pMsg)
   tImageBuffer * pImage;
   
   tWriteOledBufferPayload* pWriteOledBufferPayload = 
-    (tWriteOledBufferPayload*)pMsg->pBuffer;
+    (tWriteOledBufferPayload*)GetMessagePayload(pMsg);
 
   pImage = SelectImageBuffer(pMsg->Options,
                              pWriteOledBufferPayload->BufferSelect);  
@@ -642,7 +660,7 @@ static unsigned char LastScrollPacketReceived;
 static void WriteScrollBufferHandler(tMessage* pMsg)
 {
   tWriteScrollBufferPayload* pWriteScrollBufferPayload = 
-    (tWriteScrollBufferPayload*)pMsg->pBuffer;
+    (tWriteScrollBufferPayload*)GetMessagePayload(pMsg);
 
   /* copy the data into the buffer */
   unsigned char i;
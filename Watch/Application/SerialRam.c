@@ -24,9 +24,13 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "semphr.h"
 
 #include "hal_board_type.h"
 #include "hal_clock_control.h"
+#include "hal_lcd.h"
+#include "hal_lpm.h"
+#include "hal_rtos_timer.h"
 
 #include "Messages.h"
 #include "MessageQueues.h"
@@ -36,6 +40,10 @@
 #include "LcdDisplay.h"
 #include "Utilities.h"
 #include "Adc.h"
+#include "BufferPool.h"
+#include "Templates.h"
+#include "DisplayBuffers.h"
+#include "Statistics.h"
 
 /******************************************************************************/
 
@@ -54,16 +62,25 @@
 
 #define SEQUENTIAL_MODE_COMMAND ( 0x41 )
 
+#define SERIAL_RAM_SIZE_64K  ( (unsigned int)8192 )
+#define SERIAL_RAM_SIZE_256K ( (unsigned int)32768 )
+
 /* errata - DMA variables cannot be function scope */
 static unsigned char DummyData = 0x00;
 static unsigned char ReadData = 0x00;
 static unsigned char DmaBusy  = 0;
 
-static tMessage OutgoingMsg;
+/* 
+ * The serial ram SPI clock is 8 MHz.  Only transfers that have more than 
+ * SRAM_DMA_BLOCKING_SIZE bytes (256 us) left block on the semaphore because
+ * switching to another task and back costs time as well.
+ */
+#define SRAM_DMA_BLOCKING_SIZE ( 256 )
 
-static unsigned char pWorkingBuffer[16];
+static xSemaphoreHandle DmaDone;
+static unsigned char DmaWaiting = 0;
 
-static tLcdMessagePayload WriteLineBuffer;
+static tMessage OutgoingMsg;
 
 typedef struct
 {
@@ -77,35 +94,107 @@ typedef struct
 #define BYTES_PER_SCREEN ( (unsigned int)1152 )
 #define BYTES_PER_LINE   ( 12 )
 
+#if TEMPLATE_BYTES_PER_LINE != BYTES_PER_LINE
+  #error "Templates must have the line length of the serial ram buffers"
+#endif
+
 /* command and two addres bytes */
 #define SPI_OVERHEAD ( 3 )
 
+/* the read data lags the command and address by one byte */
+#define READ_DATA_OFFSET ( SPI_OVERHEAD + 1 )
+
+/* lines are read from the serial ram into ReadLinesBuffer and then copied 
+ * into one burst while the other is sent to the lcd 
+ */
+static tLcdBurst LcdBurst[2];
+
+static unsigned char ReadLinesBuffer[READ_DATA_OFFSET + 
+                                     LCD_BURST_LINES * BYTES_PER_LINE];
+
+/* the rows of write buffer messages are collected in ReadLinesBuffer while
+ * they go to adjacent addresses and then written with one transfer 
+ */
+static unsigned int StagedAddress;
+static unsigned char StagedRows = 0;
+
+/* 
+ * Serial ram memory map
+ *
+ * The regions are handed out in order by AllocateSerialRam when the part
+ * has been detected:
+ *
+ * 0x0000   the display buffers of each mode (idle, application, 
+ *          notification and then scroll).  Scroll buffers are half a 
+ *          screen.
+ * after    cached pages (full screens, as many as fit in the part)
+ *
+ * An update reads a full screen, so a read of a scroll buffer continues 
+ * into whatever follows it (on the 64 Kbit part the last one wraps around
+ * to address 0).
+ *
+ * The number of display buffers of each mode is set for each part in 
+ * BuffersPerMode.  A mode has NUMBER_OF_BUFFERS (double buffering) or 
+ * MAX_NUMBER_OF_BUFFERS (a mailbox, see DisplayBuffers.h).  The map falls 
+ * back to the 64 Kbit counts when a configuration does not fit in the part.
+ */
+#define SERIAL_RAM_PART_64K  ( 0 )
+#define SERIAL_RAM_PART_256K ( 1 )
+
+static const unsigned char BuffersPerMode[2][NUMBER_OF_MODES] =
+{
+  { 2, 2, 2, 2 },
+  { 3, 3, 3, 3 },
+};
+
+#define SERIAL_RAM_FULL ( 0xFFFF )
+
+static unsigned int SerialRamSize = SERIAL_RAM_SIZE_64K;
+static unsigned int SerialRamUsed;
+
+static unsigned int BufferAddress[NUMBER_OF_MODES][MAX_NUMBER_OF_BUFFERS];
+static unsigned int CachedPagesAddress;
+static unsigned char NumberOfCachedPages;
+
 /******************************************************************************/
 
 #define FREE_BUFFER        ( 1 )
 #define DO_NOT_FREE_BUFFER ( 0 )
 
 static void ClearMemory(void);
+static unsigned int AllocateSerialRam(unsigned int Size);
+static unsigned char MapSerialRam(unsigned char const * pBuffersPerMode);
 static void SetupCycle(unsigned int Address,unsigned char CycleType);
 static void WriteBlockToSram(unsigned char* pData,unsigned int Size);
-static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData);
+static void ReadBlock(unsigned char* pWriteData,
+                      unsigned char* pReadData,
+                      unsigned int Size);
+static unsigned char ReadLines(unsigned int Address, unsigned char RowNum);
+static unsigned char CopyLinesToBurst(tLcdBurst* pBurst,
+                                      unsigned char StartRow,
+                                      unsigned char Count);
 static void WaitForDmaEnd(void);
+static unsigned char SerialRamDmaIsr(signed portBASE_TYPE* pTaskWoken);
+static void CopyBufferInSram(unsigned int Source,
+                             unsigned int Destination,
+                             unsigned int Size);
+static void WriteChunkToSram(unsigned int Address, unsigned int Size);
+static unsigned char DecodeToSram(unsigned char const * pData,
+                                  unsigned char const * pEnd,
+                                  unsigned int Address,
+                                  unsigned int Size,
+                                  unsigned char Xor);
+static unsigned char WriteMessageRows(tMessage* pMsg,
+                                      unsigned int BufferAddress);
+static unsigned char IsNextWriteBufferRow(tMessage* pMsg,
+                                          unsigned char Mode,
+                                          unsigned char LastRow);
+static void StageRow(unsigned int Address, unsigned char const * pLine);
+static void WriteStagedRows(void);
 
 /******************************************************************************/
 unsigned char GetStartingRow(unsigned char MsgOptions);
-unsigned char GetBufferIndex(unsigned char Mode, unsigned char Type);
 unsigned int GetBufferAddress(unsigned char Index);
-void SetBufferStatus(unsigned char Index, unsigned char Status);
-
-// Status of buffers (2 for each of 4 display modes): 
-// 0: clean; 1: buffer read done; 2: buffer is writing; 3: buffer is written
-unsigned char BufferStatus[NUMBER_OF_MODES][NUMBER_OF_BUFFERS];
-
-// Rules for deciding which of the two buffers to read and write
-unsigned char BufSelRule[2][3] =
-  {{BUFFER_WRITTEN, BUFFER_WRITING}, // for read
-   {BUFFER_WRITING, BUFFER_CLEAN, BUFFER_WRITTEN}
-  };
 
 unsigned char LastUpdatedMode = SCROLL_MODE;
 
@@ -117,6 +206,10 @@ void SerialRamInit(void)
    * configure the MSP430 SPI peripheral
    */
   
+  /* the semaphore is given by the dma interrupt */
+  vSemaphoreCreateBinary(DmaDone);
+  xSemaphoreTake(DmaDone, DONT_WAIT);
+  
   /* assert reset when configuring */
   UCA0CTL1 = UCSWRST;  
  
@@ -158,13 +251,25 @@ void SerialRamInit(void)
   
   unsigned char FinalSrValue = DEFAULT_SR_VALUE;
   unsigned char DefaultSrValue = FINAL_SR_VALUE;
+  unsigned char Part = SERIAL_RAM_PART_64K;
   
   if ( GetBoardConfiguration() >= 5 )
   {
     DefaultSrValue = DEFAULT_SR_VALUE_256;
     FinalSrValue = FINAL_SR_VALUE_256;  
+    SerialRamSize = SERIAL_RAM_SIZE_256K;
+    Part = SERIAL_RAM_PART_256K;
+  }
+  
+  if ( !MapSerialRam(BuffersPerMode[Part]) )
+  {
+    PrintString("Serial RAM map does not fit\r\n");
+    MapSerialRam(BuffersPerMode[SERIAL_RAM_PART_64K]);
   }
   
+  PrintStringAndTwoDecimals("Serial RAM buffers end: ", CachedPagesAddress,
+                            " Cached pages: ", NumberOfCachedPages);
+  
   /* make sure correct value is read from the part */
   if (   ( ReadData != DefaultSrValue )
       && ( ReadData != FinalSrValue ) )
@@ -218,17 +323,12 @@ void WriteBufferHandler(tMessage* pMsg)
    * save the parameters that are going to get written over 
    */
   unsigned char Mode = pMsg->Options & BUFFER_SELECT_MASK;
-  
-  /* map the payload */
-  tSerialRamPayload* pSerialRamPayload = (tSerialRamPayload*)pMsg->pBuffer;
-  
-  unsigned char RowA = pSerialRamPayload->RowSelectA;
-  unsigned char RowB = pSerialRamPayload->RowSelectB;
+  unsigned char Options = pMsg->Options;
+  tMessage NextMsg;
   
   /* use the options to determine what buffer to write then
    * determine what buffer is active/draw 
    * get the buffer address
-   * then add in the row number for the absolute address
    */
   unsigned char Index = GetBufferIndex(Mode, BUFFER_TYPE_WRITE);
 //  PrintStringAndHexByte("----->> MY: WriteBufferHandler: index: ", Index);
@@ -236,45 +336,158 @@ void WriteBufferHandler(tMessage* pMsg)
 //		  BufferStatus[Mode][0], BufferStatus[Mode][1]);
   
   unsigned int BufferAddress = GetBufferAddress(Index);
-  unsigned int AbsoluteAddress = BufferAddress + (RowA*BYTES_PER_LINE);
+  unsigned char LastRow = WriteMessageRows(pMsg, BufferAddress);
   
-  pWorkingBuffer[0] = SPI_WRITE;
-  pWorkingBuffer[1] = (unsigned char)(AbsoluteAddress >> 8);
-  pWorkingBuffer[2] = (unsigned char) AbsoluteAddress; 
+  /* the phone sends a screen as a run of messages to adjacent rows.  The rest
+   * of the run is written to the same buffer without going back through the
+   * display task loop.  WriteBuffer is never urgent so the run is always in 
+   * the low priority lane.  The run stops when a message is waiting in the 
+   * high priority lane so that it is not delayed by the upload.
+   */
+  while (   (Options & BUFFER_WRITTEN_MASK) == 0
+         && !PeekDisplayMessage(DISPLAY_HIGH_LANE, &NextMsg)
+         && PeekDisplayMessage(DISPLAY_LOW_LANE, &NextMsg)
+         && IsNextWriteBufferRow(&NextMsg, Mode, LastRow) )
+  {
+    RemoveDisplayMessage(DISPLAY_LOW_LANE, &NextMsg);
+    LastRow = WriteMessageRows(&NextMsg, BufferAddress);
+    Options = NextMsg.Options;
+    FreeQueuedMessage(&NextMsg);
+  }
   
-  /* copy the data */
-  unsigned char i;
-  for( i = 0; i < BYTES_PER_LINE; i++)
+  WriteStagedRows();
+  
+  SetBufferStatus(Index, (Options & BUFFER_WRITTEN_MASK) ?
+                  BUFFER_WRITTEN : BUFFER_WRITING);
+  //PrintString("   MY: WriteBuffer done.\r\n");
+}
+
+/* a write buffer message can join the current run when it writes the 
+ * same buffer starting at the row after the last one written 
+ */
+static unsigned char IsNextWriteBufferRow(tMessage* pMsg,
+                                          unsigned char Mode,
+                                          unsigned char LastRow)
+{
+  tSerialRamPayload* pSerialRamPayload;
+  
+  if (   pMsg->Type != WriteBuffer 
+      || (pMsg->Options & BUFFER_SELECT_MASK) != Mode )
   {
-    pWorkingBuffer[3+i] = pSerialRamPayload->pLineA[i];
+    return 0;
   }
   
-  WriteBlockToSram(pWorkingBuffer,15);
+  pSerialRamPayload = (tSerialRamPayload*)GetMessagePayload(pMsg);
+  
+  return ( pSerialRamPayload->RowSelectA == LastRow + 1 );
+}
+
+/* stage one or two rows of a write buffer message and return the last row 
+ * (WriteStagedRows must be called before the buffer is used)
+ */
+static unsigned char WriteMessageRows(tMessage* pMsg,
+                                      unsigned int BufferAddress)
+{
+  /* map the payload */
+  tSerialRamPayload* pSerialRamPayload = 
+    (tSerialRamPayload*)GetMessagePayload(pMsg);
+  
+  unsigned char RowA = pSerialRamPayload->RowSelectA;
+  unsigned char RowB = pSerialRamPayload->RowSelectB;
+  
+  /* add in the row number for the absolute address */
+  StageRow(BufferAddress + (RowA*BYTES_PER_LINE), pSerialRamPayload->pLineA);
   
   /* if the bit is one then only draw one line */
   if ( (pMsg->Options & WRITE_BUFFER_ONE_LINE_MASK) == 0 )
   {
-    /* calculate address for second row */
-    AbsoluteAddress = BufferAddress + (RowB*BYTES_PER_LINE);
-    
-    pWorkingBuffer[0] = SPI_WRITE;
-    pWorkingBuffer[1] = (unsigned char)(AbsoluteAddress >> 8);
-    pWorkingBuffer[2] = (unsigned char) AbsoluteAddress; 
+    StageRow(BufferAddress + (RowB*BYTES_PER_LINE), pSerialRamPayload->pLineB);
+    return RowB;
+  }
   
-    /* copy the data ... */
-    unsigned char i;
-    for(i = 0; i < BYTES_PER_LINE; i++)
-    {
-      pWorkingBuffer[3+i] = pSerialRamPayload->pLineB[i];
-    }
+  return RowA;
+}
+
+/* a screen sent as a run of write buffer messages is written LCD_BURST_LINES
+ * rows per transfer instead of one transfer (and 3 bytes of command) per row
+ */
+static void StageRow(unsigned int Address, unsigned char const * pLine)
+{
+  if (   StagedRows == LCD_BURST_LINES
+      || (   StagedRows 
+          && Address != StagedAddress + StagedRows * BYTES_PER_LINE) )
+  {
+    WriteStagedRows();
+  }
   
-    /* point to first character to dma */
-    WriteBlockToSram(pWorkingBuffer,15);
+  if ( StagedRows == 0 )
+  {
+    StagedAddress = Address;
+  }
+  
+  unsigned char* pData = 
+    &ReadLinesBuffer[READ_DATA_OFFSET + StagedRows * BYTES_PER_LINE];
+  unsigned char i;
+  
+  for ( i = 0; i < BYTES_PER_LINE; i++ )
+  {
+    pData[i] = pLine[i];
+  }
+  
+  StagedRows++;
+}
+
+static void WriteStagedRows(void)
+{
+  if ( StagedRows )
+  {
+    WriteChunkToSram(StagedAddress, StagedRows * BYTES_PER_LINE);
+    StagedRows = 0;
+  }
+}
+
+void WriteBufferPackedHandler(tMessage* pMsg)
+{
+  unsigned char Mode = pMsg->Options & BUFFER_SELECT_MASK;
+  unsigned char* pPayload = GetMessagePayload(pMsg);
+  
+  /* there has to be at least one command after the header */
+  if (   pMsg->Length <= WRITE_BUFFER_PACKED_DATA_INDEX 
+      || pMsg->Length > HOST_MSG_MAX_PAYLOAD_LENGTH )
+  {
+    PrintString("Invalid WriteBufferPacked\r\n");
+    return;
+  }
+  
+  unsigned char StartRow = pPayload[WRITE_BUFFER_PACKED_START_ROW_INDEX];
+  unsigned char RowCount = pPayload[WRITE_BUFFER_PACKED_COUNT_INDEX];
+  
+  if ( RowCount == 0 || StartRow + RowCount > NUM_LCD_ROWS )
+  {
+    PrintString("Invalid WriteBufferPacked\r\n");
+    return;
+  }
+  
+  unsigned char Index = GetBufferIndex(Mode, BUFFER_TYPE_WRITE);
+  
+  unsigned int AbsoluteAddress = 
+    GetBufferAddress(Index) + (StartRow*BYTES_PER_LINE);
+  
+  /* the buffer status does not change when the data is bad (the chunks 
+   * before the bad data have already been written) 
+   */
+  if ( !DecodeToSram(&pPayload[WRITE_BUFFER_PACKED_DATA_INDEX],
+                     &pPayload[pMsg->Length],
+                     AbsoluteAddress,
+                     RowCount * BYTES_PER_LINE,
+                     (pMsg->Options & WRITE_BUFFER_PACKED_XOR_OPTION) != 0) )
+  {
+    PrintString("Invalid WriteBufferPacked data\r\n");
+    return;
   }
   
   SetBufferStatus(Index, (pMsg->Options & BUFFER_WRITTEN_MASK) ?
                   BUFFER_WRITTEN : BUFFER_WRITING);
-  //PrintString("   MY: WriteBuffer done.\r\n");
 }
 
 /* use DMA to write a block of data to the serial ram */
@@ -367,6 +580,27 @@ static void SetupCycle(unsigned int Address,unsigned char CycleType)
  */
 static void WaitForDmaEnd(void)
 {
+  unsigned char Block = 0;
+  
+  unsigned short IntState = __get_interrupt_state();
+  __disable_interrupt();
+  
+  /* a read finishes with dma 1 and a write with dma 0 */
+  unsigned int Remaining = (DMA1CTL & DMAEN) ? DMA1SZ : DMA0SZ;
+  
+  if ( DmaBusy && Remaining > SRAM_DMA_BLOCKING_SIZE )
+  {
+    DmaWaiting = 1;
+    Block = 1;
+  }
+  
+  __set_interrupt_state(IntState);
+  
+  if ( Block )
+  {
+    xSemaphoreTake(DmaDone, portMAX_DELAY);
+  }
+  
   while(DmaBusy);
        
   SRAM_CSN_DEASSERT();
@@ -374,7 +608,9 @@ static void WaitForDmaEnd(void)
   
 }
 
-static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData)
+static void ReadBlock(unsigned char* pWriteData,
+                      unsigned char* pReadData,
+                      unsigned int Size)
 {  
   DmaBusy = 1;
   SRAM_CSN_ASSERT();
@@ -384,8 +620,8 @@ static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData)
    *
    * two DMA channels are used
    * 
-   * read requires 16 total bytes because the shift in of the read data
-   * lags the transmit data by one byte
+   * read requires READ_DATA_OFFSET more bytes than the data because the 
+   * shift in of the read data lags the transmit data by one byte
    */
   
   /* USCIA0 TXIFG is the DMA trigger for DMA0 and RXIFG is the DMA trigger
@@ -394,7 +630,7 @@ static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData)
   DMACTL0 = DMA1TSEL_16 | DMA0TSEL_17;                   
   __data16_write_addr((unsigned short) &DMA0SA,(unsigned long) pWriteData);                                  
   __data16_write_addr((unsigned short) &DMA0DA,(unsigned long) &UCA0TXBUF);
-  DMA0SZ = 15+1;
+  DMA0SZ = Size;
   /* don't enable interrupt for transmit dma done(channel 0) 
    * increment the source address because the message contains the address
    * the other bytes are don't care
@@ -404,7 +640,7 @@ static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData)
   /* receive data is source for dma 1 */
   __data16_write_addr((unsigned short) &DMA1SA,(unsigned long) &UCA0RXBUF);                                  
   __data16_write_addr((unsigned short) &DMA1DA,(unsigned long) pReadData);
-  DMA1SZ = 15+1;
+  DMA1SZ = Size;
   /* increment destination address */
   DMA1CTL = DMADT_0 + DMADSTINCR_3 + DMASBDB + DMALEVEL + DMAIE;  
 
@@ -415,6 +651,148 @@ static void ReadBlock(unsigned char* pWriteData,unsigned char* pReadData)
 }
 
 
+/* start reading up to LCD_BURST_LINES contiguous lines from the serial ram
+ * (WaitForDmaEnd must be called before the lines are used) 
+ *
+ * \return the number of lines that are being read
+ */
+static unsigned char ReadLines(unsigned int Address, unsigned char RowNum)
+{
+  unsigned char Count = ( RowNum > LCD_BURST_LINES ) ? LCD_BURST_LINES : RowNum;
+  
+  if ( Count )
+  {
+    /* the transmitted bytes after the address are don't care so the
+     * same buffer is used for writing and reading (each byte is read by 
+     * the transmit dma before the receive dma writes it)
+     */
+    ReadLinesBuffer[0] = SPI_READ;
+    ReadLinesBuffer[1] = (unsigned char)(Address >> 8); 
+    ReadLinesBuffer[2] = (unsigned char) Address;
+    
+    ReadBlock(ReadLinesBuffer,
+              ReadLinesBuffer,
+              READ_DATA_OFFSET + Count * BYTES_PER_LINE);
+  }
+  
+  return Count;
+}
+
+/* copy one part of the serial ram to another by reading a block into the
+ * working buffer and then writing it back out
+ */
+static void CopyBufferInSram(unsigned int Source,
+                             unsigned int Destination,
+                             unsigned int Size)
+{
+  while ( Size )
+  {
+    unsigned int Chunk = ( Size > LCD_BURST_LINES * BYTES_PER_LINE ) ?
+      LCD_BURST_LINES * BYTES_PER_LINE : Size;
+  
+    ReadLinesBuffer[0] = SPI_READ;
+    ReadLinesBuffer[1] = (unsigned char)(Source >> 8); 
+    ReadLinesBuffer[2] = (unsigned char) Source;
+    
+    ReadBlock(ReadLinesBuffer, ReadLinesBuffer, READ_DATA_OFFSET + Chunk);
+    WaitForDmaEnd();
+    
+    WriteChunkToSram(Destination, Chunk);
+    
+    Source += Chunk;
+    Destination += Chunk;
+    Size -= Chunk;
+  }
+}
+
+/* write the data at READ_DATA_OFFSET in ReadLinesBuffer to the serial ram
+ * (the write command goes in front of the data) 
+ */
+static void WriteChunkToSram(unsigned int Address, unsigned int Size)
+{
+  ReadLinesBuffer[READ_DATA_OFFSET - SPI_OVERHEAD] = SPI_WRITE;
+  ReadLinesBuffer[READ_DATA_OFFSET - 2] = (unsigned char)(Address >> 8);
+  ReadLinesBuffer[READ_DATA_OFFSET - 1] = (unsigned char) Address;
+  
+  WriteBlockToSram(&ReadLinesBuffer[READ_DATA_OFFSET - SPI_OVERHEAD], 
+                   SPI_OVERHEAD + Size);
+}
+
+/* expand data in the template format (see Templates.h) into the serial ram
+ * LCD_BURST_LINES at a time so that a full screen never has to be in ram 
+ *
+ * \param pData is the compressed data 
+ * \param pEnd is the end of the compressed data
+ * \param Address is where the first line goes
+ * \param Size is the number of bytes to write
+ * \param Xor is 1 when the data is xor'ed with what is in the serial ram
+ * \return 1 if all of the bytes were written, 0 if the data was bad (the 
+ * chunks before the bad data are written)
+ */
+static unsigned char DecodeToSram(unsigned char const * pData,
+                                  unsigned char const * pEnd,
+                                  unsigned int Address,
+                                  unsigned int Size,
+                                  unsigned char Xor)
+{
+  tTemplateDecoder Decoder;
+  
+  InitTemplateDecoder(&Decoder, pData, pEnd);
+  
+  while ( Size )
+  {
+    unsigned char Chunk = ( Size > LCD_BURST_LINES * BYTES_PER_LINE ) ?
+      LCD_BURST_LINES * BYTES_PER_LINE : Size;
+    
+    if ( Xor )
+    {
+      ReadLinesBuffer[0] = SPI_READ;
+      ReadLinesBuffer[1] = (unsigned char)(Address >> 8); 
+      ReadLinesBuffer[2] = (unsigned char) Address;
+      ReadBlock(ReadLinesBuffer, ReadLinesBuffer, READ_DATA_OFFSET + Chunk);
+      WaitForDmaEnd();
+    }
+    
+    if ( !DecodeTemplate(&Decoder, 
+                         &ReadLinesBuffer[READ_DATA_OFFSET], 
+                         Chunk, 
+                         Xor) )
+    {
+      return 0;
+    }
+    
+    WriteChunkToSram(Address, Chunk);
+    Address += Chunk;
+    Size -= Chunk;
+  }
+  
+  return 1;
+}
+
+/* the rows that the panel already shows are left out
+ *
+ * \return the number of lines in the burst 
+ */
+static unsigned char CopyLinesToBurst(tLcdBurst* pBurst,
+                                      unsigned char StartRow,
+                                      unsigned char Count)
+{
+  unsigned char* pData = &ReadLinesBuffer[READ_DATA_OFFSET];
+  unsigned char Lines = 0;
+  unsigned char i;
+  
+  for ( i = 0; i < Count; i++ )
+  {
+    Lines += AddLcdBurstLine(pBurst, Lines, StartRow + i, pData);
+    pData += BYTES_PER_LINE;
+  }
+  
+  gAppStats.LcdRowsSent += Lines;
+  gAppStats.LcdRowsSkipped += Count - Lines;
+  
+  return Lines;
+}
+
 static void ClearMemory(void)
 {  
   DmaBusy = 1;
@@ -430,7 +808,7 @@ static void ClearMemory(void)
   __data16_write_addr((unsigned short) &DMA0DA,(unsigned long) &UCA0TXBUF);
              
   /* write the entire serial ram with zero */
-  DMA0SZ = 8192;
+  DMA0SZ = SerialRamSize;
   
   /* 
    * single transfer, source byte and dest byte,
@@ -466,42 +844,92 @@ void UpdateDisplayHandler(tMessage* pMsg)
   }
   else if (pMsg->Length)
   {
-    Rect_t *pRect = (Rect_t *)pMsg->pBuffer;
+    Rect_t *pRect = (Rect_t *)GetMessagePayload(pMsg);
     if (pRect->StartRow < NUM_LCD_ROWS) StartRow = pRect->StartRow;
     if (pRect->RowNum && pRect->RowNum + StartRow < NUM_LCD_ROWS) RowNum = pRect->RowNum;
   }
-  PrintStringSpaceAndThreeDecimals("UPD msglen: start: num: ", pMsg->Length, StartRow, RowNum);
+  TraceEvent(TRACE_UPDATE_DISPLAY, pMsg->Length, (StartRow << 8) | RowNum);
   
   /* now calculate the absolute address */
   unsigned int AbsoluteAddress = GetBufferAddress(Index) + BYTES_PER_LINE * StartRow;
        
-  while (RowNum --)
+  /* 
+   * The lines are sent to the lcd LCD_BURST_LINES at a time with one write
+   * command.  The serial ram (UCA0, dma 0 and 1) and the lcd (UCB, dma 2) 
+   * are on different buses so the next lines are read (and copied into the
+   * other burst) while the current burst is being written to the lcd.
+   */
+  unsigned char Current = 0;
+  unsigned char Count = ReadLines(AbsoluteAddress, RowNum);
+  unsigned char Lines = 0;
+  
+  if ( Count )
   {
-    /* one buffer is used for writing and another is used for reading 
-     * the incoming message can't be used because it doesn't have a buffer
-     */
-    pWorkingBuffer[0] = SPI_READ;
-    pWorkingBuffer[1] = (unsigned char)(AbsoluteAddress >> 8); 
-    pWorkingBuffer[2] = (unsigned char) AbsoluteAddress;
-    
-    /* 
-     * The tLcdMessagePayload accounts for the
-     * 3+1 spots to starting location of data from dma read
-     * (room for bytes read in when cmd and address are sent)
-     */
-    ReadBlock(pWorkingBuffer,(unsigned char *)&WriteLineBuffer);    
     WaitForDmaEnd();
-
-    /* now add the row number */
-    WriteLineBuffer.RowNumber = StartRow ++;
-    WriteLcdHandler(&WriteLineBuffer);
+    Lines = CopyLinesToBurst(&LcdBurst[Current], StartRow, Count);
+  }
+  
+  while ( Count )
+  {
+    RowNum -= Count;
+    StartRow += Count;
+    AbsoluteAddress += Count * BYTES_PER_LINE;
+    
+    unsigned char Next = ReadLines(AbsoluteAddress, RowNum);
+    unsigned char NextLines = 0;
+    
+    /* a burst can be empty when none of its rows changed */
+    if ( Lines )
+    {
+      StartLcdBurstWrite(&LcdBurst[Current], Lines);
+    }
     
-    AbsoluteAddress += BYTES_PER_LINE;
+    if ( Next )
+    {
+      WaitForDmaEnd();
+      NextLines = CopyLinesToBurst(&LcdBurst[1 - Current], StartRow, Next);
+    }
+    
+    if ( Lines )
+    {
+      WaitForLcdLineWrite();
+    }
+    
+    Current = 1 - Current;
+    Count = Next;
+    Lines = NextLines;
   }
   
   //PrintStringSpaceAndTwoDecimals("UPD end:", StartRow - 1, RowNum);
   SetBufferStatus(Index, BUFFER_CLEAN);
-  PrintStringAndTwoHexBytes("AF Buffers: ", BufferStatus[Mode][0], BufferStatus[Mode][1]);
+  
+  /* 
+   * start the other buffer with what is on the screen so that the phone 
+   * only has to write the rows that change (the draw buffer is marked as 
+   * writing so that it is the next one written and read) 
+   */
+  unsigned char DrawIndex = GetDrawBufferIndex(Index);
+  
+  if (   (pMsg->Options & UPDATE_COPY_MASK) == COPY_ACTIVE_TO_DRAW_DURING_UPDATE
+      && DrawIndex != BUFFER_UNAVAILABLE )
+  {
+    unsigned int Offset = BYTES_PER_LINE * GetStartingRow(Mode);
+    unsigned int Size = BYTES_PER_SCREEN - Offset;
+    
+    /* scroll buffers are half the size of normal buffers */
+    if ( Mode >= SCROLL_BUFFER_SELECT )
+    {
+      Size = BYTES_PER_SCREEN >> 1;
+    }
+    
+    CopyBufferInSram(GetBufferAddress(Index) + Offset,
+                     GetBufferAddress(DrawIndex) + Offset,
+                     Size);
+    
+    SetBufferStatus(DrawIndex, BUFFER_WRITING);
+  }
+  
+  TraceEvent(TRACE_BUFFER_STATUS, Mode, GetBufferStatusTrace(Mode));
   
   /* now that the screen has been drawn put the LCD into a lower power mode */
   PutLcdIntoStaticMode();  
@@ -519,21 +947,26 @@ void LoadTemplateHandler(tMessage* pMsg)
   /* now calculate the absolute address */
   unsigned int AbsoluteAddress = GetBufferAddress(Index);
   
-  /* 
-   * templates don't have extra space in them for additional 3 bytes of 
-   * cmd and address
-   */
-  SetupCycle(AbsoluteAddress,SPI_WRITE);
-
-  tLoadTemplatePayload* pLoadTemplateMsg = (tLoadTemplatePayload*)pMsg->pBuffer;
+  tLoadTemplatePayload* pLoadTemplateMsg = 
+    (tLoadTemplatePayload*)GetMessagePayload(pMsg);
    
-  /* template zero is reserved for simple patterns */
-  if ( pLoadTemplateMsg->TemplateSelect > 1 )
+  /* templates zero and one are reserved for simple patterns */
+  if ( pLoadTemplateMsg->TemplateSelect >= FIRST_FLASH_TEMPLATE )
   {
+    unsigned int Size = 0;
     unsigned char const * pTemplate = 
-      GetTemplatePointer(pLoadTemplateMsg->TemplateSelect);
-  
-    WriteBlockToSram((unsigned char*)pTemplate,BYTES_PER_SCREEN);
+      GetTemplatePointer(pLoadTemplateMsg->TemplateSelect, &Size);
+  
+    if (   pTemplate == NULL 
+        || !DecodeToSram(pTemplate, 
+                         pTemplate + Size, 
+                         AbsoluteAddress, 
+                         BYTES_PER_SCREEN, 
+                         0) )
+    {
+      PrintString("Invalid Template\r\n");
+      return;
+    }
   }
   else
   {
@@ -551,54 +984,122 @@ void LoadTemplateHandler(tMessage* pMsg)
   SetBufferStatus(Index, BUFFER_WRITING);
 }
 
-/* determine if the phone is controlling all of the idle screen */
-unsigned char GetStartingRow(unsigned char Mode)
-{
-  return (Mode == IDLE_BUFFER_SELECT &&
-    GetIdleBufferConfiguration() == WATCH_CONTROLS_TOP) ? 30 : 0;
-}
-
-unsigned char GetBufferIndex(unsigned char Mode, unsigned char Type)
+void CachedPageHandler(tMessage* pMsg)
 {
-  unsigned char j, i;
-  unsigned char NumberOfRules = (Type == BUFFER_TYPE_READ) ?
-    NUMBER_OF_READ_BUFFER_SEL_RULES : NUMBER_OF_WRITE_BUFFER_SEL_RULES;
+  unsigned char Mode = pMsg->Options & BUFFER_SELECT_MASK;
+  unsigned char Page = GetMessagePayload(pMsg)[CACHED_PAGE_INDEX];
   
-  //PrintStringSpaceAndTwoDecimals("----- MY: GetBufferIndex: Mode, Type: ", Mode, Type);
-  for (j = 0; j < NumberOfRules; j++)
+  if ( Page >= NumberOfCachedPages || Mode >= SCROLL_BUFFER_SELECT )
   {
-    for (i = 0; i < NUMBER_OF_BUFFERS; i++)
+    PrintStringAndDecimal("Invalid Cached Page: ", Page);
+    return;
+  }
+  
+  unsigned int PageAddress = CachedPagesAddress + Page * BYTES_PER_SCREEN;
+  unsigned char Index;
+  
+  switch ( pMsg->Options & CACHED_PAGE_OPERATION_MASK )
+  {
+  case CACHED_PAGE_SAVE:
+    /* the buffer that was written or displayed last */
+    Index = GetRecentBufferIndex(Mode);
+    CopyBufferInSram(GetBufferAddress(Index), PageAddress, BYTES_PER_SCREEN);
+    break;
+    
+  case CACHED_PAGE_LOAD:
+  case CACHED_PAGE_SHOW:
+    Index = GetBufferIndex(Mode, BUFFER_TYPE_WRITE);
+    CopyBufferInSram(PageAddress, GetBufferAddress(Index), BYTES_PER_SCREEN);
+    SetBufferStatus(Index, BUFFER_WRITTEN);
+    
+    if ( (pMsg->Options & CACHED_PAGE_OPERATION_MASK) == CACHED_PAGE_SHOW )
     {
-      if ((BufferStatus[Mode][i] & BUFFER_STATUS_MASK) == BufSelRule[Type][j]) {
-        //PrintStringAndHexByte("    MY: Rule j: ", j);
-        return (Mode << 1) + i;
-      }
+      SetupMessage(&OutgoingMsg, UpdateDisplay, Mode);
+      RouteWatchMsg(&OutgoingMsg);
     }
+    break;
+    
+  default:
+    PrintString("Invalid Cached Page Operation\r\n");
+    break;
   }
-
-  return (BufferStatus[Mode][0] & BUFFER_STATUS_RECENT) ? Mode << 1 : (Mode << 1) + 1;
 }
 
-void SetBufferStatus(unsigned char Index, unsigned char Status)
+/* determine if the phone is controlling all of the idle screen */
+unsigned char GetStartingRow(unsigned char Mode)
 {
-  //[Mode][0|1]
-  // Mark the buffer "current" and remove the "current" flag of the other buffer
-  BufferStatus[Index >> 1][Index & 1] = Status | BUFFER_STATUS_RECENT;
-  BufferStatus[Index >> 1][1 - (Index & 1)] &= BUFFER_STATUS_MASK;
+  return (Mode == IDLE_BUFFER_SELECT &&
+    GetIdleBufferConfiguration() == WATCH_CONTROLS_TOP) ? 30 : 0;
 }
 
 unsigned int GetBufferAddress(unsigned char Index)
 {
-  unsigned int Address = BYTES_PER_SCREEN * Index;
+  return BufferAddress[Index >> 2][Index & 0x03];
+}
+
+/* hand out the next region of the serial ram
+ *
+ * \return the address of the region or SERIAL_RAM_FULL when it doesn't fit
+ */
+static unsigned int AllocateSerialRam(unsigned int Size)
+{
+  unsigned int Address = SerialRamUsed;
   
-  /* if mode is scroll, scroll buffers are half the size of normal buffers */
-  if ( (Index >> 1) >= SCROLL_BUFFER_SELECT )
+  if ( Size > SerialRamSize - SerialRamUsed )
   {
-    Address -= BYTES_PER_SCREEN >> 1;     
+    return SERIAL_RAM_FULL;
   }
   
+  SerialRamUsed += Size;
   return Address;
 }
+
+/* lay out the display buffers and then the cached pages 
+ *
+ * \param pBuffersPerMode is the number of display buffers of each mode
+ * \return 1 if the display buffers fit in the part
+ */
+static unsigned char MapSerialRam(unsigned char const * pBuffersPerMode)
+{
+  unsigned char Mode;
+  unsigned char i;
+  
+  SerialRamUsed = 0;
+  
+  for ( Mode = 0; Mode < NUMBER_OF_MODES; Mode++ )
+  {
+    unsigned int Size = ( Mode >= SCROLL_BUFFER_SELECT ) ? 
+      BYTES_PER_SCREEN >> 1 : BYTES_PER_SCREEN;
+    
+    if (   pBuffersPerMode[Mode] < NUMBER_OF_BUFFERS 
+        || pBuffersPerMode[Mode] > MAX_NUMBER_OF_BUFFERS )
+    {
+      return 0;
+    }
+    
+    for ( i = 0; i < pBuffersPerMode[Mode]; i++ )
+    {
+      BufferAddress[Mode][i] = AllocateSerialRam(Size);
+      
+      if ( BufferAddress[Mode][i] == SERIAL_RAM_FULL )
+      {
+        return 0;
+      }
+    }
+  }
+  
+  InitDisplayBuffers(pBuffersPerMode);
+  
+  CachedPagesAddress = SerialRamUsed;
+  NumberOfCachedPages = 0;
+  
+  while ( AllocateSerialRam(BYTES_PER_SCREEN) != SERIAL_RAM_FULL )
+  {
+    NumberOfCachedPages++;
+  }
+  
+  return 1;
+}
       
 /* Serial RAM controller uses two dma channels
  * LCD driver task uses one dma channel
@@ -610,23 +1111,58 @@ unsigned int GetBufferAddress(unsigned char Index)
 #pragma vector=DMA_VECTOR
 __interrupt void DMA_ISR(void)
 {
+  unsigned char ExitLpm = 0;
+  signed portBASE_TYPE HigherPriorityTaskWoken = pdFALSE;
+  
   /* 0 is no interrupt and remainder are channels 0-7 */
   switch(__even_in_range(DMAIV,16))
   {
   case 0: 
     break;
   case 2: 
-    DmaBusy = 0;
+    ExitLpm = SerialRamDmaIsr(&HigherPriorityTaskWoken);
     break;
   case 4:
-    DmaBusy = 0;
+    ExitLpm = SerialRamDmaIsr(&HigherPriorityTaskWoken);
     break;
   case 6:
-    LcdDmaIsr();
+    ExitLpm = LcdDmaIsr(&HigherPriorityTaskWoken);
     break;
   default: 
     break;
   }
+  
+  /* 
+   * While the tick runs a woken task would wait for the next tick (up to 
+   * 1 ms) so switch to it now.  When the tick is off the part is asleep in 
+   * the idle task and must not switch out of low power mode; waking up 
+   * starts the tick, which runs the task (see EnterLpm3).
+   */
+  if ( HigherPriorityTaskWoken && QuerySchedulerState() )
+  {
+    portYIELD();
+  }
+  else if ( ExitLpm )
+  {
+    EXIT_LPM_ISR();
+  }
+}
+
+/* the semaphore is only given when the task is waiting on it */
+static unsigned char SerialRamDmaIsr(signed portBASE_TYPE* pTaskWoken)
+{
+  unsigned char ExitLpm = 0;
+  
+  DmaBusy = 0;
+  
+  if ( DmaWaiting )
+  {
+    DmaWaiting = 0;
+    xSemaphoreGiveFromISR(DmaDone, pTaskWoken);
+    ExitLpm = 1;
+  }
+  
+  return ExitLpm;
 }
 
 
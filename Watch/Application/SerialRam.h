@@ -38,9 +38,20 @@ void UpdateDisplayHandler(tMessage* pMsg);
 /*! Handle the load template message */
 void LoadTemplateHandler(tMessage* pMsg);
 
-/*! Handle the write buffer message */
+/*! Save, load or show a page that is cached in the serial ram */
+void CachedPageHandler(tMessage* pMsg);
+
+/*! Handle the write buffer message.  Write buffer messages to the following
+ * rows of the same buffer that are waiting in the display queue are written
+ * at the same time.
+ */
 void WriteBufferHandler(tMessage* pMsg);
 
+/*! Handle the write buffer packed message.  The rows are decompressed as they
+ * are written to the serial ram.
+ */
+void WriteBufferPackedHandler(tMessage* pMsg);
+
 
 void RamTestHandler(tMessage* pMsg);
 
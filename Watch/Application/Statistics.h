@@ -55,6 +55,18 @@ typedef struct
  *
  * \param BufferPoolFailure indicates that a buffer was not available when a task
  * requested it.
+ *
+ * \param CoalescedIdleUpdates is the number of IdleUpdate messages that were
+ * dropped because an equivalent update was already pending (counter)
+ *
+ * \param CoalescedUpdateDisplays is the number of UpdateDisplay messages that
+ * were merged into the previous UpdateDisplay for the same mode (counter)
+ *
+ * \param LcdRowsSent is the number of rows sent from the serial ram to the
+ * LCD (counter)
+ *
+ * \param LcdRowsSkipped is the number of rows that were not sent from the
+ * serial ram to the LCD because the panel already showed them (counter)
  */
 typedef struct
 {
@@ -62,6 +74,10 @@ typedef struct
   unsigned char BufferPoolFailure;
   unsigned char QueueOverflow;
   unsigned char FllFailure;
+  unsigned int CoalescedIdleUpdates;
+  unsigned int CoalescedUpdateDisplays;
+  unsigned long LcdRowsSent;
+  unsigned long LcdRowsSkipped;
   
 } tApplicationStatistics;
 
@@ -0,0 +1,164 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file Templates.c
+*
+* Templates are generated from 96 x 96 images with Tools/PbmTemplate.  Bit 0
+* of the first byte of a line is the leftmost pixel.
+*/
+/******************************************************************************/
+
+#include <string.h>
+
+#include "Templates.h"
+
+/* a one pixel border */
+static const unsigned char pFrameTemplate[] =
+{
+  0x8B,0xFF,0x00,0x01,0x89,0x00,0x00,0x80,0xFF,0xDC,0x8B,0xFF
+};
+
+/* a one pixel border with a line under the watch controlled part of the 
+ * idle screen 
+ */
+static const unsigned char pSplitFrameTemplate[] =
+{
+  0x8B,0xFF,0x00,0x01,0x89,0x00,0x00,0x80,0xDB,0x8B,0xFF,0x00,
+  0x01,0x89,0x00,0x00,0x80,0xFE,0x8B,0xFF
+};
+
+typedef struct
+{
+  unsigned char const * pData;
+  unsigned int Size;
+  
+} tTemplate;
+
+static const tTemplate Templates[] =
+{
+  { pFrameTemplate,      sizeof(pFrameTemplate)      },
+  { pSplitFrameTemplate, sizeof(pSplitFrameTemplate) },
+};
+
+#define NUMBER_OF_FLASH_TEMPLATES ( sizeof(Templates) / sizeof(Templates[0]) )
+
+unsigned char const * GetTemplatePointer(unsigned char TemplateSelect,
+                                         unsigned int* pSize)
+{
+  if (   TemplateSelect < FIRST_FLASH_TEMPLATE 
+      || TemplateSelect - FIRST_FLASH_TEMPLATE >= NUMBER_OF_FLASH_TEMPLATES )
+  {
+    return NULL;
+  }
+  
+  *pSize = Templates[TemplateSelect - FIRST_FLASH_TEMPLATE].Size;
+  return Templates[TemplateSelect - FIRST_FLASH_TEMPLATE].pData;
+}
+
+void InitTemplateDecoder(tTemplateDecoder* pDecoder,
+                         unsigned char const * pData,
+                         unsigned char const * pEnd)
+{
+  memset(pDecoder, 0, sizeof(tTemplateDecoder));
+  pDecoder->pData = pData;
+  pDecoder->pEnd = pEnd;
+  pDecoder->Command = TEMPLATE_LITERAL;
+}
+
+/* read the next command (the data it needs has to be there) */
+static unsigned char StartCommand(tTemplateDecoder* pDecoder)
+{
+  unsigned char const * pData = pDecoder->pData;
+  unsigned char const * pEnd = pDecoder->pEnd;
+  
+  if ( pData >= pEnd )
+  {
+    return 0;
+  }
+  
+  unsigned char Command = *pData++;
+  unsigned int Count = (Command & TEMPLATE_LENGTH_MASK) + 1;
+  
+  switch ( Command & TEMPLATE_COMMAND_MASK )
+  {
+  case TEMPLATE_LITERAL:
+    if ( (unsigned int)(pEnd - pData) < Count )
+    {
+      return 0;
+    }
+    break;
+  case TEMPLATE_RUN:
+    if ( pData >= pEnd )
+    {
+      return 0;
+    }
+    pDecoder->Run = *pData++;
+    break;
+  case TEMPLATE_REPEAT_LINE:
+    Count *= TEMPLATE_BYTES_PER_LINE;
+    break;
+  default:
+    return 0;
+  }
+  
+  pDecoder->pData = pData;
+  pDecoder->Command = Command;
+  pDecoder->Count = Count;
+  return 1;
+}
+
+unsigned char DecodeTemplate(tTemplateDecoder* pDecoder,
+                             unsigned char* pOut,
+                             unsigned int Size,
+                             unsigned char Xor)
+{
+  unsigned char* pLine = pDecoder->Line;
+  unsigned int i;
+  
+  for ( i = 0; i < Size; i++ )
+  {
+    if ( pDecoder->Count == 0 && !StartCommand(pDecoder) )
+    {
+      return 0;
+    }
+    
+    switch ( pDecoder->Command & TEMPLATE_COMMAND_MASK )
+    {
+    case TEMPLATE_LITERAL:
+      pLine[pDecoder->Column] = *pDecoder->pData++;
+      break;
+    case TEMPLATE_RUN:
+      pLine[pDecoder->Column] = pDecoder->Run;
+      break;
+    default:
+      /* repeat what is already in the line */
+      break;
+    }
+    pDecoder->Count--;
+    
+    pOut[i] = Xor ? pOut[i] ^ pLine[pDecoder->Column] 
+                  : pLine[pDecoder->Column];
+    
+    if ( ++pDecoder->Column == TEMPLATE_BYTES_PER_LINE )
+    {
+      pDecoder->Column = 0;
+    }
+  }
+  
+  return 1;
+}
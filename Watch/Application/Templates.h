@@ -0,0 +1,110 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file Templates.h
+ *
+ * Templates are compressed screen backgrounds that are stored in flash. 
+ * A template is expanded into a serial ram buffer by LoadTemplate.
+ * This is for the LCD only.
+ *
+ * Templates are a list of commands.  A command is one byte followed by its 
+ * data.  Commands are applied until a full screen (96 lines of 12 bytes) 
+ * has been written.  WriteBufferPacked messages use the same format for 
+ * the rows that they write.
+ */
+/******************************************************************************/
+
+#ifndef TEMPLATES_H
+#define TEMPLATES_H
+
+/* template 0 clears the screen and template 1 fills it */
+#define FIRST_FLASH_TEMPLATE ( 2 )
+
+#define TEMPLATE_BYTES_PER_LINE ( 12 )
+
+#define TEMPLATE_COMMAND_MASK   ( 0xC0 )
+#define TEMPLATE_LENGTH_MASK    ( 0x3F )
+
+/*! Literal: the next (Length + 1) bytes are copied */
+#define TEMPLATE_LITERAL        ( 0x00 )
+
+/*! Run: the next byte is repeated (Length + 1) times */
+#define TEMPLATE_RUN            ( 0x80 )
+
+/*! Repeat line: the last line that was written is repeated (Length + 1) 
+ * times.  This has no data. 
+ */
+#define TEMPLATE_REPEAT_LINE    ( 0xC0 )
+
+/*! The state of a decode that is done a part at a time
+ *
+ * \param pData is the next byte of the compressed data
+ * \param pEnd is the end of the compressed data
+ * \param Line is the last line that was written (for TEMPLATE_REPEAT_LINE)
+ * \param Column is the position in Line
+ * \param Command is the command that is being applied
+ * \param Run is the byte of a TEMPLATE_RUN
+ * \param Count is the number of bytes left in the command
+ */
+typedef struct
+{
+  unsigned char const * pData;
+  unsigned char const * pEnd;
+  unsigned char Line[TEMPLATE_BYTES_PER_LINE];
+  unsigned char Column;
+  unsigned char Command;
+  unsigned char Run;
+  unsigned int Count;
+  
+} tTemplateDecoder;
+
+/*! Start decoding compressed data.  The first line starts out blank.
+ *
+ * \param pDecoder is the decoder state
+ * \param pData is the compressed data
+ * \param pEnd is the end of the compressed data
+ */
+void InitTemplateDecoder(tTemplateDecoder* pDecoder,
+                         unsigned char const * pData,
+                         unsigned char const * pEnd);
+
+/*! Decode the next bytes.  Commands never read past the end of the data.
+ *
+ * \param pDecoder is the decoder state
+ * \param pOut is where the bytes are written
+ * \param Size is the number of bytes
+ * \param Xor is 1 when the bytes are xor'ed with what is already in pOut
+ * \return 1 if all of the bytes were decoded, 0 if the data ran out or has
+ * a bad command (the bytes before that are written)
+ */
+unsigned char DecodeTemplate(tTemplateDecoder* pDecoder,
+                             unsigned char* pOut,
+                             unsigned int Size,
+                             unsigned char Xor);
+
+/*! Get the compressed data of a flash template
+ *
+ * \param TemplateSelect is the template number (starting at 
+ * FIRST_FLASH_TEMPLATE)
+ * \param pSize is set to the number of bytes in the template
+ * \return a pointer to the template or NULL if there isn't one
+ */
+unsigned char const * GetTemplatePointer(unsigned char TemplateSelect,
+                                         unsigned int* pSize);
+
+#endif /*TEMPLATES_H*/
@@ -71,7 +71,7 @@ void SetVibrateModeHandler(tMessage* pMsg)
 
   // overlay a structure pointer on the data section
   tSetVibrateModePayload* pMsgData;
-  pMsgData = (tSetVibrateModePayload*) pMsg->pBuffer;
+  pMsgData = (tSetVibrateModePayload*) GetMessagePayload(pMsg);
 
   // set it active or cancel it
   VibeEventActive = pMsgData->Enable;
@@ -131,6 +131,7 @@ static unsigned char AllTaskQueuesEmptyFlag;
 
 void vApplicationIdleHook(void)
 {
+  DrainTrace();
 
   /* Put the processor to sleep if the serial port indicates it is OK and
    * all of the queues are empty.
@@ -37,6 +37,13 @@
 /*! number of buffers in the message buffer pool */
 #define NUM_MSG_BUFFERS 20
 
+/* DIGIT_CACHE_ENTRIES (set for each board below) is the number of entries 
+ * of pre-shifted clock digits kept by LcdText.c.  Each entry costs about 
+ * 580 bytes of RAM and three cover the idle screen; fewer than three would
+ * replace each other every second.  The analog watch does not draw with 
+ * LcdText.c.
+ */
+
 /******************************************************************************/
 
 #if defined(HW_DEVBOARD_V2)
@@ -45,8 +52,10 @@
 
   #ifdef ANALOG
     #define SPP_DEVICE_NAME "MetaWatch Analog Development Board"
+    #define DIGIT_CACHE_ENTRIES ( 0 )
   #elif defined(DIGITAL)
     #define SPP_DEVICE_NAME "MetaWatch Digital Development Board"
+    #define DIGIT_CACHE_ENTRIES ( 3 )
   #else
     #error "ANALOG or DIGITAL not defined"
   #endif
@@ -58,12 +67,14 @@
     #include "hal_digital_v2_defs.h"
 
     #define SPP_DEVICE_NAME "MetaWatch Digital WDS112"
+    #define DIGIT_CACHE_ENTRIES ( 3 )
 
   #elif defined(ANALOG)
 
     #include "hal_analog_v2_defs.h"
 
     #define SPP_DEVICE_NAME "MetaWatch Analog WDS111"
+    #define DIGIT_CACHE_ENTRIES ( 0 )
 
   #else
 
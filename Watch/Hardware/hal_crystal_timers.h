@@ -60,4 +60,12 @@ void StartCrystalTimer(unsigned char TimerId,
  */
 void StopCrystalTimer(unsigned char TimerId);
 
+/*! \return the free running count of the timer shared by the rtos tick and 
+ * the crystal timers.  It counts at 1024 Hz (0.9765625 ms) and does not 
+ * advance when the rtos tick and all of the crystal timers are off.
+ *
+ * \note Safe to call in interrupt context
+ */
+unsigned int ReadCrystalTimerCount(void);
+
 #endif /* HAL_CRYSTAL_TIMERS */
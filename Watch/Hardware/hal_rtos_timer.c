@@ -189,6 +189,11 @@ void StopCrystalTimer(unsigned char TimerId)
   RemoveUser(TimerId);  
 }
 
+unsigned int ReadCrystalTimerCount(void)
+{
+  return TA0R;  
+}
+
 /* 
  * timer0 ccr0 has its own interrupt (TIMER0_A0) 
  */
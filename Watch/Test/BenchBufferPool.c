@@ -0,0 +1,101 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchBufferPool.c
+ *
+ * The time to allocate and free a message buffer with the free list and 
+ * with the queue of pointers it replaced.  This is not run by the tests 
+ * (make bench).  The times are for the host cpu only; they show relative 
+ * cost, not MSP430 cycles.
+ */
+/******************************************************************************/
+
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "hal_board_type.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "ReferenceBufferPool.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 1000000 )
+
+typedef unsigned char* (*tAlloc)(void);
+typedef void (*tFree)(unsigned char* pBuffer);
+
+static unsigned char* pBuffers[NUM_MSG_BUFFERS];
+
+/* \return the host time of one allocation and free in ns 
+ *
+ * \param Depth is the number of buffers that are allocated before they are 
+ * freed (1 is a message that is freed right away)
+ */
+static double Time(tAlloc pAlloc, tFree pFree, unsigned char Depth)
+{
+  unsigned int Round;
+  unsigned char i;
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS / Depth; Round++ )
+  {
+    for ( i = 0; i < Depth; i++ )
+    {
+      pBuffers[i] = pAlloc();
+    }
+    
+    for ( i = 0; i < Depth; i++ )
+    {
+      pFree(pBuffers[i]);
+    }
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  return Seconds * 1e9 / ((ROUNDS / Depth) * Depth);
+}
+
+int main(void)
+{
+  static const unsigned char Depths[] = { 1, 4, NUM_MSG_BUFFERS };
+  unsigned char i;
+  
+  InitializeBufferPool();
+  ReferenceInitializeBufferPool();
+  
+  for ( i = 0; i < sizeof(Depths); i++ )
+  {
+    double Queue = Time(ReferenceAllocMessageBuffer, 
+                        ReferenceFreeMessageBuffer,
+                        Depths[i]);
+    
+    double List = Time(BPL_AllocMessageBuffer, 
+                       BPL_FreeMessageBuffer,
+                       Depths[i]);
+    
+    printf("%2u buffers at a time   queue %6.1f ns, free list %6.1f ns (host)\n",
+           Depths[i], Queue, List);
+  }
+  
+  CHECK_EQUAL(0, HostWatchdogResets());
+  return HostTestResult("BenchBufferPool");
+}
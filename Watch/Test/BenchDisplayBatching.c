@@ -0,0 +1,299 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchDisplayBatching.c
+ *
+ * How often the display and background tasks redraw, do their bookkeeping
+ * and change the led for the same messages, one message at a time (as 
+ * before) and in batches with the waiting messages merged (as now).  The 
+ * queues are filled before the task runs, as when it is busy drawing.  The
+ * counts do not depend on the host; the times are for the host cpu only and
+ * show relative cost, not MSP430 cycles.  This is not run by the tests 
+ * (make bench).
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "LcdCoalesce.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 1000 )
+
+/* DISPLAY_TASK_BATCH_LENGTH in LcdDisplay.c */
+#define BATCH_LENGTH ( 8 )
+
+/* a screen upload is 8 buffer writes and an update, the application then 
+ * updates the same rows 3 times; the rtc is ready every round and the phone
+ * asks for a full idle update every 4th round
+ */
+#define WRITES_PER_ROUND  ( 8 )
+#define UPDATES_PER_ROUND ( 3 )
+#define LED_RUN_LENGTH    ( 6 )
+
+typedef struct
+{
+  unsigned long Messages;
+  unsigned long Redraws;
+  unsigned long Bookkeeping;
+  double Seconds;
+} tDisplayCount;
+
+typedef struct
+{
+  unsigned long Messages;
+  unsigned long LedWrites;
+  unsigned long TimerChanges;
+} tLedCount;
+
+static void FillDisplayQueue(unsigned int Round, unsigned char Batched)
+{
+  tMessage Msg;
+  unsigned char i;
+  
+  for ( i = 0; i < WRITES_PER_ROUND; i++ )
+  {
+    SetupMessageAndAllocateBuffer(&Msg, WriteBuffer, APPLICATION_MODE);
+    Msg.Length = sizeof(tSerialRamPayload);
+    RouteMsg(&Msg);
+  }
+  
+  for ( i = 0; i < 1 + UPDATES_PER_ROUND; i++ )
+  {
+    SetupMessageWithInlinePayload(&Msg, UpdateDisplay, APPLICATION_MODE);
+    RouteMsg(&Msg);
+  }
+  
+  /* before, the rtc isr sent its update every time */
+  if ( !Batched || !QueryRtcIdleUpdatePending() )
+  {
+    SetupMessage(&Msg, IdleUpdate, RTC_DATE_TIME_ONLY);
+    SetRtcIdleUpdatePending(
+      SendMessageToQueueFromIsr(DISPLAY_QINDEX, &Msg));
+  }
+  
+  if ( (Round & 3) == 3 )
+  {
+    SetupMessage(&Msg, IdleUpdate, IDLE_FULL_UPDATE);
+    RouteMsg(&Msg);
+  }
+}
+
+static void HandleDisplayMessage(tMessage* pMsg, tDisplayCount* pCount)
+{
+  pCount->Messages++;
+  
+  if ( pMsg->Type == UpdateDisplay || pMsg->Type == IdleUpdate )
+  {
+    pCount->Redraws++;
+  }
+  
+  SendToFreeQueue(pMsg);
+}
+
+/* the display task loop before the batching */
+static void DrainOneAtATime(tDisplayCount* pCount)
+{
+  tMessage Msg;
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    HandleDisplayMessage(&Msg, pCount);
+    pCount->Bookkeeping++;
+  }
+  
+  SetRtcIdleUpdatePending(0);
+}
+
+/* the display task loop in LcdDisplay.c */
+static void DrainBatched(tDisplayCount* pCount)
+{
+  tMessage Msg;
+  unsigned char Lane = ReceiveDisplayMessage(&Msg, DONT_WAIT);
+  
+  while ( Lane != DISPLAY_NO_MESSAGE )
+  {
+    unsigned char Count = 0;
+    
+    while ( Lane != DISPLAY_NO_MESSAGE )
+    {
+      CoalesceDisplayMessages(&Msg, Lane);
+      HandleDisplayMessage(&Msg, pCount);
+      
+      if ( ++Count < BATCH_LENGTH )
+      {
+        Lane = ReceiveDisplayMessage(&Msg, DONT_WAIT);
+      }
+      else
+      {
+        Lane = DISPLAY_NO_MESSAGE;
+      }
+    }
+    
+    pCount->Bookkeeping++;
+    Lane = ReceiveDisplayMessage(&Msg, DONT_WAIT);
+  }
+}
+
+static void CountDisplay(unsigned char Batched, tDisplayCount* pCount)
+{
+  unsigned int Round;
+  
+  memset(pCount, 0, sizeof(tDisplayCount));
+  SetRtcIdleUpdatePending(0);
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    FillDisplayQueue(Round, Batched);
+    
+    if ( Batched )
+    {
+      DrainBatched(pCount);
+    }
+    else
+    {
+      DrainOneAtATime(pCount);
+    }
+  }
+  
+  pCount->Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+}
+
+/* a run of button presses that toggle the led, then one that turns it on */
+static void FillBackgroundQueue(void)
+{
+  tMessage Msg;
+  unsigned char i;
+  
+  for ( i = 0; i < LED_RUN_LENGTH; i++ )
+  {
+    SetupMessage(&Msg, LedChange, 
+                 i + 1 < LED_RUN_LENGTH ? LED_TOGGLE_OPTION : LED_ON_OPTION);
+    RouteMsg(&Msg);
+  }
+}
+
+/* the led state that one message leaves; as LedChangeHandler */
+static unsigned char LedState(unsigned char Options, unsigned char On)
+{
+  switch (Options)
+  {
+  case LED_ON_OPTION:
+  case LED_START_OFF_TIMER:
+    return 1;
+
+  case LED_TOGGLE_OPTION:
+    return !On;
+
+  case LED_OFF_OPTION:
+  default:
+    return 0;
+  }
+}
+
+/* Background.c does not build on the host; this is the loop of its 
+ * LedChangeHandler with the led and timer writes counted
+ */
+static void CountLed(unsigned char Batched, tLedCount* pCount)
+{
+  unsigned int Round;
+  unsigned char LedOn = 0;
+  tMessage Msg;
+  tMessage NextMsg;
+  
+  memset(pCount, 0, sizeof(tLedCount));
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    FillBackgroundQueue();
+    
+    while ( ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT) )
+    {
+      unsigned char On = LedState(Msg.Options, LedOn);
+      
+      pCount->Messages++;
+      SendToFreeQueue(&Msg);
+      
+      while (   Batched
+             && pdTRUE == xQueuePeek(QueueHandles[BACKGROUND_QINDEX],
+                                     &NextMsg, DONT_WAIT)
+             && NextMsg.Type == LedChange )
+      {
+        ReceiveMessage(BACKGROUND_QINDEX, &NextMsg, DONT_WAIT);
+        On = LedState(NextMsg.Options, On);
+        pCount->Messages++;
+        SendToFreeQueue(&NextMsg);
+      }
+      
+      LedOn = On;
+      pCount->LedWrites++;
+      pCount->TimerChanges++;
+    }
+  }
+  
+  CHECK_EQUAL(1, LedOn);
+}
+
+int main(void)
+{
+  tDisplayCount Before;
+  tDisplayCount After;
+  tLedCount LedBefore;
+  tLedCount LedAfter;
+  
+  InitializeBufferPool();
+  CreateDisplayQueue(16, 4);
+  QueueHandles[BACKGROUND_QINDEX] = xQueueCreate(8, MESSAGE_QUEUE_ITEM_SIZE);
+  
+  CountDisplay(0, &Before);
+  CountDisplay(1, &After);
+  
+  printf("%-26s %12s %12s\n", "display task", "one by one", "batched");
+  printf("  %-24s %12lu %12lu\n", "messages handled", 
+         Before.Messages, After.Messages);
+  printf("  %-24s %12lu %12lu\n", "redraws", 
+         Before.Redraws, After.Redraws);
+  printf("  %-24s %12lu %12lu\n", "credit/stack/queue checks", 
+         Before.Bookkeeping, After.Bookkeeping);
+  printf("  %-24s %9.1f us %9.1f us (host)\n", "loop time per round",
+         Before.Seconds * 1e6 / ROUNDS, After.Seconds * 1e6 / ROUNDS);
+  
+  CountLed(0, &LedBefore);
+  CountLed(1, &LedAfter);
+  
+  printf("%-26s %12s %12s\n", "background task", "one by one", "batched");
+  printf("  %-24s %12lu %12lu\n", "led messages", 
+         LedBefore.Messages, LedAfter.Messages);
+  printf("  %-24s %12lu %12lu\n", "led writes", 
+         LedBefore.LedWrites, LedAfter.LedWrites);
+  printf("  %-24s %12lu %12lu\n", "timer starts/stops", 
+         LedBefore.TimerChanges, LedAfter.TimerChanges);
+  
+  CHECK_EQUAL(0, HostWatchdogResets());
+  return HostTestResult("BenchDisplayBatching");
+}
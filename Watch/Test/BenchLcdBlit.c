@@ -0,0 +1,185 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchLcdBlit.c
+ *
+ * The time of the display buffer operations with LcdBlit and with the byte 
+ * at a time loops it replaced.  This is not run by the tests (make bench).  
+ * The times are for the host cpu only; they show relative cost, not MSP430 
+ * cycles.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "hal_lcd.h"
+#include "LcdDisplay.h"
+#include "LcdBlit.h"
+#include "ReferenceLcdBlit.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 200000 )
+
+/* the idle clock area */
+#define IDLE_ROWS ( 30 )
+
+/* words so that the line data starts at an odd address as on target */
+static unsigned short Storage[(NUM_LCD_ROWS * sizeof(tLcdLine)) / 2];
+static unsigned short ImageStorage[(NUM_LCD_ROWS * NUM_LCD_COL_BYTES) / 2 + 1];
+
+static tLcdLine* const pBuffer = (tLcdLine*)Storage;
+
+/* an image at an odd address can be copied a word at a time */
+static unsigned char* const pImage = (unsigned char*)ImageStorage + 1;
+static unsigned char* const pEvenImage = (unsigned char*)ImageStorage;
+
+typedef enum
+{
+  FillDisplay,
+  InvertIdle,
+  CopyDisplay,
+  CopyEvenDisplay,
+  CopyIcon,
+  CopyBurstLine,
+  NumberOfCases
+  
+} etBenchCase;
+
+static const char* const pCaseNames[] =
+{
+  "fill 96 rows",
+  "invert 30 rows",
+  "copy 96 rows",
+  "copy 96 rows (even)",
+  "copy 3x24 icon",
+  "copy and flip a line",
+};
+
+static void Run(etBenchCase Case, unsigned char Reference)
+{
+  unsigned char Value = (unsigned char)Case;
+  
+  switch ( Case )
+  {
+  case FillDisplay:
+    if ( Reference ) 
+    {
+      ReferenceFillMyBuffer(pBuffer, 0, NUM_LCD_ROWS, Value);
+    }
+    else
+    {
+      LcdBlitFill(pBuffer, 0, NUM_LCD_ROWS, 0, NUM_LCD_COL_BYTES, Value);
+    }
+    break;
+    
+  case InvertIdle:
+    if ( Reference ) 
+    {
+      ReferenceInvertRows(pBuffer, 0, IDLE_ROWS);
+    }
+    else
+    {
+      LcdBlitXor(pBuffer, 0, IDLE_ROWS, 0, NUM_LCD_COL_BYTES, 0xFF);
+    }
+    break;
+    
+  case CopyDisplay:
+    if ( Reference ) 
+    {
+      ReferenceCopyRowsIntoMyBuffer(pBuffer, pImage, 0, NUM_LCD_ROWS);
+    }
+    else
+    {
+      LcdBlitCopy(pBuffer, pImage, 0, NUM_LCD_ROWS, 0, NUM_LCD_COL_BYTES);
+    }
+    break;
+    
+  case CopyEvenDisplay:
+    if ( Reference ) 
+    {
+      ReferenceCopyRowsIntoMyBuffer(pBuffer, pEvenImage, 0, NUM_LCD_ROWS);
+    }
+    else
+    {
+      LcdBlitCopy(pBuffer, pEvenImage, 0, NUM_LCD_ROWS, 0, NUM_LCD_COL_BYTES);
+    }
+    break;
+    
+  case CopyIcon:
+    if ( Reference ) 
+    {
+      ReferenceCopyColumnsIntoMyBuffer(pBuffer, pImage, 30, 24, 5, 3);
+    }
+    else
+    {
+      LcdBlitCopy(pBuffer, pImage, 30, 24, 5, 3);
+    }
+    break;
+    
+  default:
+    if ( Reference ) 
+    {
+      ReferenceCopyLine(pBuffer[1].Data, pImage, NUM_LCD_COL_BYTES, 1);
+    }
+    else
+    {
+      CopyLcdBytes(pBuffer[1].Data, pImage, NUM_LCD_COL_BYTES, 1);
+    }
+    break;
+  }
+}
+
+/* \return the host time of one operation in ns */
+static double Time(etBenchCase Case, unsigned char Reference)
+{
+  unsigned int Round;
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    Run(Case, Reference);
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  return Seconds * 1e9 / ROUNDS;
+}
+
+int main(void)
+{
+  unsigned char Case;
+  unsigned int i;
+  
+  for ( i = 0; i < sizeof(ImageStorage); i++ )
+  {
+    pEvenImage[i] = HostRandom();
+  }
+  
+  for ( Case = 0; Case < NumberOfCases; Case++ )
+  {
+    double Bytes = Time(Case, 1);
+    double Words = Time(Case, 0);
+    
+    printf("%-22s bytes %7.1f ns, words %7.1f ns (host)\n",
+           pCaseNames[Case], Bytes, Words);
+  }
+  
+  return HostTestResult("BenchLcdBlit");
+}
@@ -0,0 +1,99 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchLcdText.c
+ *
+ * The time to draw the idle screen text and clock with WriteLcdCharacter 
+ * and with the per-pixel drawing it replaced.  This is not run by the tests
+ * (make bench).  The times are for the host cpu only; they show relative 
+ * cost, not MSP430 cycles.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "Fonts.h"
+#include "LcdDisplay.h"
+#include "LcdText.h"
+#include "ReferenceLcdText.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 200000 )
+
+typedef void (*tWriteCharacter)(tLcdLine* pBuffer,
+                                tLcdTextPosition* pPosition,
+                                unsigned char Character);
+
+static tLcdLine Buffer[NUM_LCD_ROWS];
+
+/* \return the host time of drawing a string in ns per character */
+static double Time(tWriteCharacter pWrite,
+                   etFontType Font,
+                   const char* pString,
+                   unsigned char BitColumnMask)
+{
+  unsigned int Round;
+  unsigned int Characters = strlen(pString);
+  
+  SetFont(Font);
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    tLcdTextPosition Position = { 0, 0, BitColumnMask };
+    const char* pCharacter = pString;
+    
+    while ( *pCharacter )
+    {
+      pWrite(Buffer, &Position, *pCharacter++);
+    }
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  return Seconds * 1e9 / ROUNDS / Characters;
+}
+
+static void Report(const char* pName,
+                   etFontType Font,
+                   const char* pString,
+                   unsigned char BitColumnMask)
+{
+  double Pixel = Time(ReferenceWriteCharacter, Font, pString, BitColumnMask);
+  double Row = Time(WriteLcdCharacter, Font, pString, BitColumnMask);
+  
+  printf("%-24s per pixel %6.1f ns, per row %6.1f ns per character (host)\n",
+         pName, Pixel, Row);
+}
+
+int main(void)
+{
+  /* the clock digits (cached when DIGIT_CACHE_ENTRIES is not 0) */
+  Report("clock 12:34", MetaWatchTime, "\x01\x02\x0a\x03\x04", BIT4);
+  Report("seconds 56", MetaWatchSeconds, "\x05\x06", BIT2);
+  Report("day of week (5 pixel)", MetaWatch5, "Wednesday", BIT0);
+  Report("text (7 pixel)", MetaWatch7, "MetaWatch 1.2.3", BIT1);
+  Report("text (16 pixel)", MetaWatch16, "Link Lost", BIT0);
+  
+  return HostTestResult("BenchLcdText");
+}
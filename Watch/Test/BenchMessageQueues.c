@@ -0,0 +1,169 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchMessageQueues.c
+ *
+ * The time to find the queue of a message type with the routing table and 
+ * with the switch statement it replaced, and the time of a whole RouteMsg
+ * (with the receive and free that follow it).  This is not run by the tests
+ * (make bench).  The times are for the host cpu only; they show relative 
+ * cost, not MSP430 cycles.
+ */
+/******************************************************************************/
+
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "ReferenceMessageQueues.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 2000 )
+#define TYPES  ( 1024 )
+
+/* the table is generated the same way as the one in MessageQueues.c */
+#define MESSAGE_TYPE_ROUTE(Name, Value, Queue, Flags) \
+  [Value] = ( Queue##_QINDEX | (Flags) ),
+
+static const unsigned char RouteTable[MaxMessageType + 1] =
+{
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_ROUTE)
+};
+
+#define MESSAGE_TYPE_VALUE(Name, Value, Queue, Flags) Value,
+
+static const unsigned char ListedTypes[] =
+{
+  MESSAGE_TYPE_LIST(MESSAGE_TYPE_VALUE)
+};
+
+/* a stream of listed types in random order */
+static unsigned char Types[TYPES];
+
+static volatile unsigned int Sink;
+
+/* \return the host time of one lookup in ns */
+static double TimeLookup(unsigned char Reference)
+{
+  unsigned int Round;
+  unsigned int i;
+  unsigned int Sum = 0;
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    for ( i = 0; i < TYPES; i++ )
+    {
+      if ( Reference )
+      {
+        Sum += ReferenceRouteQindex(Types[i]);
+      }
+      else
+      {
+        Sum += RouteTable[Types[i]] & ROUTE_QINDEX_MASK;
+      }
+    }
+  }
+  
+  Sink = Sum;
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  return Seconds * 1e9 / ((double)ROUNDS * TYPES);
+}
+
+static void Drain(void)
+{
+  tMessage Msg;
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    SendToFreeQueue(&Msg);
+  }
+  
+  while ( ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT) )
+  {
+    SendToFreeQueue(&Msg);
+  }
+  
+  while ( ReceiveMessage(SPP_TASK_QINDEX, &Msg, DONT_WAIT) )
+  {
+    SendToFreeQueue(&Msg);
+  }
+}
+
+/* \return the host time of routing, receiving and freeing a message in ns */
+static double TimeRouteMsg(void)
+{
+  unsigned int Round;
+  unsigned int i;
+  tMessage Msg;
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    for ( i = 0; i < TYPES; i++ )
+    {
+      SetupMessageAndAllocateBuffer(&Msg, Types[i], NO_MSG_OPTIONS);
+      RouteMsg(&Msg);
+      
+      /* no queue fills up */
+      if ( (i & 7) == 7 )
+      {
+        Drain();
+      }
+    }
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  return Seconds * 1e9 / ((double)ROUNDS * TYPES);
+}
+
+int main(void)
+{
+  unsigned int i;
+  
+  for ( i = 0; i < TYPES; i++ )
+  {
+    Types[i] = ListedTypes[HostRandom() % sizeof(ListedTypes)];
+  }
+  
+  InitializeBufferPool();
+  CreateDisplayQueue(16, 16);
+  QueueHandles[BACKGROUND_QINDEX] = xQueueCreate(16, MESSAGE_QUEUE_ITEM_SIZE);
+  AssignWrapperQueueHandle(xQueueCreate(16, MESSAGE_QUEUE_ITEM_SIZE));
+  
+  double Switch = TimeLookup(1);
+  double Table = TimeLookup(0);
+  
+  printf("%-22s switch %7.2f ns, table %7.2f ns (host)\n",
+         "find the queue", Switch, Table);
+  printf("%-22s %7.1f ns (host)\n", "route, receive, free", TimeRouteMsg());
+  
+  Drain();
+  CHECK_EQUAL(0, HostWatchdogResets());
+  return HostTestResult("BenchMessageQueues");
+}
@@ -0,0 +1,322 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file BenchSerialRam.c
+ *
+ * The serial ram bus when the phone sends a screen with write buffer 
+ * messages.  Rows in order are collected into transfers of LCD_BURST_LINES
+ * rows.  Rows out of order are written one transfer per row, which is what
+ * every row cost before they were collected.
+ *
+ * An update reads the next lines from the serial ram while the lcd is sent
+ * the current ones, so it takes about as long as the lcd bus alone.
+ *
+ * The cpu waits for the dma transfers of an update.  A wait of more than
+ * the blocking size of the driver (LcdDriver.c and SerialRam.c) blocks the
+ * display task and the rest spin.  The cost of a blocked wait is modeled 
+ * three ways: spinning through it (before the semaphores), blocking and 
+ * waiting for the next tick to run again, and blocking with the dma 
+ * interrupt switching to the task.  The currents are typical values for 
+ * the MSP430F5438A, not measurements.
+ *
+ * This is not run by the tests (make bench).  The bus numbers come from the 
+ * SPI clocks of HostPeripherals.c; the time per screen is for the host cpu 
+ * only.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "hal_board_type.h"
+#include "hal_lcd.h"
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "LcdDisplay.h"
+#include "LcdDriver.h"
+#include "SerialRam.h"
+#include "HostTest.h"
+#include "HostPeripherals.h"
+
+#define SCREENS ( 2000 )
+
+/* the phone sends a screen as messages of two rows and the display task 
+ * takes them out of the queue RUN_LENGTH at a time
+ */
+#define RUN_LENGTH ( 16 )
+
+#define UPDATES ( 200 )
+
+/* the blocking sizes (bytes left) of LcdDriver.c and SerialRam.c */
+#define LCD_DMA_BLOCKING_SIZE  ( 32 )
+#define SRAM_DMA_BLOCKING_SIZE ( 256 )
+
+#define TICK_US ( 1e6 / 1024 )
+
+/* taking the semaphore, the interrupt and two task switches (MCLK is 
+ * SMCLK) 
+ */
+#define BLOCK_CYCLES ( 600 )
+
+/* mA with a 16 MHz MCLK and in LPM0 (SMCLK still runs the SPI) */
+#define ACTIVE_MA ( 5.0 )
+#define LPM0_MA   ( 0.1 )
+
+#define UPDATES_PER_DAY ( 24 * 60 )
+
+#define MAX_WAITS ( 256 )
+
+typedef struct
+{
+  unsigned char Bus;
+  unsigned long Cycles;
+  
+} tWait;
+
+static tWait Waits[MAX_WAITS];
+static unsigned int NumberOfWaits;
+
+/* every screen is different so that the update sends all of the rows */
+static unsigned char Screen;
+
+/* LcdDisplay.c */
+unsigned char CurrentMode = IDLE_MODE;
+
+unsigned char QueryInvertDisplay(void)
+{
+  return NORMAL_DISPLAY;
+}
+
+unsigned char GetIdleBufferConfiguration(void)
+{
+  return WATCH_CONTROLS_TOP;
+}
+
+static void RunDisplayTask(void)
+{
+  tMessage Msg;
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    WriteBufferHandler(&Msg);
+    FreeQueuedMessage(&Msg);
+  }
+}
+
+/* \param InOrder is 0 to send the rows from the bottom up */
+static void SendScreen(unsigned char InOrder)
+{
+  tMessage Msg;
+  unsigned char i;
+  
+  for ( i = 0; i < NUM_LCD_ROWS / 2; i++ )
+  {
+    SetupMessageAndAllocateBuffer(&Msg, WriteBuffer, APPLICATION_MODE);
+    
+    tSerialRamPayload* pPayload = (tSerialRamPayload*)GetMessagePayload(&Msg);
+    unsigned char Row = InOrder ? 2 * i : NUM_LCD_ROWS - 1 - 2 * i;
+    
+    pPayload->RowSelectA = Row;
+    pPayload->RowSelectB = InOrder ? Row + 1 : Row - 1;
+    memset(pPayload->pLineA, Row + Screen, sizeof(pPayload->pLineA));
+    memset(pPayload->pLineB, Row + Screen, sizeof(pPayload->pLineB));
+    Msg.Length = sizeof(tSerialRamPayload);
+    RouteMsg(&Msg);
+    
+    if ( (i + 1) % RUN_LENGTH == 0 )
+    {
+      RunDisplayTask();
+    }
+  }
+  
+  RunDisplayTask();
+  Screen++;
+}
+
+static void Measure(unsigned char InOrder)
+{
+  tHostBusCounts Counts;
+  unsigned int i;
+  
+  HostClearBusCounts();
+  clock_t Start = clock();
+  
+  for ( i = 0; i < SCREENS; i++ )
+  {
+    SendScreen(InOrder);
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  HostGetBusCounts(HOST_SRAM_BUS, &Counts);
+  
+  printf("%-16s %5.1f transfers %7.1f bytes %8.1f us bus %6.1f us (host)\n",
+         InOrder ? "rows in order" : "row by row",
+         (double)Counts.Transactions / SCREENS,
+         (double)Counts.Bytes / SCREENS,
+         Counts.SmClkCycles * 1e6 / HOST_SMCLK_HZ / SCREENS,
+         Seconds * 1e6 / SCREENS);
+}
+
+static void MeasureUpdate(void)
+{
+  tMessage Msg;
+  tHostBusCounts Sram;
+  tHostBusCounts Lcd;
+  double Elapsed = 0;
+  double SramBus = 0;
+  double LcdBus = 0;
+  unsigned int i;
+  
+  CurrentMode = APPLICATION_MODE;
+  SetupMessage(&Msg, UpdateDisplay, APPLICATION_MODE);
+  
+  for ( i = 0; i < UPDATES; i++ )
+  {
+    SendScreen(1);
+    HostClearBusCounts();
+    UpdateDisplayHandler(&Msg);
+    
+    HostGetBusCounts(HOST_SRAM_BUS, &Sram);
+    HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+    Elapsed += HostElapsedCycles();
+    SramBus += Sram.SmClkCycles;
+    LcdBus += Lcd.SmClkCycles;
+  }
+  
+  printf("update of %d rows\n", NUM_LCD_ROWS);
+  printf("%-16s %8.1f us serial ram, %8.1f us lcd\n", "bus time",
+         SramBus * 1e6 / HOST_SMCLK_HZ / UPDATES,
+         LcdBus * 1e6 / HOST_SMCLK_HZ / UPDATES);
+  printf("%-16s %8.1f us one bus at a time, %8.1f us overlapped\n", 
+         "update time",
+         (SramBus + LcdBus) * 1e6 / HOST_SMCLK_HZ / UPDATES,
+         Elapsed * 1e6 / HOST_SMCLK_HZ / UPDATES);
+}
+
+/* only the waits for the end of a dma transfer can block */
+static void RecordWait(unsigned char Bus, 
+                       unsigned long Cycles, 
+                       unsigned char Dma)
+{
+  if ( Dma && NumberOfWaits < MAX_WAITS )
+  {
+    Waits[NumberOfWaits].Bus = Bus;
+    Waits[NumberOfWaits].Cycles = Cycles;
+    NumberOfWaits++;
+  }
+}
+
+static void PrintPolicy(const char* pName, 
+                        double ActiveUs, 
+                        double SleepUs, 
+                        double UpdateUs)
+{
+  double Charge = (ActiveUs * ACTIVE_MA + SleepUs * LPM0_MA) / 1000;
+  
+  printf("%-16s %8.1f us active %8.1f us update %6.2f uC %6.1f mC/day\n",
+         pName, ActiveUs, UpdateUs, Charge, 
+         Charge * UPDATES_PER_DAY / 1000);
+}
+
+static void MeasureWaits(void)
+{
+  tMessage Msg;
+  tHostBusCounts Counts[2];
+  double Elapsed = 0;
+  double Blocked = 0;
+  unsigned long Blocks = 0;
+  unsigned int i;
+  unsigned int j;
+  
+  CurrentMode = APPLICATION_MODE;
+  SetupMessage(&Msg, UpdateDisplay, APPLICATION_MODE);
+  HostSetWaitHook(RecordWait);
+  
+  for ( i = 0; i < UPDATES; i++ )
+  {
+    SendScreen(1);
+    HostClearBusCounts();
+    NumberOfWaits = 0;
+    UpdateDisplayHandler(&Msg);
+    
+    HostGetBusCounts(HOST_SRAM_BUS, &Counts[HOST_SRAM_BUS]);
+    HostGetBusCounts(HOST_LCD_BUS, &Counts[HOST_LCD_BUS]);
+    Elapsed += HostElapsedCycles();
+    
+    for ( j = 0; j < NumberOfWaits; j++ )
+    {
+      tHostBusCounts* pBus = &Counts[Waits[j].Bus];
+      unsigned long Limit = ( Waits[j].Bus == HOST_LCD_BUS ) ? 
+        LCD_DMA_BLOCKING_SIZE : SRAM_DMA_BLOCKING_SIZE;
+      
+      if ( Waits[j].Cycles * pBus->Bytes > Limit * pBus->SmClkCycles )
+      {
+        Blocked += Waits[j].Cycles;
+        Blocks++;
+      }
+    }
+  }
+  
+  HostSetWaitHook(NULL);
+  
+  double UpdateUs = Elapsed * 1e6 / HOST_SMCLK_HZ / UPDATES;
+  double BlockedUs = Blocked * 1e6 / HOST_SMCLK_HZ / UPDATES;
+  double SwitchUs = 
+    (double)Blocks * BLOCK_CYCLES * 1e6 / HOST_SMCLK_HZ / UPDATES;
+  double PerUpdate = (double)Blocks / UPDATES;
+  
+  printf("cpu during an update: %.1f waits block for %.1f us of %.1f us\n",
+         PerUpdate, BlockedUs, UpdateUs);
+  
+  PrintPolicy("spin", UpdateUs, 0, UpdateUs);
+  
+  /* the task runs again at the next tick, half a tick later on average, 
+   * and the cpu is idle but awake until then 
+   */
+  PrintPolicy("block", 
+              UpdateUs - BlockedUs + SwitchUs + PerUpdate * TICK_US / 2, 
+              BlockedUs - SwitchUs,
+              UpdateUs + PerUpdate * TICK_US / 2);
+  
+  PrintPolicy("block and yield", 
+              UpdateUs - BlockedUs + SwitchUs,
+              BlockedUs - SwitchUs,
+              UpdateUs);
+}
+
+int main(void)
+{
+  InitializeBufferPool();
+  CreateDisplayQueue(NUM_MSG_BUFFERS, 4);
+  HostInitPeripherals(5);
+  SerialRamInit();
+  LcdPeripheralInit();
+  
+  printf("one screen of WriteBuffer messages (%d rows)\n", NUM_LCD_ROWS);
+  Measure(0);
+  Measure(1);
+  MeasureUpdate();
+  MeasureWaits();
+  
+  return HostTestResult("BenchSerialRam");
+}
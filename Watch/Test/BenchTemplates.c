@@ -0,0 +1,177 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file BenchTemplates.c
+ *
+ * How many rows fit in one WriteBufferPacked message for some typical 
+ * screens, and how long the template decoder takes on the host.  This is 
+ * not run by the tests (make bench).  The times are for the host cpu only;
+ * they show relative cost, not MSP430 cycles.
+ */
+/******************************************************************************/
+
+#include <string.h>
+#include <time.h>
+
+#include "FreeRTOS.h"
+
+#include "Messages.h"
+#include "Templates.h"
+#include "TemplateEncoder.h"
+#include "HostTest.h"
+
+#define NUM_ROWS         ( 96 )
+#define BYTES_PER_SCREEN ( NUM_ROWS * TEMPLATE_BYTES_PER_LINE )
+
+/* the commands of a WriteBufferPacked message follow the start row and count */
+#define PACKED_DATA_LENGTH ( HOST_MSG_MAX_PAYLOAD_LENGTH - 2 )
+
+#define DECODE_ROUNDS ( 20000 )
+
+static unsigned char Screen[BYTES_PER_SCREEN];
+
+/* \return the number of rows from the start of Screen that fit in one 
+ * message
+ */
+static unsigned int RowsPerMessage(void)
+{
+  unsigned char Packed[PACKED_DATA_LENGTH];
+  unsigned int Rows = 0;
+  
+  while (   Rows < NUM_ROWS 
+         && EncodeTemplate(Screen, 
+                           (Rows + 1) * TEMPLATE_BYTES_PER_LINE, 
+                           Packed, 
+                           sizeof(Packed)) )
+  {
+    Rows++;
+  }
+  
+  return Rows;
+}
+
+/* \return the number of messages for all of the rows of Screen */
+static unsigned int MessagesPerScreen(void)
+{
+  unsigned char Packed[PACKED_DATA_LENGTH];
+  unsigned int Row = 0;
+  unsigned int Messages = 0;
+  
+  while ( Row < NUM_ROWS )
+  {
+    unsigned int Rows = 1;
+    
+    while (   Row + Rows < NUM_ROWS
+           && EncodeTemplate(&Screen[Row * TEMPLATE_BYTES_PER_LINE], 
+                             (Rows + 1) * TEMPLATE_BYTES_PER_LINE, 
+                             Packed, 
+                             sizeof(Packed)) )
+    {
+      Rows++;
+    }
+    
+    Row += Rows;
+    Messages++;
+  }
+  
+  return Messages;
+}
+
+static void Report(const char* pName)
+{
+  printf("%-28s %3u rows in the first message, %3u messages per screen "
+         "(WriteBuffer: 48)\n", 
+         pName, RowsPerMessage(), MessagesPerScreen());
+}
+
+static void SetPixel(unsigned int X, unsigned int Y)
+{
+  Screen[Y * TEMPLATE_BYTES_PER_LINE + X / 8] |= 1 << (X & 0x07);
+}
+
+static void BenchRows(void)
+{
+  unsigned int X;
+  unsigned int Y;
+  
+  memset(Screen, 0, sizeof(Screen));
+  Report("blank (or unchanged, xor)");
+  
+  for ( Y = 0; Y < NUM_ROWS; Y++ )
+  {
+    SetPixel(0, Y);
+    SetPixel(95, Y);
+  }
+  memset(Screen, 0xFF, TEMPLATE_BYTES_PER_LINE);
+  memset(&Screen[BYTES_PER_SCREEN - TEMPLATE_BYTES_PER_LINE], 
+         0xFF, 
+         TEMPLATE_BYTES_PER_LINE);
+  Report("frame");
+  
+  /* the change when the minutes of the idle time go from 8 to 9: a 
+   * 16 x 19 pixel digit where about half of the pixels flip 
+   */
+  memset(Screen, 0, sizeof(Screen));
+  for ( Y = 0; Y < 19; Y++ )
+  {
+    for ( X = 64; X < 80; X++ )
+    {
+      if ( HostRandom() & 0x01 )
+      {
+        SetPixel(X, Y);
+      }
+    }
+  }
+  Report("minute digit change (xor)");
+  
+  for ( X = 0; X < BYTES_PER_SCREEN; X++ )
+  {
+    Screen[X] = HostRandom();
+  }
+  Report("noise");
+}
+
+static void BenchDecode(void)
+{
+  tTemplateDecoder Decoder;
+  unsigned int Size = 0;
+  const unsigned char* pTemplate = 
+    GetTemplatePointer(FIRST_FLASH_TEMPLATE, &Size);
+  unsigned int Round;
+  
+  clock_t Start = clock();
+  
+  for ( Round = 0; Round < DECODE_ROUNDS; Round++ )
+  {
+    InitTemplateDecoder(&Decoder, pTemplate, pTemplate + Size);
+    DecodeTemplate(&Decoder, Screen, BYTES_PER_SCREEN, Round & 0x01);
+  }
+  
+  double Seconds = (double)(clock() - Start) / CLOCKS_PER_SEC;
+  
+  printf("decode of a frame template   %.2f us per screen (host)\n",
+         Seconds * 1e6 / DECODE_ROUNDS);
+}
+
+int main(void)
+{
+  BenchRows();
+  BenchDecode();
+  
+  return HostTestResult("BenchTemplates");
+}
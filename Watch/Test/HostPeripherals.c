@@ -0,0 +1,631 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostPeripherals.c
+ *
+ * The serial ram, the lcd, the USCI buses and the DMA as SerialRam.c and
+ * LcdDriver.c use them.  Misuse that would hang or corrupt data on target
+ * (a byte without a chip select, a byte mode transfer of more than one 
+ * byte, a receive dma that cannot finish) fails a check.
+ */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "task.h"
+
+#include "hal_board_type.h"
+#include "hal_clock_control.h"
+#include "hal_rtos_timer.h"
+#include "HostTest.h"
+#include "HostPeripherals.h"
+
+/* serial ram commands and the sequential mode of the status register */
+#define SRAM_READ        ( 0x03 )
+#define SRAM_WRITE       ( 0x02 )
+#define SRAM_RDSR        ( 0x05 )
+#define SRAM_WRSR        ( 0x01 )
+#define SRAM_MODE_MASK   ( 0xC0 )
+#define SRAM_SEQUENTIAL  ( 0x40 )
+
+#define SRAM_SIZE_64K    ( 8192 )
+
+/* lcd commands (hal_lcd.h) */
+#define LCD_WRITE  ( 0x01 )
+#define LCD_CLEAR  ( 0x04 )
+#define LCD_STATIC ( 0x00 )
+
+/* a row is the row number, the data and a dummy byte */
+#define LCD_LINE_BYTES ( 1 + HOST_LCD_ROW_BYTES + 1 )
+
+/* enough for every row of the panel in one write */
+#define LCD_FRAME_SIZE ( 1 + HOST_LCD_ROWS * LCD_LINE_BYTES + 1 )
+
+/* dma triggers (DMAxTSEL) */
+#define TRIGGER_UCA0RXIFG ( 16 )
+#define TRIGGER_UCA0TXIFG ( 17 )
+#define TRIGGER_UCB0RXIFG ( 18 )
+#define TRIGGER_UCB0TXIFG ( 19 )
+
+#define DMA_CHANNELS ( 3 )
+
+typedef enum
+{
+  SramCommand,
+  SramAddressHigh,
+  SramAddressLow,
+  SramData,
+  SramStatusOut,
+  SramStatusIn,
+  SramIgnore
+  
+} tSramState;
+
+unsigned char P3DIR, P3OUT, P3SEL, P4DIR, P4OUT, P9DIR, P9OUT;
+
+tHostUsci HostUsciA0 = { .TxBuf = HOST_USCI_EMPTY };
+tHostUsci HostUsciB0 = { .TxBuf = HOST_USCI_EMPTY };
+tHostDma HostDma;
+
+unsigned char HostSram[HOST_SRAM_SIZE];
+unsigned char HostLcd[HOST_LCD_ROWS][HOST_LCD_ROW_BYTES];
+
+static unsigned char BoardConfiguration;
+static unsigned int SramSize;
+static tHostBusCounts Counts[2];
+
+static unsigned char SramSelected;
+static tSramState SramState;
+static unsigned char SramCommandByte;
+static unsigned int SramAddress;
+static unsigned int SramDataBytes;
+static unsigned char SramStatus;
+
+static unsigned char LcdSelected;
+static unsigned char LcdFrame[LCD_FRAME_SIZE];
+static unsigned int LcdFrameSize;
+static void (*pLcdRowHook)(unsigned char Row, unsigned char const* pData);
+
+static unsigned char DmaRunning;
+static unsigned int LpmExits;
+static unsigned int Yields;
+static unsigned char SchedulerRunning;
+static void (*pWaitHook)(unsigned char Bus, 
+                         unsigned long Cycles, 
+                         unsigned char Dma);
+
+/* a dma transfer has been sent since the cpu last waited for the bus */
+static unsigned char DmaSent[2];
+
+/* the time (in SMCLK cycles) and when each bus sends its last byte */
+static unsigned long Now;
+static unsigned long BusFree[2];
+
+static void RunDma(void);
+
+/******************************************************************************/
+
+void HostInitPeripherals(unsigned char Configuration)
+{
+  unsigned int i;
+  
+  BoardConfiguration = Configuration;
+  SramSize = ( Configuration >= 5 ) ? HOST_SRAM_SIZE : SRAM_SIZE_64K;
+  SramStatus = ( Configuration >= 5 ) ? 0x00 : 0x02;
+  SramSelected = 0;
+  LcdSelected = 0;
+  
+  for ( i = 0; i < HOST_SRAM_SIZE; i++ )
+  {
+    HostSram[i] = (unsigned char)HostRandom();
+  }
+  
+  memset(HostLcd, 0xFF, sizeof(HostLcd));
+  memset(&HostDma, 0, sizeof(HostDma));
+  HostUsciA0.TxBuf = HOST_USCI_EMPTY;
+  HostUsciB0.TxBuf = HOST_USCI_EMPTY;
+  
+  SchedulerRunning = 1;
+  HostClearBusCounts();
+  HostSetInterruptHook(RunDma);
+}
+
+void HostGetBusCounts(unsigned char Bus, tHostBusCounts* pCounts)
+{
+  *pCounts = Counts[Bus];
+}
+
+void HostClearBusCounts(void)
+{
+  memset(Counts, 0, sizeof(Counts));
+  LpmExits = 0;
+  Yields = 0;
+  Now = 0;
+  BusFree[HOST_SRAM_BUS] = 0;
+  BusFree[HOST_LCD_BUS] = 0;
+}
+
+unsigned long HostElapsedCycles(void)
+{
+  return Now;
+}
+
+void HostSetLcdRowHook(void (*pHook)(unsigned char Row, 
+                                     unsigned char const* pData))
+{
+  pLcdRowHook = pHook;
+}
+
+unsigned int HostLpmExits(void)
+{
+  return LpmExits;
+}
+
+void HostExitLpm(void)
+{
+  LpmExits++;
+}
+
+unsigned int HostYields(void)
+{
+  return Yields;
+}
+
+void HostYield(void)
+{
+  Yields++;
+}
+
+void HostSetSchedulerState(unsigned char Running)
+{
+  SchedulerRunning = Running;
+}
+
+void HostSetWaitHook(void (*pHook)(unsigned char Bus, 
+                                   unsigned long Cycles, 
+                                   unsigned char Dma))
+{
+  pWaitHook = pHook;
+}
+
+/******************************************************************************/
+
+/* the firmware that the drivers call */
+
+unsigned char GetBoardConfiguration(void)
+{
+  return BoardConfiguration;
+}
+
+unsigned char QuerySchedulerState(void)
+{
+  return SchedulerRunning;
+}
+
+void EnableSmClkUser(unsigned char User)
+{
+}
+
+void DisableSmClkUser(unsigned char User)
+{
+}
+
+void TaskDelayLpmDisable(void)
+{
+}
+
+void TaskDelayLpmEnable(void)
+{
+}
+
+void vTaskDelay(portTickType xTicksToDelay)
+{
+}
+
+/******************************************************************************/
+
+/* 
+ * the serial ram 
+ */
+
+/* the chip select is released after the last byte has been sent */
+static void WaitForBus(unsigned char Bus)
+{
+  unsigned long Cycles = ( BusFree[Bus] > Now ) ? BusFree[Bus] - Now : 0;
+  
+  if ( pWaitHook && Cycles )
+  {
+    pWaitHook(Bus, Cycles, DmaSent[Bus]);
+  }
+  
+  DmaSent[Bus] = 0;
+  Now += Cycles;
+}
+
+void HostSelectSram(unsigned char Select)
+{
+  if ( !Select )
+  {
+    WaitForBus(HOST_SRAM_BUS);
+  }
+  
+  if ( Select && !SramSelected )
+  {
+    Counts[HOST_SRAM_BUS].Transactions++;
+    SramState = SramCommand;
+    SramDataBytes = 0;
+  }
+  
+  SramSelected = Select;
+}
+
+static unsigned char SramByte(unsigned char Data)
+{
+  unsigned char Out = 0xFF;
+  
+  switch ( SramState )
+  {
+  case SramCommand:
+    SramCommandByte = Data;
+    
+    if ( Data == SRAM_READ || Data == SRAM_WRITE )
+    {
+      SramState = SramAddressHigh;
+    }
+    else if ( Data == SRAM_RDSR )
+    {
+      SramState = SramStatusOut;
+    }
+    else if ( Data == SRAM_WRSR )
+    {
+      SramState = SramStatusIn;
+    }
+    else
+    {
+      CHECK(!"unknown serial ram command");
+      SramState = SramIgnore;
+    }
+    break;
+    
+  case SramAddressHigh:
+    SramAddress = Data << 8;
+    SramState = SramAddressLow;
+    break;
+    
+  case SramAddressLow:
+    SramAddress = (SramAddress | Data) % SramSize;
+    SramState = SramData;
+    break;
+    
+  case SramData:
+    /* byte mode stops after one byte */
+    SramDataBytes++;
+    CHECK(   SramDataBytes == 1 
+          || (SramStatus & SRAM_MODE_MASK) == SRAM_SEQUENTIAL );
+    
+    if ( SramCommandByte == SRAM_READ )
+    {
+      Out = HostSram[SramAddress];
+    }
+    else
+    {
+      HostSram[SramAddress] = Data;
+    }
+    
+    SramAddress = (SramAddress + 1) % SramSize;
+    break;
+    
+  case SramStatusOut:
+    Out = SramStatus;
+    break;
+    
+  case SramStatusIn:
+    SramStatus = Data;
+    SramState = SramIgnore;
+    break;
+    
+  default:
+    break;
+  }
+  
+  return Out;
+}
+
+/******************************************************************************/
+
+/* 
+ * the lcd 
+ */
+
+void HostSelectLcd(unsigned char Select)
+{
+  if ( !Select )
+  {
+    WaitForBus(HOST_LCD_BUS);
+  }
+  
+  if ( Select && !LcdSelected )
+  {
+    Counts[HOST_LCD_BUS].Transactions++;
+    LcdFrameSize = 0;
+  }
+  else if ( !Select && LcdSelected && LcdFrameSize )
+  {
+    unsigned int Index = 1;
+    
+    switch ( LcdFrame[0] )
+    {
+    case LCD_WRITE:
+      while ( LcdFrameSize - Index >= LCD_LINE_BYTES )
+      {
+        unsigned char Row = LcdFrame[Index] - 1;
+        
+        CHECK(LcdFrame[Index] >= 1 && LcdFrame[Index] <= HOST_LCD_ROWS);
+        
+        if ( Row < HOST_LCD_ROWS )
+        {
+          memcpy(HostLcd[Row], &LcdFrame[Index + 1], HOST_LCD_ROW_BYTES);
+          
+          if ( pLcdRowHook )
+          {
+            pLcdRowHook(Row, HostLcd[Row]);
+          }
+        }
+        
+        Counts[HOST_LCD_BUS].Rows++;
+        Index += LCD_LINE_BYTES;
+      }
+      
+      /* the panel needs one more dummy byte after the last row */
+      CHECK_EQUAL(1, LcdFrameSize - Index);
+      break;
+      
+    case LCD_CLEAR:
+      memset(HostLcd, 0xFF, sizeof(HostLcd));
+      Counts[HOST_LCD_BUS].Clears++;
+      break;
+      
+    case LCD_STATIC:
+      Counts[HOST_LCD_BUS].Statics++;
+      break;
+      
+    default:
+      CHECK(!"unknown lcd command");
+      break;
+    }
+  }
+  
+  LcdSelected = Select;
+}
+
+static unsigned char LcdByte(unsigned char Data)
+{
+  CHECK(LcdFrameSize < LCD_FRAME_SIZE);
+  
+  if ( LcdFrameSize < LCD_FRAME_SIZE )
+  {
+    LcdFrame[LcdFrameSize++] = Data;
+  }
+  
+  return 0;
+}
+
+/******************************************************************************/
+
+/* 
+ * the SPI buses 
+ */
+
+/* send one byte and return the byte that was received */
+static unsigned char Exchange(tHostUsci* pUsci, unsigned char Data)
+{
+  unsigned char Bus = ( pUsci == &HostUsciA0 ) ? HOST_SRAM_BUS : HOST_LCD_BUS;
+  unsigned int Prescaler = pUsci->Br0 | (pUsci->Br1 << 8);
+  
+  /* the bus has to be configured and out of reset */
+  CHECK(Prescaler != 0 && (pUsci->Ctl1 & UCSWRST) == 0);
+  
+  Counts[Bus].Bytes++;
+  Counts[Bus].SmClkCycles += 8UL * Prescaler;
+  
+  /* a byte starts when the bus is free (dma bytes follow each other) */
+  if ( BusFree[Bus] < Now )
+  {
+    BusFree[Bus] = Now;
+  }
+  
+  BusFree[Bus] += 8UL * Prescaler;
+  
+  if ( Bus == HOST_SRAM_BUS )
+  {
+    CHECK(SramSelected);
+    pUsci->RxBuf = SramSelected ? SramByte(Data) : 0xFF;
+  }
+  else
+  {
+    CHECK(LcdSelected);
+    pUsci->RxBuf = LcdSelected ? LcdByte(Data) : 0;
+  }
+  
+  return pUsci->RxBuf;
+}
+
+/* the cpu polls until a byte it wrote has been sent */
+static void SendTxBuf(tHostUsci* pUsci)
+{
+  if ( pUsci->TxBuf != HOST_USCI_EMPTY )
+  {
+    Exchange(pUsci, (unsigned char)pUsci->TxBuf);
+    pUsci->TxBuf = HOST_USCI_EMPTY;
+    WaitForBus(( pUsci == &HostUsciA0 ) ? HOST_SRAM_BUS : HOST_LCD_BUS);
+  }
+}
+
+unsigned char HostUsciFlags(tHostUsci* pUsci)
+{
+  SendTxBuf(pUsci);
+  return UCTXIFG | UCRXIFG;
+}
+
+unsigned char HostUsciStatus(tHostUsci* pUsci)
+{
+  SendTxBuf(pUsci);
+  return 0;
+}
+
+/******************************************************************************/
+
+/* 
+ * the dma 
+ */
+
+void __data16_write_addr(unsigned short Address, unsigned long Value)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < DMA_CHANNELS; i++ )
+  {
+    if ( Address == (unsigned short)&HostDma.Channel[i].Sa )
+    {
+      HostDma.Channel[i].Sa = Value;
+      return;
+    }
+    
+    if ( Address == (unsigned short)&HostDma.Channel[i].Da )
+    {
+      HostDma.Channel[i].Da = Value;
+      return;
+    }
+  }
+  
+  CHECK(!"__data16_write_addr of an unknown register");
+}
+
+static unsigned char Trigger(unsigned char Channel)
+{
+  switch ( Channel )
+  {
+  case 0:  return HostDma.Ctl0 & 0x1F;
+  case 1:  return (HostDma.Ctl0 >> 8) & 0x1F;
+  default: return HostDma.Ctl1 & 0x1F;
+  }
+}
+
+static tHostDmaChannel* FindChannel(unsigned char TriggerSelect)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < DMA_CHANNELS; i++ )
+  {
+    if (   (HostDma.Channel[i].Ctl & DMAEN) 
+        && Trigger(i) == TriggerSelect )
+    {
+      return &HostDma.Channel[i];
+    }
+  }
+  
+  return NULL;
+}
+
+static void FinishChannel(tHostDmaChannel* pChannel)
+{
+  if ( pChannel )
+  {
+    pChannel->Ctl &= ~DMAEN;
+    
+    if ( pChannel->Ctl & DMAIE )
+    {
+      HostDma.Iv = 2 * (pChannel - HostDma.Channel + 1);
+      DMA_ISR();
+      HostDma.Iv = 0;
+    }
+  }
+}
+
+/* The transmit dma runs the bus.  The receive dma runs one byte behind it 
+ * (see READ_DATA_OFFSET in SerialRam.c), so its first byte is what was left
+ * in the receive buffer, and a byte is always read by the transmit dma 
+ * before the receive dma writes it when both use the same buffer.
+ */
+static void RunUsciDma(tHostUsci* pUsci, 
+                       unsigned char TxTrigger, 
+                       unsigned char RxTrigger)
+{
+  tHostDmaChannel* pTx = FindChannel(TxTrigger);
+  tHostDmaChannel* pRx = FindChannel(RxTrigger);
+  
+  if ( pTx == NULL )
+  {
+    return;
+  }
+  
+  SendTxBuf(pUsci);
+  CHECK(pTx->Da == (unsigned long)&pUsci->TxBuf);
+  CHECK(pRx == NULL || pRx->Sa == (unsigned long)&pUsci->RxBuf);
+  CHECK((pTx->Ctl & DMASBDB) == DMASBDB);
+  
+  unsigned char* pSource = (unsigned char*)pTx->Sa;
+  unsigned char* pDestination = pRx ? (unsigned char*)pRx->Da : NULL;
+  unsigned char Pending = pUsci->RxBuf;
+  unsigned int Received = 0;
+  unsigned int i;
+  
+  for ( i = 0; i < pTx->Sz; i++ )
+  {
+    unsigned char Data = Exchange(pUsci, *pSource);
+    
+    if ( (pTx->Ctl & DMASRCINCR_3) == DMASRCINCR_3 )
+    {
+      pSource++;
+    }
+    
+    if ( pRx && Received < pRx->Sz )
+    {
+      *pDestination = Pending;
+      Received++;
+      
+      if ( (pRx->Ctl & DMADSTINCR_3) == DMADSTINCR_3 )
+      {
+        pDestination++;
+      }
+    }
+    
+    Pending = Data;
+  }
+  
+  /* the receive dma would never finish */
+  CHECK(pRx == NULL || Received == pRx->Sz);
+  
+  DmaSent[( pUsci == &HostUsciA0 ) ? HOST_SRAM_BUS : HOST_LCD_BUS] = 1;
+  
+  FinishChannel(pTx);
+  FinishChannel(pRx);
+}
+
+/* called when interrupts are enabled */
+static void RunDma(void)
+{
+  if ( !DmaRunning )
+  {
+    DmaRunning = 1;
+    RunUsciDma(&HostUsciA0, TRIGGER_UCA0TXIFG, TRIGGER_UCA0RXIFG);
+    RunUsciDma(&HostUsciB0, TRIGGER_UCB0TXIFG, TRIGGER_UCB0RXIFG);
+    DmaRunning = 0;
+  }
+}
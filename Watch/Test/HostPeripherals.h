@@ -0,0 +1,125 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file HostPeripherals.h
+ *
+ * Models of the serial ram, the lcd and the two SPI buses (USCI A0 and B0 
+ * with DMA channels 0 to 2) so that SerialRam.c and LcdDriver.c run on the 
+ * host.  The registers are declared in Stubs/msp430.h.
+ *
+ * A DMA transfer finishes the next time interrupts are enabled.  The bytes
+ * on each bus are counted by chip select and turned into SPI clock time from
+ * the prescaler the driver wrote, which is the bus time on target.
+ *
+ * The time only moves when the cpu waits for a bus: for a byte it polls or 
+ * for the last byte of a transfer before it releases the chip select.  The
+ * code between the waits takes no time, so the elapsed time is how long the
+ * buses keep the task waiting.  A transfer on one bus runs while the task 
+ * waits for the other one.
+ */
+/******************************************************************************/
+
+#ifndef HOST_PERIPHERALS_H
+#define HOST_PERIPHERALS_H
+
+/*! the 256 Kbit serial ram */
+#define HOST_SRAM_SIZE ( 32768 )
+
+/*! what the serial ram holds */
+extern unsigned char HostSram[HOST_SRAM_SIZE];
+
+#define HOST_LCD_ROWS      ( 96 )
+#define HOST_LCD_ROW_BYTES ( 12 )
+
+/*! what each row of the lcd shows (as sent, so a 0 bit is black) */
+extern unsigned char HostLcd[HOST_LCD_ROWS][HOST_LCD_ROW_BYTES];
+
+#define HOST_SRAM_BUS ( 0 )
+#define HOST_LCD_BUS  ( 1 )
+
+/*! What went over one of the buses
+ *
+ * \param Transactions is the number of chip selects
+ * \param Bytes is the number of bytes
+ * \param SmClkCycles is the time the bytes took in SMCLK cycles
+ * \param Rows is the number of lcd rows written (lcd bus)
+ * \param Clears is the number of lcd clear commands (lcd bus)
+ * \param Statics is the number of lcd static mode commands (lcd bus)
+ */
+typedef struct
+{
+  unsigned long Transactions;
+  unsigned long Bytes;
+  unsigned long SmClkCycles;
+  unsigned long Rows;
+  unsigned long Clears;
+  unsigned long Statics;
+  
+} tHostBusCounts;
+
+/*! SMCLK of the watch (the SPI clocks are divided from it) */
+#define HOST_SMCLK_HZ ( 16777216UL )
+
+/*! Reset the models and the counts.  The serial ram is filled with random
+ * data as it is after power up and the lcd is cleared.
+ *
+ * \param BoardConfiguration is returned by GetBoardConfiguration (5 and up
+ * have the 256 Kbit part, the 64 Kbit part uses the first 8 KB of HostSram)
+ */
+void HostInitPeripherals(unsigned char BoardConfiguration);
+
+/*! \param Bus is HOST_SRAM_BUS or HOST_LCD_BUS 
+ * \param pCounts is where the counts are copied
+ */
+void HostGetBusCounts(unsigned char Bus, tHostBusCounts* pCounts);
+
+/*! Set the counts of both buses and the elapsed time to zero */
+void HostClearBusCounts(void);
+
+/*! \return the SMCLK cycles the cpu has waited for the buses */
+unsigned long HostElapsedCycles(void);
+
+/*! Call pHook for every row that the lcd is sent (NULL removes the hook) */
+void HostSetLcdRowHook(void (*pHook)(unsigned char Row, 
+                                     unsigned char const* pData));
+
+/*! \return the number of times an interrupt asked to exit low power mode */
+unsigned int HostLpmExits(void);
+
+/*! \return the number of times an interrupt switched to a woken task */
+unsigned int HostYields(void);
+
+/*! \param Running is what QuerySchedulerState returns (0 is asleep with the 
+ * tick off, 1 after HostInitPeripherals)
+ */
+void HostSetSchedulerState(unsigned char Running);
+
+/*! Call pHook each time the cpu waits for a bus (NULL removes the hook)
+ *
+ * \param Bus is HOST_SRAM_BUS or HOST_LCD_BUS
+ * \param Cycles is how long the cpu waits in SMCLK cycles
+ * \param Dma is 1 when the wait is for the end of a dma transfer and 0 for
+ * a byte that the cpu sent
+ */
+void HostSetWaitHook(void (*pHook)(unsigned char Bus, 
+                                   unsigned long Cycles, 
+                                   unsigned char Dma));
+
+/*! the dma interrupt of SerialRam.c */
+void DMA_ISR(void);
+
+#endif /* HOST_PERIPHERALS_H */
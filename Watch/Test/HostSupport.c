@@ -0,0 +1,326 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file HostSupport.c
+ *
+ * Host versions of the FreeRTOS queue, the interrupt intrinsics, the crystal
+ * timer and the debug uart that the application files under test call.
+ */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "Messages.h"
+#include "DebugUart.h"
+#include "Statistics.h"
+#include "HostTest.h"
+
+unsigned int HostFailures;
+
+tApplicationStatistics gAppStats;
+
+static unsigned short InterruptState = 1;
+static unsigned int CrystalTimerCount;
+static unsigned int WatchdogResets;
+static unsigned long RandomState = 1;
+static void (*pSendHook)(void* pQueue);
+static void (*pInterruptHook)(void);
+static xQueueHandle LastQueue;
+static unsigned int TraceEvents;
+static unsigned int Prints;
+
+/* the strings printed since the last HostPrinted */
+#define HOST_PRINTS_KEPT ( 8 )
+static const char* pPrinted[HOST_PRINTS_KEPT];
+static unsigned char Printed;
+static unsigned char LastTraceId;
+static unsigned char LastTraceArg1;
+
+int HostTestResult(const char* pName)
+{
+  printf("%s: %s\n", pName, HostFailures ? "FAILED" : "passed");
+  return HostFailures ? 1 : 0;
+}
+
+void HostAdvanceCrystalTimer(unsigned int Ticks)
+{
+  CrystalTimerCount += Ticks;
+}
+
+unsigned int ReadCrystalTimerCount(void)
+{
+  return CrystalTimerCount;
+}
+
+unsigned int HostRandom(void)
+{
+  RandomState = RandomState * 1103515245UL + 12345UL;
+  return (unsigned int)((RandomState >> 16) & 0x7FFF);
+}
+
+void HostSetSendHook(void (*pHook)(void* pQueue))
+{
+  pSendHook = pHook;
+}
+
+void HostSetInterruptHook(void (*pHook)(void))
+{
+  pInterruptHook = pHook;
+}
+
+void* HostLastQueue(void)
+{
+  return LastQueue;
+}
+
+unsigned int HostWatchdogResets(void)
+{
+  return WatchdogResets;
+}
+
+void ForceWatchdogReset(void)
+{
+  WatchdogResets++;
+}
+
+/******************************************************************************/
+
+unsigned short __get_interrupt_state(void)
+{
+  return InterruptState;
+}
+
+void __set_interrupt_state(unsigned short State)
+{
+  InterruptState = State;
+  
+  if ( InterruptState && pInterruptHook )
+  {
+    pInterruptHook();
+  }
+}
+
+void __disable_interrupt(void)
+{
+  InterruptState = 0;
+}
+
+void __enable_interrupt(void)
+{
+  InterruptState = 1;
+  
+  if ( pInterruptHook )
+  {
+    pInterruptHook();
+  }
+}
+
+void __no_operation(void)
+{
+}
+
+/******************************************************************************/
+
+xQueueHandle xQueueCreate(unsigned portBASE_TYPE uxQueueLength,
+                          unsigned portBASE_TYPE uxItemSize)
+{
+  xQueueHandle pQueue = calloc(1, sizeof(xQUEUE));
+  
+  pQueue->uxLength = uxQueueLength;
+  pQueue->uxItemSize = uxItemSize;
+  pQueue->pStorage = calloc(uxQueueLength, uxItemSize ? uxItemSize : 1);
+  
+  LastQueue = pQueue;
+  return pQueue;
+}
+
+static signed portBASE_TYPE CopyToQueue(xQueueHandle xQueue,
+                                        const void* pvItemToQueue)
+{
+  if ( xQueue->uxMessagesWaiting == xQueue->uxLength )
+  {
+    return errQUEUE_FULL;
+  }
+  
+  unsigned portBASE_TYPE Index = 
+    (xQueue->uxReadIndex + xQueue->uxMessagesWaiting) % xQueue->uxLength;
+  
+  if ( xQueue->uxItemSize )
+  {
+    memcpy(xQueue->pStorage + Index * xQueue->uxItemSize,
+           pvItemToQueue,
+           xQueue->uxItemSize);
+  }
+  
+  xQueue->uxMessagesWaiting++;
+  
+  if ( pSendHook && xQueue->uxItemSize )
+  {
+    pSendHook(xQueue);
+  }
+  
+  return pdPASS;
+}
+
+signed portBASE_TYPE xQueueSend(xQueueHandle xQueue,
+                                const void* pvItemToQueue,
+                                portTickType xTicksToWait)
+{
+  return CopyToQueue(xQueue, pvItemToQueue);
+}
+
+signed portBASE_TYPE xQueueSendFromISR(xQueueHandle xQueue,
+                                       const void* pvItemToQueue,
+                                       signed portBASE_TYPE* pxTaskWoken)
+{
+  signed portBASE_TYPE Result = CopyToQueue(xQueue, pvItemToQueue);
+  
+  /* the only task is the one under test and it waits on every queue */
+  if ( Result == pdPASS && pxTaskWoken )
+  {
+    *pxTaskWoken = pdTRUE;
+  }
+  
+  return Result;
+}
+
+static signed portBASE_TYPE CopyFromQueue(xQueueHandle xQueue,
+                                          void* pvBuffer,
+                                          portTickType xTicksToWait,
+                                          unsigned char Remove)
+{
+  if ( xQueue->uxMessagesWaiting == 0 )
+  {
+    /* nothing can send while the host test waits */
+    CHECK(xTicksToWait == DONT_WAIT);
+    return pdFALSE;
+  }
+  
+  if ( xQueue->uxItemSize )
+  {
+    memcpy(pvBuffer,
+           xQueue->pStorage + xQueue->uxReadIndex * xQueue->uxItemSize,
+           xQueue->uxItemSize);
+  }
+  
+  if ( Remove )
+  {
+    xQueue->uxReadIndex = (xQueue->uxReadIndex + 1) % xQueue->uxLength;
+    xQueue->uxMessagesWaiting--;
+  }
+  
+  return pdTRUE;
+}
+
+signed portBASE_TYPE xQueueReceive(xQueueHandle xQueue,
+                                   void* pvBuffer,
+                                   portTickType xTicksToWait)
+{
+  return CopyFromQueue(xQueue, pvBuffer, xTicksToWait, 1);
+}
+
+signed portBASE_TYPE xQueuePeek(xQueueHandle xQueue,
+                                void* pvBuffer,
+                                portTickType xTicksToWait)
+{
+  return CopyFromQueue(xQueue, pvBuffer, xTicksToWait, 0);
+}
+
+/******************************************************************************/
+
+/* The debug uart is not printed.  The tests check the strings (the numbers 
+ * are left out) where they expect an error.
+ */
+
+void PrintString(tString * const pString)
+{
+  if ( Printed < HOST_PRINTS_KEPT )
+  {
+    pPrinted[Printed++] = pString;
+  }
+  
+  Prints++;
+}
+
+void PrintStringAndDecimal(tString * const pString, unsigned int Value)
+{
+  PrintString(pString);
+}
+
+void PrintStringAndHexByte(tString * const pString, unsigned char Value)
+{
+  PrintString(pString);
+}
+
+void PrintStringAndTwoDecimals(tString * const pString1,
+                               unsigned int Value1,
+                               tString * const pString2,
+                               unsigned int Value2)
+{
+  PrintString(pString1);
+}
+
+unsigned char HostPrinted(const char* pString)
+{
+  unsigned char Found = 0;
+  unsigned char i;
+  
+  for ( i = 0; i < Printed; i++ )
+  {
+    if ( strcmp(pString, pPrinted[i]) == 0 )
+    {
+      Found = 1;
+    }
+  }
+  
+  Printed = 0;
+  return Found;
+}
+
+unsigned int HostPrints(void)
+{
+  return Prints;
+}
+
+/* the last trace record is kept for the tests */
+void TraceEvent(unsigned char Id, unsigned char Arg1, unsigned int Arg2)
+{
+  TraceEvents++;
+  LastTraceId = Id;
+  LastTraceArg1 = Arg1;
+}
+
+unsigned int HostTraceEvents(unsigned char* pId, unsigned char* pArg1)
+{
+  if ( pId )
+  {
+    *pId = LastTraceId;
+  }
+  
+  if ( pArg1 )
+  {
+    *pArg1 = LastTraceArg1;
+  }
+  
+  return TraceEvents;
+}
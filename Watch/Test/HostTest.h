@@ -0,0 +1,106 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file HostTest.h
+ *
+ * Checks and helpers shared by the host tests.  The tests compile files from
+ * Watch/Application with gcc against the stand-in headers in Stubs.  Run them
+ * with make in this directory.
+ */
+/******************************************************************************/
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+
+/*! number of checks that failed (the exit code of a test is non-zero when
+ * this is non-zero)
+ */
+extern unsigned int HostFailures;
+
+#define CHECK(_Condition) \
+  do \
+  { \
+    if ( !(_Condition) ) \
+    { \
+      HostFailures++; \
+      printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #_Condition); \
+    } \
+  } while (0)
+
+#define CHECK_EQUAL(_Expected, _Actual) \
+  do \
+  { \
+    long _e = (long)(_Expected); \
+    long _a = (long)(_Actual); \
+    if ( _e != _a ) \
+    { \
+      HostFailures++; \
+      printf("%s:%d: %s is %ld, expected %ld\n", \
+             __FILE__, __LINE__, #_Actual, _a, _e); \
+    } \
+  } while (0)
+
+/*! Print the result of a test and return its exit code */
+int HostTestResult(const char* pName);
+
+/*! Advance the crystal timer count returned by ReadCrystalTimerCount */
+void HostAdvanceCrystalTimer(unsigned int Ticks);
+
+/*! \return a pseudo random number (the sequence is the same for every run) */
+unsigned int HostRandom(void);
+
+/*! Call pHook after an item is put into a queue (before the send returns).
+ * This is where another task could run on target.
+ *
+ * \param pHook is called with the queue or NULL to remove the hook
+ */
+void HostSetSendHook(void (*pHook)(void* pQueue));
+
+/*! Call pHook whenever interrupts are enabled.  This is where a pending 
+ * interrupt would run on target.
+ *
+ * \param pHook is the hook or NULL to remove it
+ */
+void HostSetInterruptHook(void (*pHook)(void));
+
+/*! \return the queue that was created last */
+void* HostLastQueue(void);
+
+/*! \return the number of ForceWatchdogReset calls */
+unsigned int HostWatchdogResets(void);
+
+/*! The debug uart print functions are not printed on the host.
+ * 
+ * \return 1 when pString was printed since the last call (only the string 
+ * arguments are kept, not the numbers)
+ */
+unsigned char HostPrinted(const char* pString);
+
+/*! \return the number of calls to the debug uart print functions */
+unsigned int HostPrints(void);
+
+/*! \return the number of TraceEvent calls
+ *
+ * \param pId is set to the Id of the last record (it can be NULL)
+ * \param pArg1 is set to Arg1 of the last record (it can be NULL)
+ */
+unsigned int HostTraceEvents(unsigned char* pId, unsigned char* pArg1);
+
+#endif /* HOST_TEST_H */
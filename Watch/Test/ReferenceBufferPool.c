@@ -0,0 +1,117 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceBufferPool.c
+ *
+ * The queue based buffer pool that the free list replaced.  BenchBufferPool
+ * times it.  The host queue in HostSupport.c is only a copy into an array; a
+ * FreeRTOS queue also enters a critical section and looks at the lists of
+ * waiting tasks, so on target the difference is larger.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "hal_board_type.h"
+
+#include "Messages.h"
+#include "MessageQueues.h"
+#include "DebugUart.h"
+#include "Utilities.h"
+#include "ReferenceBufferPool.h"
+
+typedef struct
+{
+  unsigned char header[HOST_MSG_HEADER_LENGTH];
+  unsigned char buffer[HOST_MSG_BUFFER_LENGTH-HOST_MSG_HEADER_LENGTH];  
+
+} tBufferPoolBuffer;    
+
+static tBufferPoolBuffer BufferPool[NUM_MSG_BUFFERS];
+
+static const unsigned char* LOW_BUFFER_ADDRESS   = &(BufferPool[0].buffer[0]);
+static const unsigned char* HIGH_BUFFER_ADDRESS  = &(BufferPool[NUM_MSG_BUFFERS - 1].buffer[0]);
+
+static xQueueHandle FreeQueue;
+
+static void SetBufferPoolFailureBit(void)
+{
+  PrintString("************Buffer Pool Failure************\r\n");
+  ForceWatchdogReset();  
+}
+
+void ReferenceInitializeBufferPool( void )
+{
+  unsigned int  ii;
+  unsigned char* pMsgBuffer;
+  
+  FreeQueue =
+    xQueueCreate( ( unsigned portBASE_TYPE ) NUM_MSG_BUFFERS,
+                  ( unsigned portBASE_TYPE ) sizeof(unsigned char*) );
+  
+  for(ii = 0; ii < NUM_MSG_BUFFERS; ii++)
+  {
+      pMsgBuffer = & (BufferPool[ii].buffer[0]);
+  
+      if ( xQueueSend( FreeQueue, &pMsgBuffer, DONT_WAIT ) != pdTRUE )
+      {
+        PrintString("Unable to build Free Queue\r\n");
+        SetBufferPoolFailureBit();
+      }
+  }
+}
+
+unsigned char* ReferenceAllocMessageBuffer(void)
+{
+  unsigned char * pBuffer = NULL;
+
+  if( pdTRUE != xQueueReceive( FreeQueue, &pBuffer, DONT_WAIT ) )
+  {
+    PrintString("Unable to Allocate Buffer\r\n");
+    SetBufferPoolFailureBit();
+  }
+
+  if (   pBuffer < LOW_BUFFER_ADDRESS 
+      || pBuffer > HIGH_BUFFER_ADDRESS )
+  {
+    PrintString("Free Buffer Corruption\r\n");
+    SetBufferPoolFailureBit();
+  }
+
+  return pBuffer;
+
+}
+
+void ReferenceFreeMessageBuffer(unsigned char* pBuffer)
+{
+  if (   pBuffer < LOW_BUFFER_ADDRESS 
+      || pBuffer > HIGH_BUFFER_ADDRESS )
+  {
+    PrintString("Free Buffer Corruption\r\n");
+    SetBufferPoolFailureBit();
+  }
+
+  if( pdTRUE != xQueueSend(FreeQueue, &pBuffer, DONT_WAIT) )
+  {
+    PrintString("Unable to add buffer to Free Queue\r\n");
+    SetBufferPoolFailureBit();
+  }
+
+}
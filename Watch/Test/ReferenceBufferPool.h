@@ -0,0 +1,38 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceBufferPool.h
+ *
+ * The buffer pool before the free list: the free buffers were kept in a 
+ * FreeRTOS queue of pointers.
+ */
+/******************************************************************************/
+
+#ifndef REFERENCE_BUFFER_POOL_H
+#define REFERENCE_BUFFER_POOL_H
+
+/*! InitializeBufferPool (the queue is not in QueueHandles) */
+void ReferenceInitializeBufferPool(void);
+
+/*! BPL_AllocMessageBuffer */
+unsigned char* ReferenceAllocMessageBuffer(void);
+
+/*! BPL_FreeMessageBuffer */
+void ReferenceFreeMessageBuffer(unsigned char* pBuffer);
+
+#endif /* REFERENCE_BUFFER_POOL_H */
@@ -0,0 +1,135 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceLcdBlit.c
+ *
+ * The display buffer loops before they used LcdBlit.  TestLcdBlit compares 
+ * with them and BenchLcdBlit times them.
+ */
+/******************************************************************************/
+
+#include "hal_lcd.h"
+#include "LcdDisplay.h"
+#include "ReferenceLcdBlit.h"
+
+void ReferenceFillMyBuffer(tLcdLine* pBuffer,
+                           unsigned char StartingRow,
+                           unsigned char NumberOfRows,
+                           unsigned char FillValue)
+{
+  int row = StartingRow;
+  int col;
+
+  for( ; row < NUM_LCD_ROWS && row < StartingRow+NumberOfRows; row++ )
+  {
+    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
+    {
+      pBuffer[row].Data[col] = FillValue;
+    }
+  }
+}
+
+void ReferenceInvertRows(tLcdLine* pBuffer,
+                         unsigned char StartingRow,
+                         unsigned char NumberOfRows)
+{
+  int row = StartingRow;
+  int col;
+
+  for( ; row < NUM_LCD_ROWS && row < StartingRow+NumberOfRows; row++)
+  {
+    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
+    {
+      pBuffer[row].Data[col] = ~(pBuffer[row].Data[col]);
+    }
+  }
+}
+
+void ReferenceCopyRowsIntoMyBuffer(tLcdLine* pBuffer,
+                                   unsigned char const* pImage,
+                                   unsigned char StartingRow,
+                                   unsigned char NumberOfRows)
+{
+  unsigned char DestRow = StartingRow;
+  unsigned char SourceRow = 0;
+  unsigned char col = 0;
+
+  while ( DestRow < NUM_LCD_ROWS && SourceRow < NumberOfRows )
+  {
+    for(col = 0; col < NUM_LCD_COL_BYTES; col++)
+    {
+      pBuffer[DestRow].Data[col] = pImage[SourceRow*NUM_LCD_COL_BYTES+col];
+    }
+    DestRow ++;
+    SourceRow ++;
+  }
+}
+
+void ReferenceCopyColumnsIntoMyBuffer(tLcdLine* pBuffer,
+                                      unsigned char const* pImage,
+                                      unsigned char StartingRow,
+                                      unsigned char NumberOfRows,
+                                      unsigned char StartingColumn,
+                                      unsigned char NumberOfColumns)
+{
+  unsigned char DestRow = StartingRow;
+  unsigned char RowCounter = 0;
+  unsigned char DestColumn = StartingColumn;
+  unsigned char ColumnCounter = 0;
+  unsigned int SourceIndex = 0;
+
+  while ( DestRow < NUM_LCD_ROWS && RowCounter < NumberOfRows )
+  {
+    DestColumn = StartingColumn;
+    ColumnCounter = 0;
+    while ( DestColumn < NUM_LCD_COL_BYTES && ColumnCounter < NumberOfColumns )
+    {
+      pBuffer[DestRow].Data[DestColumn] = pImage[SourceIndex];
+
+      DestColumn ++;
+      ColumnCounter ++;
+      SourceIndex ++;
+    }
+
+    DestRow ++;
+    RowCounter ++;
+  }
+}
+
+void ReferenceCopyLine(unsigned char* pDestination,
+                       unsigned char const* pSource,
+                       unsigned char Bytes,
+                       unsigned char Invert)
+{
+  unsigned char i;
+  
+  if ( Invert )
+  {
+    for ( i = 0; i < Bytes; i++ )
+    {
+      pDestination[i] = ~pSource[i]; 
+    }
+  }
+  else
+  {
+    for ( i = 0; i < Bytes; i++ )
+    {
+      pDestination[i] = pSource[i]; 
+    }
+  }
+}
@@ -0,0 +1,65 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceLcdBlit.h
+ *
+ * The byte at a time loops of LcdDisplay.c and LcdDriver.c that LcdBlit.c 
+ * replaced.  They work on a buffer parameter instead of pMyBuffer.
+ */
+/******************************************************************************/
+
+#ifndef REFERENCE_LCD_BLIT_H
+#define REFERENCE_LCD_BLIT_H
+
+/*! FillMyBuffer */
+void ReferenceFillMyBuffer(tLcdLine* pBuffer,
+                           unsigned char StartingRow,
+                           unsigned char NumberOfRows,
+                           unsigned char FillValue);
+
+/*! The inversion in SendMyBufferToLcd and at the end of DrawDateTime */
+void ReferenceInvertRows(tLcdLine* pBuffer,
+                         unsigned char StartingRow,
+                         unsigned char NumberOfRows);
+
+/*! CopyRowsIntoMyBuffer */
+void ReferenceCopyRowsIntoMyBuffer(tLcdLine* pBuffer,
+                                   unsigned char const* pImage,
+                                   unsigned char StartingRow,
+                                   unsigned char NumberOfRows);
+
+/*! CopyColumnsIntoMyBuffer (it stepped through the image by the clipped 
+ * width when the rectangle was past the right edge) 
+ */
+void ReferenceCopyColumnsIntoMyBuffer(tLcdLine* pBuffer,
+                                      unsigned char const* pImage,
+                                      unsigned char StartingRow,
+                                      unsigned char NumberOfRows,
+                                      unsigned char StartingColumn,
+                                      unsigned char NumberOfColumns);
+
+/*! The bit flip of AddLcdBurstLine (StartLcdLineWrite inverted in place) 
+ *
+ * \param Bytes was NUM_LCD_COL_BYTES
+ */
+void ReferenceCopyLine(unsigned char* pDestination,
+                       unsigned char const* pSource,
+                       unsigned char Bytes,
+                       unsigned char Invert);
+
+#endif /* REFERENCE_LCD_BLIT_H */
@@ -0,0 +1,286 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceLcdIdle.c
+ *
+ * The drawing of DrawDateTime before LcdIdle.c split it into fields.  The
+ * rtc and the settings are read from a tLcdIdleState and the characters are
+ * drawn a pixel at a time.  TestLcdIdle compares with it.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "hal_board_type.h"
+#include "Fonts.h"
+#include "Icons.h"
+#include "Display.h"
+#include "LcdDisplay.h"
+#include "LcdText.h"
+#include "LcdIdle.h"
+#include "ReferenceLcdText.h"
+#include "ReferenceLcdBlit.h"
+#include "ReferenceLcdIdle.h"
+
+static const unsigned char Am[10*4] =
+{
+  0x00,0x00,0x9C,0xA2,0xA2,0xA2,0xBE,0xA2,0xA2,0x00,
+  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static const unsigned char Pm[10*4] =
+{
+  0x00,0x00,0x9E,0xA2,0xA2,0x9E,0x82,0x82,0x82,0x00,
+  0x00,0x00,0x08,0x0D,0x0A,0x08,0x08,0x08,0x08,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+  0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
+};
+
+static tLcdLine* pMyBuffer;
+static tLcdTextPosition gText;
+
+static void WriteFontCharacter(unsigned char Character)
+{
+  ReferenceWriteCharacter(pMyBuffer, &gText, Character);
+}
+
+static void WriteFontString(tString *pString)
+{
+  unsigned char i = 0;
+
+  while (pString[i] != 0 && gText.Column < NUM_LCD_COL_BYTES)
+  {
+    WriteFontCharacter(pString[i++]);
+  }
+}
+
+static void DrawStatusIconCross(unsigned char bool)
+{
+  if ( !bool )
+  {
+    WriteFontCharacter(STATUS_ICON_CROSS);
+  }
+}
+
+/* these items are 4w by 10h */
+static void WriteIcon4w10h(unsigned char const * pIcon,
+                           unsigned char RowOffset,
+                           unsigned char ColumnOffset)
+{
+  unsigned char RowNumber;
+  unsigned char Column;
+
+  for ( Column = 0; Column < 4; Column++ )
+  {
+    for ( RowNumber = 0; RowNumber < 10; RowNumber++ )
+    {
+      pMyBuffer[RowNumber+RowOffset].Data[Column+ColumnOffset] |=
+        pIcon[RowNumber+(Column*10)];
+    }
+  }
+}
+
+static void DisplayDate(tLcdIdleState const* pState)
+{
+  gText.BitColumnMask = BIT2;
+  gText.Row = 2;
+  gText.Column = 0;
+  SetFont(MetaWatch5);
+  WriteFontString((tString *)pState->pDayOfWeek);
+
+  if ( pState->OnceConnected )
+  {
+    WriteFontCharacter(' ');
+
+    int First;
+    int Second;
+
+    /* determine if month or day is displayed first */
+    if ( pState->DateFormat == MONTH_FIRST )
+    {
+      First = pState->Month;
+      Second = pState->Day;
+    }
+    else
+    {
+      First = pState->Day;
+      Second = pState->Month;
+    }
+
+    WriteFontCharacter(First/10+'0');
+    WriteFontCharacter(First%10+'0');
+    WriteFontCharacter('.');
+    WriteFontCharacter(Second/10+'0');
+    WriteFontCharacter(Second%10+'0');
+
+    WriteFontCharacter('.');
+
+    int year = pState->Year;
+    WriteFontCharacter(year/1000+'0');
+    year %= 1000;
+    WriteFontCharacter(year/100+'0');
+    year %= 100;
+    WriteFontCharacter(year/10+'0');
+    year %= 10;
+    WriteFontCharacter(year+'0');
+  }
+}
+
+void ReferenceDrawIdle(tLcdLine* pBuffer, tLcdIdleState const* pState)
+{
+  unsigned char msd;
+  unsigned char lsd;
+
+  pMyBuffer = pBuffer;
+  
+  /* display hour */
+  int Hour = pState->Hour;
+
+  /* if required convert to twelve hour format */
+  if ( pState->TimeFormat == TWELVE_HOUR )
+  {
+    Hour %= 12;
+    if (Hour == 0) Hour = 12;
+  }
+  
+  msd = Hour / 10;
+  lsd = Hour % 10;
+
+  // clean date&time area
+  ReferenceFillMyBuffer(pBuffer, 0, WATCH_DRAWN_IDLE_BUFFER_ROWS, 0x00);
+
+  if ( pState->LinkLost )
+  {
+    ReferenceCopyColumnsIntoMyBuffer(pBuffer,
+                                     pPhoneDisconnectedIdlePageIcon,
+                                     10,
+                                     IDLE_PAGE_ICON_SIZE_IN_ROWS,
+                                     1,
+                                     IDLE_PAGE_ICON_SIZE_IN_COLS);
+
+    SetFont(MetaWatch16);
+
+    gText.Column = 3;
+    gText.BitColumnMask = BIT4;
+    gText.Row = 11;
+    WriteFontString("Link Lost");
+  }
+  else
+  {
+    gText.Row = 10;
+    if ( pState->DisplaySeconds )
+    {
+      gText.Column = 0;
+      gText.BitColumnMask = BIT6;
+    }
+    else
+    {
+      gText.Column = 1;
+      gText.BitColumnMask = BIT2;
+    }
+    SetFont(MetaWatchTime);
+
+    /* if first digit is zero then leave location blank */
+    if ( msd == 0 && pState->TimeFormat == TWELVE_HOUR )
+    {
+      WriteFontCharacter(TIME_CHARACTER_SPACE_INDEX);
+    }
+    else
+    {
+      WriteFontCharacter(msd);
+    }
+
+    WriteFontCharacter(lsd);
+
+    WriteFontCharacter(TIME_CHARACTER_COLON_INDEX);
+
+    /* display minutes */
+    int Minutes = pState->Minutes;
+    msd = Minutes / 10;
+    lsd = Minutes % 10;
+    WriteFontCharacter(msd);
+    WriteFontCharacter(lsd);
+
+    if ( pState->DisplaySeconds )
+    {
+      int Seconds = pState->Seconds;
+      msd = Seconds / 10;
+      lsd = Seconds % 10;
+
+      SetFont(MetaWatchSeconds);
+
+      int mask = gText.BitColumnMask;
+      gText.Row = 10;
+      gText.Column = 10;
+      WriteFontCharacter(msd);
+      gText.Row = 19;
+      gText.Column = 10;
+      gText.BitColumnMask = mask;
+      WriteFontCharacter(lsd);
+    }
+
+    if ( pState->TimeFormat == TWELVE_HOUR ) 
+    {
+      WriteIcon4w10h(( pState->Hour >= 12 ) ? Pm : Am, 16, 0);
+    }
+  }
+
+  SetFont(StatusIcons);
+  gText.Row = 2;
+
+  if ( pState->OnceConnected )
+  {
+    char bluetooth = pState->BluetoothOn;
+    char connected = pState->PhoneConnected;
+
+    if ( (!bluetooth) || (bluetooth&&connected) ) {
+      gText.Column = 8;
+      gText.BitColumnMask = BIT5;
+    }
+    else
+    {
+      gText.Column = 8;
+      gText.BitColumnMask = BIT1;
+    }
+
+    DrawStatusIconCross( bluetooth );
+    WriteFontCharacter(STATUS_ICON_BLUETOOTH);
+
+    if (bluetooth) {
+      AdvanceLcdText(&gText, 1);
+      DrawStatusIconCross( connected );
+      WriteFontCharacter(STATUS_ICON_PHONE);
+    }
+  }
+
+  gText.Column = 10;
+  gText.BitColumnMask = BIT0;
+  if ( pState->Charging )
+  {
+    WriteFontCharacter(STATUS_ICON_SPARK);
+  }
+
+  gText.Column = 10;
+  gText.BitColumnMask = BIT6;
+  WriteFontCharacter(pState->Battery);
+
+  DisplayDate(pState);
+}
@@ -0,0 +1,33 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceLcdIdle.h
+ *
+ * DrawDateTime before it redrew only the fields that changed.
+ */
+/******************************************************************************/
+
+#ifndef REFERENCE_LCD_IDLE_H
+#define REFERENCE_LCD_IDLE_H
+
+/*! Clear the watch drawn idle area and draw all of it (without the 
+ * inversion and the update of the LCD) 
+ */
+void ReferenceDrawIdle(tLcdLine* pBuffer, tLcdIdleState const* pState);
+
+#endif /* REFERENCE_LCD_IDLE_H */
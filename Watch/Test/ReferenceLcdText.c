@@ -0,0 +1,83 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceLcdText.c
+ *
+ * The per-pixel drawing of WriteFontCharacter before it worked a row at a 
+ * time.  TestLcdText compares with it and BenchLcdText times it.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "Fonts.h"
+#include "LcdDisplay.h"
+#include "LcdText.h"
+#include "ReferenceLcdText.h"
+
+static void ReferenceAdvance(tLcdTextPosition* pPosition, unsigned int Pixels)
+{
+  unsigned int i;
+  
+  for ( i = 0; i < Pixels; i++ )
+  {
+    pPosition->BitColumnMask = pPosition->BitColumnMask << 1;
+    if ( pPosition->BitColumnMask == 0 )
+    {
+      pPosition->BitColumnMask = BIT0;
+      pPosition->Column++;
+    }
+  }
+}
+
+void ReferenceWriteCharacter(tLcdLine* pBuffer,
+                             tLcdTextPosition* pPosition,
+                             unsigned char Character)
+{
+  unsigned int Bitmap[MAX_FONT_ROWS];
+  unsigned int CharacterMask = BIT0;
+  unsigned char Rows = GetCharacterHeight();
+  unsigned char Width = GetCharacterWidth(Character);
+  unsigned char i;
+  unsigned char row;
+  
+  GetCharacterBitmap(Character, Bitmap);
+  
+  if ( pPosition->Row + Rows > NUM_LCD_ROWS )
+  {
+    return;
+  }
+  
+  for ( i = 0; i < Width && pPosition->Column < NUM_LCD_COL_BYTES; i++ )
+  {
+    for ( row = 0; row < Rows; row++ )
+    {
+      if ( (CharacterMask & Bitmap[row]) != 0 )
+      {
+        pBuffer[pPosition->Row + row].Data[pPosition->Column] |= 
+          pPosition->BitColumnMask;
+      }
+    }
+    
+    CharacterMask = CharacterMask << 1;
+    ReferenceAdvance(pPosition, 1);
+  }
+  
+  ReferenceAdvance(pPosition, GetFontSpacing());
+}
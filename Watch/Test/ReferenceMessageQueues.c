@@ -0,0 +1,218 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceMessageQueues.c
+ *
+ * RouteMsg and PrintMessageType before the routing table.  The cases are 
+ * the ones of the old switch statements; the queue they sent to is returned
+ * instead of sending the message.  TestMessageQueues compares the table with
+ * them and BenchMessageQueues times them.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "Messages.h"
+#include "MessageQueues.h"
+#include "ReferenceMessageQueues.h"
+
+unsigned char ReferenceRouteQindex(unsigned char Type)
+{
+  switch (Type)
+  {
+  case InvalidMessage:                return FREE_QINDEX;
+  case GetDeviceType:                 return BACKGROUND_QINDEX;
+  case GetDeviceTypeResponse:         return SPP_TASK_QINDEX;
+  case GetInfoString:                 return BACKGROUND_QINDEX;
+  case GetInfoStringResponse:         return SPP_TASK_QINDEX;
+  case DiagnosticLoopback:            return SPP_TASK_QINDEX;
+  case EnterShippingModeMsg:          return SPP_TASK_QINDEX;
+  case SoftwareResetMsg:              return BACKGROUND_QINDEX;
+  case ConnectionTimeoutMsg:          return SPP_TASK_QINDEX;
+  case TurnRadioOnMsg:                return SPP_TASK_QINDEX;
+  case TurnRadioOffMsg:               return SPP_TASK_QINDEX;
+  case ReadRssiMsg:                   return SPP_TASK_QINDEX;
+  case PairingControlMsg:             return SPP_TASK_QINDEX;
+  case ReadRssiResponseMsg:           return SPP_TASK_QINDEX;
+  case SniffControlMsg:               return SPP_TASK_QINDEX;
+  case LinkAlarmMsg:                  return DISPLAY_QINDEX;
+  case OledWriteBufferMsg:            return DISPLAY_QINDEX;
+  case OledConfigureModeMsg:          return DISPLAY_QINDEX;
+  case OledChangeModeMsg:             return DISPLAY_QINDEX;
+  case OledWriteScrollBufferMsg:      return DISPLAY_QINDEX;
+  case OledScrollMsg:                 return DISPLAY_QINDEX;
+  case OledShowIdleBufferMsg:         return DISPLAY_QINDEX;
+  case OledCrownMenuMsg:              return DISPLAY_QINDEX;
+  case OledCrownMenuButtonMsg:        return DISPLAY_QINDEX;
+  case AdvanceWatchHandsMsg:          return BACKGROUND_QINDEX;
+  case SetVibrateMode:                return BACKGROUND_QINDEX;
+  case ButtonStateMsg:                return BACKGROUND_QINDEX;
+  case SetRealTimeClock:              return BACKGROUND_QINDEX;
+  case GetRealTimeClock:              return BACKGROUND_QINDEX;
+  case GetRealTimeClockResponse:      return SPP_TASK_QINDEX;
+  case StatusChangeEvent:             return SPP_TASK_QINDEX;
+  case NvalOperationMsg:              return BACKGROUND_QINDEX;
+  case NvalOperationResponseMsg:      return SPP_TASK_QINDEX;
+  case GeneralPurposePhoneMsg:        return SPP_TASK_QINDEX;
+  case GeneralPurposeWatchMsg:        return BACKGROUND_QINDEX;
+  case ButtonEventMsg:                return SPP_TASK_QINDEX;
+  case WriteBuffer:                   return DISPLAY_QINDEX;
+  case ConfigureDisplay:              return DISPLAY_QINDEX;
+  case ConfigureIdleBufferSize:       return DISPLAY_QINDEX;
+  case UpdateDisplay:                 return DISPLAY_QINDEX;
+  case LoadTemplate:                  return DISPLAY_QINDEX;
+  case EnableButtonMsg:               return BACKGROUND_QINDEX;
+  case DisableButtonMsg:              return BACKGROUND_QINDEX;
+  case ReadButtonConfigMsg:           return BACKGROUND_QINDEX;
+  case ReadButtonConfigResponse:      return BACKGROUND_QINDEX;
+  case BatteryChargeControl:          return BACKGROUND_QINDEX;
+  case IdleUpdate:                    return DISPLAY_QINDEX;
+  case WatchDrawnScreenTimeout:       return DISPLAY_QINDEX;
+  case SplashTimeoutMsg:              return DISPLAY_QINDEX;
+  case ChangeModeMsg:                 return DISPLAY_QINDEX;
+  case ModeTimeoutMsg:                return DISPLAY_QINDEX;
+  case WatchStatusMsg:                return DISPLAY_QINDEX;
+  case MenuModeMsg:                   return DISPLAY_QINDEX;
+  case BarCode:                       return DISPLAY_QINDEX;
+  case ListPairedDevicesMsg:          return DISPLAY_QINDEX;
+  case ConnectionStateChangeMsg:      return DISPLAY_QINDEX;
+  case ModifyTimeMsg:                 return DISPLAY_QINDEX;
+  case MenuButtonMsg:                 return DISPLAY_QINDEX;
+  case ToggleSecondsMsg:              return DISPLAY_QINDEX;
+  case LedChange:                     return BACKGROUND_QINDEX;
+  case AccelerometerHostMsg:          return SPP_TASK_QINDEX;
+  case AccelerometerEnableMsg:        return BACKGROUND_QINDEX;
+  case AccelerometerDisableMsg:       return BACKGROUND_QINDEX;
+  case AccelerometerSendDataMsg:      return BACKGROUND_QINDEX;
+  case AccelerometerAccessMsg:        return BACKGROUND_QINDEX;
+  case AccelerometerResponseMsg:      return BACKGROUND_QINDEX;
+  case AccelerometerSetupMsg:         return BACKGROUND_QINDEX;
+  case QueryMemoryMsg:                return SPP_TASK_QINDEX;
+  case RamTestMsg:                    return DISPLAY_QINDEX;
+  case RateTestMsg:                   return BACKGROUND_QINDEX;
+  case BatteryConfigMsg:              return BACKGROUND_QINDEX;
+  case LowBatteryWarningMsgHost:      return SPP_TASK_QINDEX;
+  case LowBatteryBtOffMsgHost:        return SPP_TASK_QINDEX;
+  case ReadBatteryVoltageMsg:         return BACKGROUND_QINDEX;
+  case ReadBatteryVoltageResponse:    return SPP_TASK_QINDEX;
+  case ReadLightSensorMsg:            return BACKGROUND_QINDEX;
+  case ReadLightSensorResponse:       return SPP_TASK_QINDEX;
+  case LowBatteryWarningMsg:          return DISPLAY_QINDEX;
+  case LowBatteryBtOffMsg:            return DISPLAY_QINDEX;
+  case AdvertisingDataMsg:            return SPP_TASK_QINDEX;
+  case CallbackTimeoutMsg:            return SPP_TASK_QINDEX;
+  case SetCallbackTimerMsg:           return BACKGROUND_QINDEX;
+  case RadioPowerControlMsg:          return SPP_TASK_QINDEX;
+  case UpdateConnParameterMsg:        return SPP_TASK_QINDEX;
+  default:                            return FREE_QINDEX;
+  }
+}
+
+/* the cases that were commented out did not print */
+unsigned char ReferencePrintType(unsigned char Type)
+{
+  switch (Type)
+  {
+  case InvalidMessage:                return REFERENCE_PRINTED;
+  case GetDeviceType:                 return REFERENCE_PRINTED;
+  case GetDeviceTypeResponse:         return REFERENCE_PRINTED;
+  case GetInfoString:                 return REFERENCE_PRINTED;
+  case GetInfoStringResponse:         return REFERENCE_PRINTED;
+  case DiagnosticLoopback:            return REFERENCE_PRINTED;
+  case EnterShippingModeMsg:          return REFERENCE_PRINTED;
+  case SoftwareResetMsg:              return REFERENCE_PRINTED;
+  case ConnectionTimeoutMsg:          return REFERENCE_PRINTED;
+  case TurnRadioOnMsg:                return REFERENCE_PRINTED;
+  case TurnRadioOffMsg:               return REFERENCE_PRINTED;
+  case ReadRssiMsg:                   return REFERENCE_PRINTED;
+  case PairingControlMsg:             return REFERENCE_PRINTED;
+  case ReadRssiResponseMsg:           return REFERENCE_PRINTED;
+  case SniffControlMsg:               return REFERENCE_PRINTED;
+  case LinkAlarmMsg:                  return REFERENCE_PRINTED;
+  case OledWriteBufferMsg:            return REFERENCE_PRINTED;
+  case OledConfigureModeMsg:          return REFERENCE_PRINTED;
+  case OledChangeModeMsg:             return REFERENCE_PRINTED;
+  case OledWriteScrollBufferMsg:      return REFERENCE_PRINTED;
+  case OledScrollMsg:                 return REFERENCE_PRINTED;
+  case OledShowIdleBufferMsg:         return REFERENCE_PRINTED;
+  case OledCrownMenuMsg:              return REFERENCE_PRINTED;
+  case OledCrownMenuButtonMsg:        return REFERENCE_PRINTED;
+  case AdvanceWatchHandsMsg:          return REFERENCE_PRINTED;
+  case SetVibrateMode:                return REFERENCE_PRINTED;
+  case ButtonStateMsg:                return REFERENCE_NOT_PRINTED;
+  case SetRealTimeClock:              return REFERENCE_PRINTED;
+  case GetRealTimeClock:              return REFERENCE_PRINTED;
+  case GetRealTimeClockResponse:      return REFERENCE_PRINTED;
+  case StatusChangeEvent:             return REFERENCE_PRINTED;
+  case NvalOperationMsg:              return REFERENCE_PRINTED;
+  case NvalOperationResponseMsg:      return REFERENCE_PRINTED;
+  case GeneralPurposePhoneMsg:        return REFERENCE_PRINTED;
+  case GeneralPurposeWatchMsg:        return REFERENCE_PRINTED;
+  case ButtonEventMsg:                return REFERENCE_PRINTED;
+  case WriteBuffer:                   return REFERENCE_NOT_PRINTED;
+  case ConfigureDisplay:              return REFERENCE_PRINTED;
+  case ConfigureIdleBufferSize:       return REFERENCE_PRINTED;
+  case UpdateDisplay:                 return REFERENCE_PRINTED;
+  case LoadTemplate:                  return REFERENCE_PRINTED;
+  case EnableButtonMsg:               return REFERENCE_PRINTED;
+  case DisableButtonMsg:              return REFERENCE_PRINTED;
+  case ReadButtonConfigMsg:           return REFERENCE_PRINTED;
+  case ReadButtonConfigResponse:      return REFERENCE_PRINTED;
+  case BatteryChargeControl:          return REFERENCE_NOT_PRINTED;
+  case IdleUpdate:                    return REFERENCE_PRINTED;
+  case WatchDrawnScreenTimeout:       return REFERENCE_PRINTED;
+  case SplashTimeoutMsg:              return REFERENCE_PRINTED;
+  case ChangeModeMsg:                 return REFERENCE_NOT_PRINTED;
+  case ModeTimeoutMsg:                return REFERENCE_PRINTED;
+  case WatchStatusMsg:                return REFERENCE_PRINTED;
+  case MenuModeMsg:                   return REFERENCE_PRINTED;
+  case BarCode:                       return REFERENCE_PRINTED;
+  case ListPairedDevicesMsg:          return REFERENCE_PRINTED;
+  case ConnectionStateChangeMsg:      return REFERENCE_PRINTED;
+  case ModifyTimeMsg:                 return REFERENCE_PRINTED;
+  case MenuButtonMsg:                 return REFERENCE_PRINTED;
+  case ToggleSecondsMsg:              return REFERENCE_PRINTED;
+  case LedChange:                     return REFERENCE_PRINTED;
+  case AccelerometerHostMsg:          return REFERENCE_PRINTED;
+  case AccelerometerEnableMsg:        return REFERENCE_PRINTED;
+  case AccelerometerDisableMsg:       return REFERENCE_PRINTED;
+  case AccelerometerSendDataMsg:      return REFERENCE_PRINTED;
+  case AccelerometerAccessMsg:        return REFERENCE_PRINTED;
+  case AccelerometerResponseMsg:      return REFERENCE_PRINTED;
+  case AccelerometerSetupMsg:         return REFERENCE_PRINTED;
+  case QueryMemoryMsg:                return REFERENCE_PRINTED;
+  case RamTestMsg:                    return REFERENCE_PRINTED;
+  case RateTestMsg:                   return REFERENCE_PRINTED;
+  case BatteryConfigMsg:              return REFERENCE_PRINTED;
+  case LowBatteryWarningMsgHost:      return REFERENCE_PRINTED;
+  case LowBatteryBtOffMsgHost:        return REFERENCE_PRINTED;
+  case ReadBatteryVoltageMsg:         return REFERENCE_PRINTED;
+  case ReadBatteryVoltageResponse:    return REFERENCE_PRINTED;
+  case ReadLightSensorMsg:            return REFERENCE_PRINTED;
+  case ReadLightSensorResponse:       return REFERENCE_PRINTED;
+  case LowBatteryWarningMsg:          return REFERENCE_PRINTED;
+  case LowBatteryBtOffMsg:            return REFERENCE_PRINTED;
+  case RadioPowerControlMsg:          return REFERENCE_PRINTED;
+  case AdvertisingDataMsg:            return REFERENCE_PRINTED;
+  case CallbackTimeoutMsg:            return REFERENCE_NOT_PRINTED;
+  case SetCallbackTimerMsg:           return REFERENCE_NOT_PRINTED;
+  case UpdateConnParameterMsg:        return REFERENCE_PRINTED;
+  default:                            return REFERENCE_UNKNOWN;
+  }
+}
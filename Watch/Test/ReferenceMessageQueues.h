@@ -0,0 +1,39 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file ReferenceMessageQueues.h
+ *
+ * The switch statements of RouteMsg and PrintMessageType that the routing 
+ * table generated from MESSAGE_TYPE_LIST replaced.
+ */
+/******************************************************************************/
+
+#ifndef REFERENCE_MESSAGE_QUEUES_H
+#define REFERENCE_MESSAGE_QUEUES_H
+
+/*! \return the queue index the switch in RouteMsg sent a message type to */
+unsigned char ReferenceRouteQindex(unsigned char Type);
+
+#define REFERENCE_NOT_PRINTED ( 0 )
+#define REFERENCE_PRINTED     ( 1 )
+#define REFERENCE_UNKNOWN     ( 2 )
+
+/*! \return how the switch in PrintMessageType printed a message type */
+unsigned char ReferencePrintType(unsigned char Type);
+
+#endif /* REFERENCE_MESSAGE_QUEUES_H */
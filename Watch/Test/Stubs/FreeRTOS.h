@@ -0,0 +1,58 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file FreeRTOS.h
+ *
+ * Host stand-in for the FreeRTOS headers.  The types and macros match the 
+ * MSP430 port (portmacro.h and FreeRTOSConfig.h) closely enough to compile
+ * the application files under test.  The queues are in HostSupport.c.
+ */
+/******************************************************************************/
+
+#ifndef INC_FREERTOS_H
+#define INC_FREERTOS_H
+
+#include <stddef.h>
+
+#include "msp430.h"
+
+#define portCHAR       char
+#define portLONG       long
+#define portSHORT      int
+#define portBASE_TYPE  portSHORT
+
+typedef unsigned portSHORT portTickType;
+typedef char tString;
+
+#define portMAX_DELAY ( portTickType ) 0xffff
+
+#define pdTRUE        ( 1 )
+#define pdFALSE       ( 0 )
+#define pdPASS        ( 1 )
+#define pdFAIL        ( 0 )
+#define errQUEUE_FULL ( 0 )
+
+#define DONT_WAIT ( 0 )
+
+/* an interrupt that wakes a task switches to it (HostPeripherals.c) */
+void HostYield(void);
+#define portYIELD() HostYield()
+
+#define portENTER_CRITICAL() __disable_interrupt()
+#define portEXIT_CRITICAL()  __enable_interrupt()
+
+#endif /* INC_FREERTOS_H */
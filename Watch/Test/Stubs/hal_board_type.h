@@ -0,0 +1,70 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_board_type.h
+ *
+ * Host stand-in for the board definitions.  The values match 
+ * Watch/Hardware/hal_board_type.h.
+ */
+/******************************************************************************/
+
+#ifndef HAL_BOARD_TYPE_H
+#define HAL_BOARD_TYPE_H
+
+#include "msp430.h"
+
+/*! number of buffers in the message buffer pool */
+#define NUM_MSG_BUFFERS 20
+
+/* the chip selects of the serial ram and the lcd are seen by the models in
+ * HostPeripherals.c (the pins are the ones of the analog board)
+ */
+void HostSelectSram(unsigned char Select);
+void HostSelectLcd(unsigned char Select);
+
+#define SRAM_SCLK_PSEL ( P3SEL )
+#define SRAM_SCLK_PIN  ( BIT0 )
+#define SRAM_SOMI_PSEL ( P3SEL )
+#define SRAM_SOMI_PIN  ( BIT5 )
+#define SRAM_SIMO_PSEL ( P3SEL )
+#define SRAM_SIMO_PIN  ( BIT4 )
+
+#define WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE() { (void)UCA0STAT; }
+#define SRAM_CSN_ASSERT() { HostSelectSram(1); }
+#define SRAM_CSN_DEASSERT() { \
+  WAIT_FOR_SRAM_SPI_SHIFT_COMPLETE(); \
+  HostSelectSram(0); \
+}
+
+#define LCD_5V_PDIR P4DIR
+#define LCD_5V_POUT P4OUT
+#define LCD_5V_BIT  BIT0
+
+#define LCD_CS_ASSERT()   { HostSelectLcd(1); }
+#define LCD_CS_DEASSERT() { HostSelectLcd(0); }
+#define CONFIG_LCD_PINS() { LCD_CS_DEASSERT(); }
+
+#define LCD_SPI_UCBxCTL0  UCB0CTL0
+#define LCD_SPI_UCBxCTL1  UCB0CTL1
+#define LCD_SPI_UCBxBR0   UCB0BR0
+#define LCD_SPI_UCBxBR1   UCB0BR1
+#define LCD_SPI_UCBxTXBUF UCB0TXBUF
+#define LCD_SPI_UCBxRXBUF UCB0RXBUF
+#define LCD_SPI_UCBxIFG   UCB0IFG
+#define LCD_SPI_UCBxSTAT  UCB0STAT
+
+#endif /* HAL_BOARD_TYPE_H */
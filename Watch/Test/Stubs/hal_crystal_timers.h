@@ -0,0 +1,30 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file hal_crystal_timers.h
+ *
+ * Host stand-in for the crystal timer.  The count is advanced by the test.
+ */
+/******************************************************************************/
+
+#ifndef HAL_CRYSTAL_TIMERS
+#define HAL_CRYSTAL_TIMERS
+
+/*! \return the count of the free running crystal timer */
+unsigned int ReadCrystalTimerCount(void);
+
+#endif /* HAL_CRYSTAL_TIMERS */
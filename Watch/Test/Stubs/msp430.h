@@ -0,0 +1,174 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file msp430.h
+ *
+ * Host stand-in for the compiler's msp430.h.  Only the bit names, the
+ * interrupt intrinsics and the peripherals used by the application files 
+ * under test are here.  The USCI and DMA registers are modelled in 
+ * HostPeripherals.c.
+ */
+/******************************************************************************/
+
+#ifndef HOST_MSP430_H
+#define HOST_MSP430_H
+
+#define BIT0 (0x0001)
+#define BIT1 (0x0002)
+#define BIT2 (0x0004)
+#define BIT3 (0x0008)
+#define BIT4 (0x0010)
+#define BIT5 (0x0020)
+#define BIT6 (0x0040)
+#define BIT7 (0x0080)
+#define BIT8 (0x0100)
+#define BIT9 (0x0200)
+#define BITA (0x0400)
+#define BITB (0x0800)
+#define BITC (0x1000)
+#define BITD (0x2000)
+#define BITE (0x4000)
+#define BITF (0x8000)
+
+unsigned short __get_interrupt_state(void);
+void __set_interrupt_state(unsigned short State);
+void __disable_interrupt(void);
+void __enable_interrupt(void);
+void __no_operation(void);
+
+#define __interrupt
+#define __even_in_range(_Value, _Range) (_Value)
+
+/* the interrupt is called by the dma model */
+#define DMA_VECTOR ( 0 )
+
+void HostExitLpm(void);
+#define LPM3_EXIT HostExitLpm()
+
+/* ports (only written) */
+extern unsigned char P3DIR, P3OUT, P3SEL, P4DIR, P4OUT, P9DIR, P9OUT;
+
+/*
+ * USCI in SPI mode.  A byte written to TXBUF is sent when the flags or the 
+ * status are read next (every driver polls one of them).  The transmit 
+ * buffer holds HOST_USCI_EMPTY when there is nothing to send.
+ */
+typedef struct
+{
+  unsigned char Ctl0;
+  unsigned char Ctl1;
+  unsigned char Br0;
+  unsigned char Br1;
+  unsigned short TxBuf;
+  unsigned char RxBuf;
+  
+} tHostUsci;
+
+#define HOST_USCI_EMPTY ( 0xFFFF )
+
+extern tHostUsci HostUsciA0;
+extern tHostUsci HostUsciB0;
+
+unsigned char HostUsciFlags(tHostUsci* pUsci);
+unsigned char HostUsciStatus(tHostUsci* pUsci);
+
+#define UCA0CTL0  ( HostUsciA0.Ctl0 )
+#define UCA0CTL1  ( HostUsciA0.Ctl1 )
+#define UCA0BR0   ( HostUsciA0.Br0 )
+#define UCA0BR1   ( HostUsciA0.Br1 )
+#define UCA0TXBUF ( HostUsciA0.TxBuf )
+#define UCA0RXBUF ( HostUsciA0.RxBuf )
+#define UCA0IFG   ( HostUsciFlags(&HostUsciA0) )
+#define UCA0STAT  ( HostUsciStatus(&HostUsciA0) )
+
+#define UCB0CTL0  ( HostUsciB0.Ctl0 )
+#define UCB0CTL1  ( HostUsciB0.Ctl1 )
+#define UCB0BR0   ( HostUsciB0.Br0 )
+#define UCB0BR1   ( HostUsciB0.Br1 )
+#define UCB0TXBUF ( HostUsciB0.TxBuf )
+#define UCB0RXBUF ( HostUsciB0.RxBuf )
+#define UCB0IFG   ( HostUsciFlags(&HostUsciB0) )
+#define UCB0STAT  ( HostUsciStatus(&HostUsciB0) )
+
+#define UCSWRST       ( 0x01 )
+#define UCSSEL_2      ( 0x80 )
+#define UCSSEL__SMCLK ( 0x80 )
+#define UCSYNC        ( 0x01 )
+#define UCMST         ( 0x08 )
+#define UCMSB         ( 0x20 )
+#define UCCKPH        ( 0x80 )
+#define UCRXIFG       ( 0x01 )
+#define UCTXIFG       ( 0x02 )
+
+/*
+ * DMA channels 0 to 2.  The address registers are written with 
+ * __data16_write_addr so they hold host pointers.
+ */
+typedef struct
+{
+  unsigned short Ctl;
+  unsigned long Sa;
+  unsigned long Da;
+  unsigned short Sz;
+  
+} tHostDmaChannel;
+
+typedef struct
+{
+  unsigned short Ctl0;
+  unsigned short Ctl1;
+  unsigned short Iv;
+  tHostDmaChannel Channel[3];
+  
+} tHostDma;
+
+extern tHostDma HostDma;
+
+void __data16_write_addr(unsigned short Address, unsigned long Value);
+
+#define DMACTL0 ( HostDma.Ctl0 )
+#define DMACTL1 ( HostDma.Ctl1 )
+#define DMAIV   ( HostDma.Iv )
+#define DMA0CTL ( HostDma.Channel[0].Ctl )
+#define DMA0SA  ( HostDma.Channel[0].Sa )
+#define DMA0DA  ( HostDma.Channel[0].Da )
+#define DMA0SZ  ( HostDma.Channel[0].Sz )
+#define DMA1CTL ( HostDma.Channel[1].Ctl )
+#define DMA1SA  ( HostDma.Channel[1].Sa )
+#define DMA1DA  ( HostDma.Channel[1].Da )
+#define DMA1SZ  ( HostDma.Channel[1].Sz )
+#define DMA2CTL ( HostDma.Channel[2].Ctl )
+#define DMA2SA  ( HostDma.Channel[2].Sa )
+#define DMA2DA  ( HostDma.Channel[2].Da )
+#define DMA2SZ  ( HostDma.Channel[2].Sz )
+
+#define DMA0TSEL_17  ( 17 )
+#define DMA1TSEL_16  ( 16 << 8 )
+#define DMA2TSEL_19  ( 19 )
+
+#define DMADT_0      ( 0x0000 )
+#define DMADSTINCR_3 ( 0x0C00 )
+#define DMASRCINCR_3 ( 0x0300 )
+#define DMADSTBYTE   ( 0x0080 )
+#define DMASRCBYTE   ( 0x0040 )
+#define DMASBDB      ( DMASRCBYTE + DMADSTBYTE )
+#define DMALEVEL     ( 0x0020 )
+#define DMAEN        ( 0x0010 )
+#define DMAIFG       ( 0x0008 )
+#define DMAIE        ( 0x0004 )
+
+#endif /* HOST_MSP430_H */
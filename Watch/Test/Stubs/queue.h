@@ -0,0 +1,60 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file queue.h
+ *
+ * Host stand-in for the FreeRTOS queue.  A queue is a fifo of fixed size 
+ * items.  Nothing blocks: a receive from an empty queue with a wait time 
+ * other than DONT_WAIT is reported as a test failure (the task would hang).
+ */
+/******************************************************************************/
+
+#ifndef QUEUE_H
+#define QUEUE_H
+
+typedef struct
+{
+  volatile unsigned portBASE_TYPE uxMessagesWaiting;
+  unsigned portBASE_TYPE uxLength;
+  unsigned portBASE_TYPE uxItemSize;
+  unsigned portBASE_TYPE uxReadIndex;
+  unsigned char* pStorage;
+
+} xQUEUE;
+
+typedef xQUEUE * xQueueHandle;
+
+xQueueHandle xQueueCreate(unsigned portBASE_TYPE uxQueueLength,
+                          unsigned portBASE_TYPE uxItemSize);
+
+signed portBASE_TYPE xQueueSend(xQueueHandle xQueue,
+                                const void* pvItemToQueue,
+                                portTickType xTicksToWait);
+
+signed portBASE_TYPE xQueueSendFromISR(xQueueHandle xQueue,
+                                       const void* pvItemToQueue,
+                                       signed portBASE_TYPE* pxTaskWoken);
+
+signed portBASE_TYPE xQueueReceive(xQueueHandle xQueue,
+                                   void* pvBuffer,
+                                   portTickType xTicksToWait);
+
+signed portBASE_TYPE xQueuePeek(xQueueHandle xQueue,
+                                void* pvBuffer,
+                                portTickType xTicksToWait);
+
+#endif /* QUEUE_H */
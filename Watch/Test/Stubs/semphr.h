@@ -0,0 +1,49 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file semphr.h
+ *
+ * Host stand-in for the FreeRTOS semaphores (queues of zero length items).
+ */
+/******************************************************************************/
+
+#ifndef SEMAPHORE_H
+#define SEMAPHORE_H
+
+#include "queue.h"
+
+typedef xQueueHandle xSemaphoreHandle;
+
+#define vSemaphoreCreateBinary(xSemaphore) \
+  { \
+    (xSemaphore) = xQueueCreate(1, 0); \
+    if ( (xSemaphore) != NULL ) \
+    { \
+      xSemaphoreGive(xSemaphore); \
+    } \
+  }
+
+#define xSemaphoreTake(xSemaphore, xBlockTime) \
+  xQueueReceive((xSemaphore), NULL, (xBlockTime))
+
+#define xSemaphoreGive(xSemaphore) \
+  xQueueSend((xSemaphore), NULL, DONT_WAIT)
+
+#define xSemaphoreGiveFromISR(xSemaphore, pxHigherPriorityTaskWoken) \
+  xQueueSendFromISR((xSemaphore), NULL, (pxHigherPriorityTaskWoken))
+
+#endif /* SEMAPHORE_H */
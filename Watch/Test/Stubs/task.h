@@ -0,0 +1,36 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file task.h
+ *
+ * Host stand-in for the FreeRTOS task api.
+ */
+/******************************************************************************/
+
+#ifndef TASK_H
+#define TASK_H
+
+typedef void * xTaskHandle;
+
+/*! The host does not switch tasks so a delay returns at once */
+void vTaskDelay(portTickType xTicksToDelay);
+
+/* MetaWatch additions to task.h (in hal_lpm.c) */
+void TaskDelayLpmDisable(void);
+void TaskDelayLpmEnable(void);
+
+#endif /* TASK_H */
@@ -0,0 +1,300 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestBufferPool.c
+ *
+ * The free list of the buffer pool.  Random allocations and frees never 
+ * hand out a buffer twice or let buffers overlap.  Running out of buffers, 
+ * freeing a buffer twice, freeing a pointer that is not a buffer of the pool
+ * and writing to a buffer after it was freed are each detected (a watchdog
+ * reset on target) and do not change the free list.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+
+#include "hal_board_type.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "Statistics.h"
+#include "HostTest.h"
+
+#define BUFFER_DATA_LENGTH ( HOST_MSG_BUFFER_LENGTH - HOST_MSG_HEADER_LENGTH )
+
+#define RANDOM_OPERATIONS ( 100000 )
+
+static unsigned char* pAllocated[NUM_MSG_BUFFERS];
+static unsigned char Allocated;
+
+static void CheckInUse(unsigned char Expected)
+{
+  tBufferPoolStatistics Stats;
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(NUM_MSG_BUFFERS, Stats.Count);
+  CHECK_EQUAL(Expected, Stats.InUse);
+}
+
+/* \return 1 when the buffer still holds the pattern written when it was 
+ * allocated 
+ */
+static unsigned char HoldsPattern(unsigned char* pBuffer, unsigned char Value)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < BUFFER_DATA_LENGTH; i++ )
+  {
+    if ( pBuffer[i] != Value )
+    {
+      return 0;
+    }
+  }
+  
+  return 1;
+}
+
+/* Each allocated buffer is filled with its own value.  A buffer that was 
+ * handed out twice or that overlaps another one loses its value.
+ */
+static void TestRandomAllocAndFree(void)
+{
+  unsigned int Operation;
+  unsigned char Slot;
+  unsigned char Isr;
+  tBufferPoolStatistics Stats;
+  unsigned int Prints = HostPrints();
+  
+  InitializeBufferPool();
+  Allocated = 0;
+  
+  for ( Operation = 0; Operation < RANDOM_OPERATIONS; Operation++ )
+  {
+    Isr = HostRandom() & 1;
+    
+    if (   Allocated < NUM_MSG_BUFFERS 
+        && (Allocated == 0 || (HostRandom() & 1)) )
+    {
+      unsigned char* pBuffer = Isr ? 
+        BPL_AllocMessageBufferFromIsr() : BPL_AllocMessageBuffer();
+      
+      CHECK(pBuffer != NULL);
+      CHECK(((unsigned long)pBuffer & 1) == 0);
+      
+      for ( Slot = 0; Slot < Allocated; Slot++ )
+      {
+        CHECK(pBuffer != pAllocated[Slot]);
+      }
+      
+      memset(pBuffer, Allocated, BUFFER_DATA_LENGTH);
+      pAllocated[Allocated++] = pBuffer;
+    }
+    else
+    {
+      /* free a random buffer and keep the others in their slots */
+      Slot = HostRandom() % Allocated;
+      CHECK(HoldsPattern(pAllocated[Slot], Slot));
+      
+      if ( Isr )
+      {
+        BPL_FreeMessageBufferFromIsr(pAllocated[Slot]);
+      }
+      else
+      {
+        BPL_FreeMessageBuffer(pAllocated[Slot]);
+      }
+      
+      Allocated--;
+      
+      if ( Slot != Allocated )
+      {
+        pAllocated[Slot] = pAllocated[Allocated];
+        memset(pAllocated[Slot], Slot, BUFFER_DATA_LENGTH);
+      }
+    }
+    
+    CheckInUse(Allocated);
+  }
+  
+  for ( Slot = 0; Slot < Allocated; Slot++ )
+  {
+    CHECK(HoldsPattern(pAllocated[Slot], Slot));
+    BPL_FreeMessageBuffer(pAllocated[Slot]);
+  }
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+  CHECK_EQUAL(NUM_MSG_BUFFERS, Stats.HighWater);
+  CHECK_EQUAL(0, HostWatchdogResets());
+  CHECK_EQUAL(Prints, HostPrints());
+}
+
+/* allocate every buffer of the pool (they are all different) */
+static void AllocateAll(void)
+{
+  unsigned char i;
+  unsigned char j;
+  
+  for ( i = 0; i < NUM_MSG_BUFFERS; i++ )
+  {
+    pAllocated[i] = BPL_AllocMessageBuffer();
+    CHECK(pAllocated[i] != NULL);
+    
+    for ( j = 0; j < i; j++ )
+    {
+      CHECK(pAllocated[i] != pAllocated[j]);
+    }
+  }
+  
+  CheckInUse(NUM_MSG_BUFFERS);
+}
+
+static void FreeAll(void)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < NUM_MSG_BUFFERS; i++ )
+  {
+    BPL_FreeMessageBuffer(pAllocated[i]);
+  }
+  
+  CheckInUse(0);
+}
+
+static void TestExhaustion(void)
+{
+  unsigned int Resets = HostWatchdogResets();
+  
+  InitializeBufferPool();
+  AllocateAll();
+  
+  CHECK(BPL_AllocMessageBuffer() == NULL);
+  CHECK(HostPrinted("Unable to Allocate Buffer\r\n"));
+  CHECK_EQUAL(Resets + 1, HostWatchdogResets());
+  
+  /* an interrupt cannot print; it sets the failure bit */
+  gAppStats.BufferPoolFailure = 0;
+  CHECK(BPL_AllocMessageBufferFromIsr() == NULL);
+  CHECK_EQUAL(1, gAppStats.BufferPoolFailure);
+  CHECK_EQUAL(Resets + 2, HostWatchdogResets());
+  
+  CheckInUse(NUM_MSG_BUFFERS);
+  FreeAll();
+  
+  /* all of the buffers can be allocated again */
+  AllocateAll();
+  FreeAll();
+}
+
+static void TestDoubleFree(void)
+{
+  unsigned int Resets = HostWatchdogResets();
+  unsigned char* pBuffer;
+  
+  InitializeBufferPool();
+  pBuffer = BPL_AllocMessageBuffer();
+  BPL_FreeMessageBuffer(pBuffer);
+  CHECK_EQUAL(Resets, HostWatchdogResets());
+  
+  BPL_FreeMessageBuffer(pBuffer);
+  CHECK(HostPrinted("Buffer freed twice\r\n"));
+  CHECK_EQUAL(Resets + 1, HostWatchdogResets());
+  
+  gAppStats.BufferPoolFailure = 0;
+  BPL_FreeMessageBufferFromIsr(pBuffer);
+  CHECK_EQUAL(1, gAppStats.BufferPoolFailure);
+  CHECK_EQUAL(Resets + 2, HostWatchdogResets());
+  
+  /* the buffer is on the free list once */
+  CheckInUse(0);
+  AllocateAll();
+  CHECK(BPL_AllocMessageBuffer() == NULL);
+  FreeAll();
+}
+
+static void TestForeignPointer(void)
+{
+  unsigned int Resets = HostWatchdogResets();
+  unsigned char Foreign[BUFFER_DATA_LENGTH];
+  unsigned char* pBuffer;
+  unsigned char* pForeign[5];
+  unsigned char i;
+  
+  InitializeBufferPool();
+  pBuffer = BPL_AllocMessageBuffer();
+  
+  /* a pointer on the stack, into a buffer, to the header of a buffer, past 
+   * the last buffer and NULL 
+   */
+  pForeign[0] = Foreign;
+  pForeign[1] = pBuffer + 1;
+  pForeign[2] = pBuffer - HOST_MSG_HEADER_LENGTH;
+  pForeign[3] = pBuffer + NUM_MSG_BUFFERS * HOST_MSG_BUFFER_LENGTH;
+  pForeign[4] = NULL;
+  
+  for ( i = 0; i < sizeof(pForeign) / sizeof(pForeign[0]); i++ )
+  {
+    BPL_FreeMessageBuffer(pForeign[i]);
+    CHECK(HostPrinted("Free Buffer Corruption\r\n"));
+    CHECK_EQUAL(Resets + 1 + i, HostWatchdogResets());
+    CheckInUse(1);
+  }
+  
+  BPL_FreeMessageBuffer(pBuffer);
+  CHECK_EQUAL(Resets + i, HostWatchdogResets());
+  
+  CheckInUse(0);
+  AllocateAll();
+  FreeAll();
+}
+
+/* The link to the next free buffer is in the data of a free buffer.  A 
+ * write after the buffer was freed is found when the link is used.
+ */
+static void TestWriteAfterFree(void)
+{
+  unsigned int Resets = HostWatchdogResets();
+  unsigned char* pBuffer;
+  
+  InitializeBufferPool();
+  pBuffer = BPL_AllocMessageBuffer();
+  BPL_FreeMessageBuffer(pBuffer);
+  memset(pBuffer, 0x5A, BUFFER_DATA_LENGTH);
+  
+  CHECK(BPL_AllocMessageBuffer() == pBuffer);
+  CHECK_EQUAL(Resets, HostWatchdogResets());
+  
+  BPL_AllocMessageBuffer();
+  CHECK(HostPrinted("Free Buffer Corruption\r\n"));
+  CHECK_EQUAL(Resets + 1, HostWatchdogResets());
+  CheckInUse(1);
+}
+
+int main(void)
+{
+  TestRandomAllocAndFree();
+  TestExhaustion();
+  TestDoubleFree();
+  TestForeignPointer();
+  TestWriteAfterFree();
+  
+  return HostTestResult("TestBufferPool");
+}
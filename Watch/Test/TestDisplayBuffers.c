@@ -0,0 +1,361 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestDisplayBuffers.c
+ *
+ * Random interleavings of buffer writes, updates and mode changes against 
+ * the buffer selection in DisplayBuffers.c.  A model keeps the frame that 
+ * each buffer holds.  A write never goes to the buffer being displayed, a
+ * mailbox (three buffer) mode never writes the front buffer while no update
+ * is running and always displays the latest complete frame, an update never
+ * copies over a frame of the phone and the status of the other modes is 
+ * not touched.  Double buffered modes rely on the phone waiting for the 
+ * update between frames so they are not checked for the latest frame.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+
+#include "Messages.h"
+#include "DisplayBuffers.h"
+#include "HostTest.h"
+
+#define ROUNDS ( 200000 )
+
+/* a frame is written with this many WriteBuffer messages */
+#define FRAME_CHUNKS ( 3 )
+#define ALL_CHUNKS   ( (1 << FRAME_CHUNKS) - 1 )
+
+#define NO_UPDATE    ( BUFFER_UNAVAILABLE )
+
+/* what a buffer holds: the chunks of one frame (frame 0 is the blank 
+ * screen) 
+ */
+typedef struct
+{
+  unsigned int Frame;
+  unsigned char Chunks;
+  
+} tContent;
+
+typedef struct
+{
+  unsigned int Frame;      /* frame the phone is writing (0 for none) */
+  unsigned char Chunk;     /* next chunk of the frame */
+  unsigned int Completed;  /* last frame marked written since the update */
+  unsigned char Intact;    /* it was whole in the buffer it was marked in */
+  unsigned char Reading;   /* buffer index of the update or NO_UPDATE */
+  unsigned char Front;     /* buffer that was displayed last */
+  unsigned char Used;      /* a status has been set */
+  
+} tModeModel;
+
+static tContent Content[NUMBER_OF_MODES][MAX_NUMBER_OF_BUFFERS];
+static tModeModel Model[NUMBER_OF_MODES];
+static unsigned char Counts[NUMBER_OF_MODES];
+static unsigned int NextFrame;
+
+static unsigned int Writes;
+static unsigned int Updates;
+static unsigned int Copies;
+
+static void Init(unsigned char const * pCounts)
+{
+  unsigned char Mode;
+  
+  InitDisplayBuffers(pCounts);
+  memcpy(Counts, pCounts, sizeof(Counts));
+  memset(Content, 0, sizeof(Content));
+  memset(Model, 0, sizeof(Model));
+  
+  for ( Mode = 0; Mode < NUMBER_OF_MODES; Mode++ )
+  {
+    Model[Mode].Reading = NO_UPDATE;
+  }
+}
+
+static tContent* GetContent(unsigned char Index)
+{
+  return &Content[Index >> 2][Index & 0x03];
+}
+
+static unsigned char IsMailbox(unsigned char Mode)
+{
+  return Counts[Mode] == MAX_NUMBER_OF_BUFFERS;
+}
+
+/* the index is in the mode and is one of its buffers */
+static void CheckIndex(unsigned char Mode, unsigned char Index)
+{
+  CHECK_EQUAL(Mode, Index >> 2);
+  CHECK((Index & 0x03) < Counts[Mode]);
+}
+
+/* one chunk of the frame the phone is writing */
+static void WriteChunk(unsigned char Mode)
+{
+  tModeModel* pModel = &Model[Mode];
+  
+  if ( pModel->Frame == 0 )
+  {
+    pModel->Frame = ++NextFrame;
+    pModel->Chunk = 0;
+  }
+  
+  unsigned char Index = GetBufferIndex(Mode, BUFFER_TYPE_WRITE);
+  CheckIndex(Mode, Index);
+  
+  CHECK(GetBufferStatus(Index) != BUFFER_READING);
+  CHECK(Index != pModel->Reading);
+  
+  if ( IsMailbox(Mode) && pModel->Reading == NO_UPDATE && pModel->Used )
+  {
+    CHECK((Index & 0x03) != pModel->Front);
+  }
+  
+  tContent* pContent = GetContent(Index);
+  
+  if ( pContent->Frame != pModel->Frame )
+  {
+    pContent->Frame = pModel->Frame;
+    pContent->Chunks = 0;
+  }
+  
+  pContent->Chunks |= 1 << pModel->Chunk;
+  Writes++;
+  
+  /* most phones mark the last write of a frame */
+  if ( ++pModel->Chunk == FRAME_CHUNKS && (HostRandom() & 0x03) )
+  {
+    SetBufferStatus(Index, BUFFER_WRITTEN);
+    pModel->Completed = pModel->Frame;
+    pModel->Intact = pContent->Chunks == ALL_CHUNKS;
+  }
+  else
+  {
+    SetBufferStatus(Index, BUFFER_WRITING);
+  }
+  
+  if ( pModel->Chunk == FRAME_CHUNKS )
+  {
+    pModel->Frame = 0;
+  }
+  
+  pModel->Used = 1;
+}
+
+static void StartUpdate(unsigned char Mode)
+{
+  tModeModel* pModel = &Model[Mode];
+  
+  if ( pModel->Reading != NO_UPDATE )
+  {
+    return;
+  }
+  
+  unsigned char Index = GetBufferIndex(Mode, BUFFER_TYPE_READ);
+  CheckIndex(Mode, Index);
+  
+  if ( IsMailbox(Mode) && pModel->Completed && pModel->Intact )
+  {
+    CHECK_EQUAL(pModel->Completed, GetContent(Index)->Frame);
+    CHECK_EQUAL(ALL_CHUNKS, GetContent(Index)->Chunks);
+  }
+  
+  SetBufferStatus(Index, BUFFER_READING);
+  pModel->Reading = Index;
+  pModel->Completed = 0;
+  pModel->Used = 1;
+  Updates++;
+}
+
+static void FinishUpdate(unsigned char Mode)
+{
+  tModeModel* pModel = &Model[Mode];
+  unsigned char Index = pModel->Reading;
+  
+  if ( Index == NO_UPDATE )
+  {
+    return;
+  }
+  
+  SetBufferStatus(Index, BUFFER_CLEAN);
+  pModel->Reading = NO_UPDATE;
+  pModel->Front = Index & 0x03;
+  
+  unsigned char DrawIndex = GetDrawBufferIndex(Index);
+  
+  if ( DrawIndex == BUFFER_UNAVAILABLE )
+  {
+    return;
+  }
+  
+  CheckIndex(Mode, DrawIndex);
+  CHECK(DrawIndex != Index);
+  CHECK(GetBufferStatus(DrawIndex) != BUFFER_WRITING);
+  CHECK(GetBufferStatus(DrawIndex) != BUFFER_WRITTEN);
+  
+  /* COPY_ACTIVE_TO_DRAW_DURING_UPDATE */
+  if ( HostRandom() & 0x01 )
+  {
+    *GetContent(DrawIndex) = *GetContent(Index);
+    SetBufferStatus(DrawIndex, BUFFER_WRITING);
+    Copies++;
+  }
+}
+
+/* the status of each mode is valid and matches the model */
+static void CheckStatus(void)
+{
+  unsigned char Mode;
+  unsigned char i;
+  
+  for ( Mode = 0; Mode < NUMBER_OF_MODES; Mode++ )
+  {
+    unsigned int Trace = GetBufferStatusTrace(Mode);
+    unsigned char Recent = 0;
+    unsigned char Reading = 0;
+    unsigned char Written = 0;
+    
+    for ( i = 0; i < MAX_NUMBER_OF_BUFFERS; i++ )
+    {
+      unsigned char Nibble = (Trace >> (i << 2)) & 0x0F;
+      unsigned char Status = GetBufferStatus((Mode << 2) + i);
+      
+      if ( i >= Counts[Mode] )
+      {
+        CHECK_EQUAL(0, Nibble);
+        CHECK_EQUAL(BUFFER_CLEAN, Status);
+        continue;
+      }
+      
+      CHECK_EQUAL(Status, Nibble & 0x03);
+      CHECK_EQUAL(0, Nibble & BIT2);
+      
+      Recent += (Nibble & BIT3) != 0;
+      Reading += Status == BUFFER_READING;
+      Written += Status == BUFFER_WRITTEN;
+    }
+    
+    CHECK_EQUAL(Model[Mode].Used, Recent);
+    CHECK_EQUAL(Model[Mode].Reading != NO_UPDATE, Reading);
+    
+    if ( IsMailbox(Mode) )
+    {
+      CHECK(Written <= 1);
+    }
+    
+    if ( Model[Mode].Reading != NO_UPDATE )
+    {
+      CHECK_EQUAL(BUFFER_READING, GetBufferStatus(Model[Mode].Reading));
+    }
+  }
+}
+
+static void Run(unsigned char const * pCounts)
+{
+  unsigned int Round;
+  unsigned char Mode = IDLE_MODE;
+  unsigned int Failures = HostFailures;
+  
+  Init(pCounts);
+  
+  for ( Round = 0; Round < ROUNDS; Round++ )
+  {
+    unsigned int Before[NUMBER_OF_MODES];
+    unsigned char i;
+    
+    /* mode changes */
+    if ( (HostRandom() & 0x07) == 0 )
+    {
+      Mode = HostRandom() % NUMBER_OF_MODES;
+    }
+    
+    for ( i = 0; i < NUMBER_OF_MODES; i++ )
+    {
+      Before[i] = GetBufferStatusTrace(i);
+    }
+    
+    switch ( HostRandom() % 4 )
+    {
+    case 0: 
+    case 1: WriteChunk(Mode);   break;
+    case 2: StartUpdate(Mode);  break;
+    case 3: FinishUpdate(Mode); break;
+    }
+    
+    for ( i = 0; i < NUMBER_OF_MODES; i++ )
+    {
+      if ( i != Mode )
+      {
+        CHECK_EQUAL(Before[i], GetBufferStatusTrace(i));
+      }
+    }
+    
+    CheckStatus();
+    
+    if ( HostFailures != Failures )
+    {
+      printf("failed in round %u (mode %u)\n", Round, Mode);
+      return;
+    }
+  }
+}
+
+/* the recent buffer defaults to the second buffer and the trace has a 
+ * nibble for every buffer
+ */
+static void TestStatus(void)
+{
+  static const unsigned char Mixed[NUMBER_OF_MODES] = { 2, 3, 2, 3 };
+  
+  InitDisplayBuffers(Mixed);
+  
+  CHECK_EQUAL((IDLE_MODE << 2) + 1, GetRecentBufferIndex(IDLE_MODE));
+  CHECK_EQUAL((APPLICATION_MODE << 2) + 1, 
+              GetRecentBufferIndex(APPLICATION_MODE));
+  CHECK_EQUAL(0, GetBufferStatusTrace(APPLICATION_MODE));
+  
+  SetBufferStatus((APPLICATION_MODE << 2) + 2, BUFFER_WRITTEN);
+  CHECK_EQUAL((APPLICATION_MODE << 2) + 2, 
+              GetRecentBufferIndex(APPLICATION_MODE));
+  CHECK_EQUAL(0xB00, GetBufferStatusTrace(APPLICATION_MODE));
+  
+  SetBufferStatus((APPLICATION_MODE << 2) + 0, BUFFER_READING);
+  CHECK_EQUAL(0x309, GetBufferStatusTrace(APPLICATION_MODE));
+  
+  SetBufferStatus(IDLE_MODE << 2, BUFFER_WRITING);
+  CHECK_EQUAL(IDLE_MODE << 2, GetRecentBufferIndex(IDLE_MODE));
+  CHECK_EQUAL(0x0A, GetBufferStatusTrace(IDLE_MODE));
+}
+
+int main(void)
+{
+  static const unsigned char Mixed[NUMBER_OF_MODES] = { 2, 3, 2, 3 };
+  static const unsigned char Swapped[NUMBER_OF_MODES] = { 3, 2, 3, 2 };
+  
+  TestStatus();
+  Run(Mixed);
+  Run(Swapped);
+  
+  printf("writes %u updates %u copies %u\n", Writes, Updates, Copies);
+  
+  return HostTestResult("TestDisplayBuffers");
+}
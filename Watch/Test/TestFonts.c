@@ -0,0 +1,163 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestFonts.c
+ *
+ * Every character code of every LCD font through the font descriptors: the
+ * index, width, height, spacing and each row of the bitmap must come from 
+ * the bitmap tables in Fonts.c and the widths in Tools/FontWidths.c.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+
+#include "Fonts.h"
+#include "FontWidths.h"
+#include "HostTest.h"
+
+extern const unsigned char MetaWatch5table[PRINTABLE_CHARACTERS][5];
+extern const unsigned char MetaWatch7table[PRINTABLE_CHARACTERS][7];
+extern const unsigned int MetaWatch16table[PRINTABLE_CHARACTERS][16];
+extern const unsigned int MetaWatchTimeTable[TOTAL_TIME_CHARACTERS][16];
+extern const unsigned char 
+  MetaWatchSecondsTable[TOTAL_SECONDS_CHARACTERS][7];
+extern const unsigned char StatusIconsTable[TOTAL_STATUS_ICONS][5];
+
+/* \return the row of a character straight from the bitmap tables */
+static unsigned int GetTableRow(etFontType Font, 
+                                unsigned char Index, 
+                                unsigned char Row)
+{
+  switch (Font)
+  {
+  case MetaWatch5:       return MetaWatch5table[Index][Row];
+  case MetaWatch7:       return MetaWatch7table[Index][Row];
+  case MetaWatch16:      return MetaWatch16table[Index][Row];
+  case MetaWatchTime:    return MetaWatchTimeTable[Index][Row];
+  case MetaWatchSeconds: return MetaWatchSecondsTable[Index][Row];
+  default:               return StatusIconsTable[Index][Row];
+  }
+}
+
+static unsigned char GetSourceWidth(etFontType Font, unsigned char Index)
+{
+  switch (Font)
+  {
+  case MetaWatch5:       return MetaWatch5width[Index];
+  case MetaWatch7:       return MetaWatch7width[Index];
+  case MetaWatch16:      return MetaWatch16width[Index];
+  case MetaWatchTime:    return MetaWatchTimeWidth[Index];
+  case MetaWatchSeconds: return SECONDS_CHARACTER_WIDTH;
+  default:               return StatusIconsWidth[Index];
+  }
+}
+
+/*! what the fonts were before the descriptors */
+typedef struct
+{
+  etFontType Font;
+  unsigned char Height;
+  unsigned char Spacing;
+  unsigned char FirstCharacter;
+  unsigned char Characters;
+  
+} tExpectedFont;
+
+static const tExpectedFont ExpectedFonts[] =
+{
+  { MetaWatch5,       5,  1, 0x20, PRINTABLE_CHARACTERS },
+  { MetaWatch7,       7,  1, 0x20, PRINTABLE_CHARACTERS },
+  { MetaWatch16,      16, 1, 0x20, PRINTABLE_CHARACTERS },
+  { MetaWatchTime,    16, 2, 0,    TOTAL_TIME_CHARACTERS },
+  { MetaWatchSeconds, 7,  2, 0,    TOTAL_SECONDS_CHARACTERS },
+  { StatusIcons,      5,  0, 0,    TOTAL_STATUS_ICONS },
+};
+
+#define NUMBER_OF_FONTS ( sizeof(ExpectedFonts) / sizeof(ExpectedFonts[0]) )
+
+static void TestEveryGlyph(void)
+{
+  unsigned int i;
+  unsigned int Character;
+  unsigned int Glyphs = 0;
+  
+  for ( i = 0; i < NUMBER_OF_FONTS; i++ )
+  {
+    const tExpectedFont* pExpected = &ExpectedFonts[i];
+    
+    SetFont(pExpected->Font);
+    
+    CHECK_EQUAL(pExpected->Font, GetFont());
+    CHECK_EQUAL(pExpected->Height, GetCharacterHeight());
+    CHECK_EQUAL(pExpected->Spacing, GetFontSpacing());
+    
+    for ( Character = 0; Character < 256; Character++ )
+    {
+      unsigned int Bitmap[MAX_FONT_ROWS];
+      unsigned char Index = 0;
+      unsigned char Row;
+      unsigned int Failures = HostFailures;
+      
+      /* characters outside of the font are drawn as the first one */
+      if (   Character >= pExpected->FirstCharacter
+          && Character - pExpected->FirstCharacter < pExpected->Characters )
+      {
+        Index = Character - pExpected->FirstCharacter;
+        Glyphs++;
+      }
+      
+      CHECK_EQUAL(Index, MapCharacterToIndex(Character));
+      CHECK_EQUAL(GetSourceWidth(pExpected->Font, Index), 
+                  GetCharacterWidth(Character));
+      
+      GetCharacterBitmap(Character, Bitmap);
+      
+      for ( Row = 0; Row < pExpected->Height; Row++ )
+      {
+        CHECK_EQUAL(GetTableRow(pExpected->Font, Index, Row), Bitmap[Row]);
+      }
+      
+      if ( HostFailures != Failures )
+      {
+        printf("font %u character %u\n", pExpected->Font, Character);
+        return;
+      }
+    }
+  }
+  
+  printf("glyphs checked: %u\n", Glyphs);
+}
+
+/* the spacing can be changed until the font is selected again */
+static void TestSpacing(void)
+{
+  SetFont(MetaWatch7);
+  SetFontSpacing(3);
+  CHECK_EQUAL(3, GetFontSpacing());
+  
+  SetFont(MetaWatch7);
+  CHECK_EQUAL(1, GetFontSpacing());
+}
+
+int main(void)
+{
+  TestEveryGlyph();
+  TestSpacing();
+  
+  return HostTestResult("TestFonts");
+}
@@ -0,0 +1,384 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestLcdBlit.c
+ *
+ * LcdBlit against the byte at a time loops that it replaced and against a 
+ * byte at a time rectangle.  The display buffer and the image are placed at
+ * an even and at an odd address so that the leading byte, word and trailing 
+ * byte paths and the copies between rows of different alignment are all 
+ * taken.  Every starting column and width (including clipped ones) is 
+ * checked.  The whole buffer is compared so a write to the row number, the 
+ * dummy byte or past the end shows.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "hal_lcd.h"
+#include "LcdDisplay.h"
+#include "LcdBlit.h"
+#include "ReferenceLcdBlit.h"
+#include "HostTest.h"
+
+#define BUFFER_BYTES ( NUM_LCD_ROWS * sizeof(tLcdLine) )
+
+/* largest image is every row of the widest (clipped) rectangle */
+#define MAX_COLUMNS  ( NUM_LCD_COL_BYTES + 2 )
+#define IMAGE_BYTES  ( (NUM_LCD_ROWS + 2) * MAX_COLUMNS )
+
+/* words so that an offset of 0 is even; one byte for the offset and a guard
+ * word after the buffer 
+ */
+static unsigned short Actual[BUFFER_BYTES / 2 + 2];
+static unsigned short Expected[BUFFER_BYTES / 2 + 2];
+static unsigned short Image[IMAGE_BYTES / 2 + 1];
+
+typedef enum
+{
+  BlitFill,
+  BlitXor,
+  BlitCopy,
+  BlitOr,
+  NumberOfOperations
+  
+} etBlitOperation;
+
+static const char* const pOperationNames[] = { "fill", "xor", "copy", "or" };
+
+static unsigned int Cases;
+
+static tLcdLine* GetBuffer(unsigned short* pStorage, unsigned char Offset)
+{
+  return (tLcdLine*)((unsigned char*)pStorage + Offset);
+}
+
+static void FillRandom(void)
+{
+  unsigned char* pBytes = (unsigned char*)Expected;
+  unsigned char* pImage = (unsigned char*)Image;
+  unsigned int i;
+  
+  for ( i = 0; i < sizeof(Expected); i++ )
+  {
+    pBytes[i] = HostRandom();
+  }
+  
+  for ( i = 0; i < sizeof(Image); i++ )
+  {
+    pImage[i] = HostRandom();
+  }
+  
+  memcpy(Actual, Expected, sizeof(Actual));
+}
+
+static unsigned char CheckBuffers(void)
+{
+  Cases++;
+  
+  if ( memcmp(Expected, Actual, sizeof(Actual)) != 0 )
+  {
+    HostFailures++;
+    return 0;
+  }
+  
+  return 1;
+}
+
+/* a rectangle a byte at a time; image rows are NumberOfColumns bytes */
+static void ReferenceRectangle(etBlitOperation Operation,
+                               tLcdLine* pBuffer,
+                               unsigned char const* pImage,
+                               unsigned char StartingRow,
+                               unsigned char NumberOfRows,
+                               unsigned char StartingColumn,
+                               unsigned char NumberOfColumns,
+                               unsigned char Value)
+{
+  unsigned int row;
+  unsigned int col;
+  
+  for ( row = 0; row < NumberOfRows; row++ )
+  {
+    for ( col = 0; col < NumberOfColumns; col++ )
+    {
+      if (   StartingRow + row >= NUM_LCD_ROWS 
+          || StartingColumn + col >= NUM_LCD_COL_BYTES )
+      {
+        continue;
+      }
+      
+      unsigned char* pData = 
+        &pBuffer[StartingRow + row].Data[StartingColumn + col];
+      unsigned char Pixels = pImage[row * NumberOfColumns + col];
+      
+      switch ( Operation )
+      {
+      case BlitFill: *pData = Value;   break;
+      case BlitXor:  *pData ^= Value;  break;
+      case BlitCopy: *pData = Pixels;  break;
+      default:       *pData |= Pixels; break;
+      }
+    }
+  }
+}
+
+static void Blit(etBlitOperation Operation,
+                 tLcdLine* pBuffer,
+                 unsigned char const* pImage,
+                 unsigned char StartingRow,
+                 unsigned char NumberOfRows,
+                 unsigned char StartingColumn,
+                 unsigned char NumberOfColumns,
+                 unsigned char Value)
+{
+  switch ( Operation )
+  {
+  case BlitFill:
+    LcdBlitFill(pBuffer, StartingRow, NumberOfRows, 
+                StartingColumn, NumberOfColumns, Value);
+    break;
+  case BlitXor:
+    LcdBlitXor(pBuffer, StartingRow, NumberOfRows, 
+               StartingColumn, NumberOfColumns, Value);
+    break;
+  case BlitCopy:
+    LcdBlitCopy(pBuffer, pImage, StartingRow, NumberOfRows, 
+                StartingColumn, NumberOfColumns);
+    break;
+  default:
+    LcdBlitOr(pBuffer, pImage, StartingRow, NumberOfRows, 
+              StartingColumn, NumberOfColumns);
+    break;
+  }
+}
+
+/* a random row span that is sometimes past the bottom of the display */
+static void RandomRows(unsigned char* pStartingRow, unsigned char* pNumberOfRows)
+{
+  *pStartingRow = HostRandom() % (NUM_LCD_ROWS + 2);
+  *pNumberOfRows = HostRandom() % (NUM_LCD_ROWS + 2);
+}
+
+/* every operation at every column and width for both alignments of the 
+ * buffer and the image 
+ */
+static void TestRectangles(void)
+{
+  unsigned char Operation;
+  unsigned char Offset;
+  unsigned char ImageOffset;
+  unsigned char Column;
+  unsigned char Columns;
+  
+  for ( Operation = 0; Operation < NumberOfOperations; Operation++ )
+  {
+    for ( Offset = 0; Offset < 2; Offset++ )
+    {
+      for ( ImageOffset = 0; ImageOffset < 2; ImageOffset++ )
+      {
+        for ( Column = 0; Column <= NUM_LCD_COL_BYTES; Column++ )
+        {
+          for ( Columns = 0; Columns <= MAX_COLUMNS; Columns++ )
+          {
+            unsigned char const* pImage = 
+              (unsigned char const*)Image + ImageOffset;
+            unsigned char Value = HostRandom();
+            unsigned char Row;
+            unsigned char Rows;
+            
+            RandomRows(&Row, &Rows);
+            FillRandom();
+            
+            ReferenceRectangle(Operation, GetBuffer(Expected, Offset), 
+                               pImage, Row, Rows, Column, Columns, Value);
+            Blit(Operation, GetBuffer(Actual, Offset), 
+                 pImage, Row, Rows, Column, Columns, Value);
+            
+            if ( !CheckBuffers() )
+            {
+              printf("%s offset %u image offset %u rows %u+%u "
+                     "columns %u+%u\n", 
+                     pOperationNames[Operation], Offset, ImageOffset, 
+                     Row, Rows, Column, Columns);
+              return;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
+/* the functions of LcdDisplay.c that now use LcdBlit */
+static void TestReplacedLoops(void)
+{
+  unsigned char Offset;
+  unsigned char ImageOffset;
+  unsigned int Failures = HostFailures;
+  unsigned int i;
+  
+  for ( i = 0; i < 2000; i++ )
+  {
+    Offset = i & 0x01;
+    ImageOffset = (i >> 1) & 0x01;
+    
+    unsigned char const* pImage = (unsigned char const*)Image + ImageOffset;
+    tLcdLine* pExpected = GetBuffer(Expected, Offset);
+    tLcdLine* pActual = GetBuffer(Actual, Offset);
+    unsigned char Value = HostRandom();
+    unsigned char Row;
+    unsigned char Rows;
+    
+    RandomRows(&Row, &Rows);
+    
+    /* FillMyBuffer */
+    FillRandom();
+    ReferenceFillMyBuffer(pExpected, Row, Rows, Value);
+    LcdBlitFill(pActual, Row, Rows, 0, NUM_LCD_COL_BYTES, Value);
+    CHECK(CheckBuffers());
+    
+    /* SendMyBufferToLcd and DrawDateTime */
+    FillRandom();
+    ReferenceInvertRows(pExpected, Row, Rows);
+    LcdBlitXor(pActual, Row, Rows, 0, NUM_LCD_COL_BYTES, 0xFF);
+    CHECK(CheckBuffers());
+    
+    /* CopyRowsIntoMyBuffer */
+    FillRandom();
+    ReferenceCopyRowsIntoMyBuffer(pExpected, pImage, Row, Rows);
+    LcdBlitCopy(pActual, pImage, Row, Rows, 0, NUM_LCD_COL_BYTES);
+    CHECK(CheckBuffers());
+    
+    /* CopyColumnsIntoMyBuffer within the right edge (past it the image is 
+     * now stepped by its full width, TestRectangles checks that) 
+     */
+    unsigned char Column = HostRandom() % (NUM_LCD_COL_BYTES + 1);
+    unsigned char Columns = HostRandom() % (NUM_LCD_COL_BYTES - Column + 1);
+    
+    FillRandom();
+    ReferenceCopyColumnsIntoMyBuffer(pExpected, pImage, 
+                                     Row, Rows, Column, Columns);
+    LcdBlitCopy(pActual, pImage, Row, Rows, Column, Columns);
+    CHECK(CheckBuffers());
+    
+    if ( HostFailures != Failures )
+    {
+      printf("offset %u image offset %u rows %u+%u columns %u+%u\n",
+             Offset, ImageOffset, Row, Rows, Column, Columns);
+      return;
+    }
+  }
+}
+
+/* CopyLcdBytes and InvertLcdBytes for every length and alignment */
+static void TestLines(void)
+{
+  unsigned char Offset;
+  unsigned char SourceOffset;
+  unsigned char Bytes;
+  unsigned char Invert;
+  unsigned int Failures = HostFailures;
+  
+  for ( Offset = 0; Offset < 2; Offset++ )
+  {
+    for ( SourceOffset = 0; SourceOffset < 2; SourceOffset++ )
+    {
+      for ( Bytes = 0; Bytes <= NUM_LCD_COL_BYTES; Bytes++ )
+      {
+        unsigned char const* pSource = 
+          (unsigned char const*)Image + SourceOffset;
+        unsigned char* pExpected = (unsigned char*)Expected + Offset;
+        unsigned char* pActual = (unsigned char*)Actual + Offset;
+        
+        for ( Invert = 0; Invert < 2; Invert++ )
+        {
+          FillRandom();
+          ReferenceCopyLine(pExpected, pSource, Bytes, Invert);
+          CopyLcdBytes(pActual, pSource, Bytes, Invert);
+          CHECK(CheckBuffers());
+        }
+        
+        FillRandom();
+        ReferenceCopyLine(pExpected, pExpected, Bytes, 1);
+        InvertLcdBytes(pActual, Bytes);
+        CHECK(CheckBuffers());
+        
+        if ( HostFailures != Failures )
+        {
+          printf("line offset %u source offset %u bytes %u\n",
+                 Offset, SourceOffset, Bytes);
+          return;
+        }
+      }
+    }
+  }
+}
+
+/* LcdBlitClearPixels against clearing a pixel at a time */
+static void TestClearPixels(void)
+{
+  unsigned char FirstPixel;
+  unsigned char Pixels;
+  
+  for ( FirstPixel = 0; FirstPixel <= NUM_LCD_COL + 2; FirstPixel++ )
+  {
+    for ( Pixels = 0; Pixels <= NUM_LCD_COL + 2; Pixels++ )
+    {
+      unsigned char Offset = HostRandom() & 0x01;
+      tLcdLine* pExpected = GetBuffer(Expected, Offset);
+      unsigned char Row;
+      unsigned char Rows;
+      unsigned int row;
+      unsigned int x;
+      
+      RandomRows(&Row, &Rows);
+      FillRandom();
+      
+      for ( row = Row; row < Row + Rows && row < NUM_LCD_ROWS; row++ )
+      {
+        for ( x = FirstPixel; x < FirstPixel + Pixels && x < NUM_LCD_COL; x++ )
+        {
+          pExpected[row].Data[x >> 3] &= ~(1 << (x & 0x07));
+        }
+      }
+      
+      LcdBlitClearPixels(GetBuffer(Actual, Offset), 
+                         Row, Rows, FirstPixel, Pixels);
+      
+      if ( !CheckBuffers() )
+      {
+        printf("clear offset %u rows %u+%u pixels %u+%u\n",
+               Offset, Row, Rows, FirstPixel, Pixels);
+        return;
+      }
+    }
+  }
+}
+
+int main(void)
+{
+  TestRectangles();
+  TestReplacedLoops();
+  TestLines();
+  TestClearPixels();
+  
+  printf("blits compared: %u\n", Cases);
+  
+  return HostTestResult("TestLcdBlit");
+}
@@ -0,0 +1,195 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestLcdCoalesce.c
+ *
+ * Redraw messages that wait in the display queue are merged only when the 
+ * merged message draws the same thing.  An UpdateDisplay of another mode or
+ * with other copy bits is left alone.  The IdleUpdate of the rtc isr is 
+ * merged into a later full update and can be sent again once it is out of
+ * the queue.
+ */
+/******************************************************************************/
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "Statistics.h"
+#include "LcdCoalesce.h"
+#include "HostTest.h"
+
+static void SetupUpdate(tMessage* pMsg, 
+                        unsigned char Options, 
+                        unsigned char Row)
+{
+  SetupMessageWithInlinePayload(pMsg, UpdateDisplay, Options);
+  pMsg->InlinePayload[0] = Row;
+  pMsg->Length = 1;
+}
+
+/* nothing is merged and neither message changes */
+static void CheckNotMerged(tMessage* pMsg, tMessage* pNextMsg)
+{
+  tMessage Msg = *pMsg;
+  tMessage NextMsg = *pNextMsg;
+  
+  CHECK_EQUAL(0, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(pMsg->Options, Msg.Options);
+  CHECK_EQUAL(pMsg->Length, Msg.Length);
+  CHECK_EQUAL(pNextMsg->Options, NextMsg.Options);
+}
+
+static void TestMergeUpdateDisplay(void)
+{
+  tMessage Msg;
+  tMessage NextMsg;
+  unsigned int Coalesced = gAppStats.CoalescedUpdateDisplays;
+  
+  /* another mode */
+  SetupUpdate(&Msg, IDLE_MODE, 5);
+  SetupUpdate(&NextMsg, APPLICATION_MODE, 5);
+  CheckNotMerged(&Msg, &NextMsg);
+  
+  /* only one of them copies the active buffer to the draw buffer */
+  SetupUpdate(&Msg, IDLE_MODE | COPY_ACTIVE_TO_DRAW_DURING_UPDATE, 5);
+  SetupUpdate(&NextMsg, IDLE_MODE, 5);
+  CheckNotMerged(&Msg, &NextMsg);
+  CheckNotMerged(&NextMsg, &Msg);
+  
+  /* another message type */
+  SetupUpdate(&Msg, IDLE_MODE, 5);
+  SetupMessage(&NextMsg, ChangeModeMsg, IDLE_MODE);
+  CheckNotMerged(&Msg, &NextMsg);
+  
+  CHECK_EQUAL(Coalesced, gAppStats.CoalescedUpdateDisplays);
+  
+  /* the same rows: the options of both are used */
+  SetupUpdate(&Msg, IDLE_MODE, 5);
+  SetupUpdate(&NextMsg, IDLE_MODE | FORCE_UPDATE, 5);
+  CHECK_EQUAL(1, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(IDLE_MODE | FORCE_UPDATE, Msg.Options);
+  CHECK_EQUAL(1, Msg.Length);
+  
+  /* other rows: the whole screen is updated */
+  SetupUpdate(&Msg, 
+              APPLICATION_MODE | COPY_ACTIVE_TO_DRAW_DURING_UPDATE, 5);
+  SetupUpdate(&NextMsg, 
+              APPLICATION_MODE | COPY_ACTIVE_TO_DRAW_DURING_UPDATE, 6);
+  CHECK_EQUAL(1, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(APPLICATION_MODE | COPY_ACTIVE_TO_DRAW_DURING_UPDATE, 
+              Msg.Options);
+  CHECK_EQUAL(0, Msg.Length);
+  CHECK_EQUAL(1, NextMsg.Length);
+  
+  CHECK_EQUAL(Coalesced + 2, gAppStats.CoalescedUpdateDisplays);
+}
+
+static void TestMergeIdleUpdate(void)
+{
+  tMessage Msg;
+  tMessage NextMsg;
+  
+  SetupMessage(&Msg, IdleUpdate, DATE_TIME_ONLY);
+  SetupMessage(&NextMsg, IdleUpdate, RTC_DATE_TIME_ONLY);
+  CHECK_EQUAL(1, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(DATE_TIME_ONLY, Msg.Options);
+  
+  /* a full update includes the date and time */
+  SetupMessage(&NextMsg, IdleUpdate, IDLE_FULL_UPDATE);
+  CHECK_EQUAL(1, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(IDLE_FULL_UPDATE, Msg.Options);
+  
+  SetupMessage(&NextMsg, IdleUpdate, DATE_TIME_ONLY);
+  CHECK_EQUAL(1, MergeDisplayMessage(&Msg, &NextMsg));
+  CHECK_EQUAL(IDLE_FULL_UPDATE, Msg.Options);
+  
+  /* an option that is not a redraw of the idle screen */
+  SetupMessage(&NextMsg, IdleUpdate, RTC_DATE_TIME_ONLY + 1);
+  CheckNotMerged(&Msg, &NextMsg);
+  CheckNotMerged(&NextMsg, &Msg);
+}
+
+/* The rtc isr sends its update while the phone asks for a full update and 
+ * sends a screen.  The display task receives one full idle update and the
+ * upload with its two updates in order.
+ */
+static void TestCoalesceQueue(void)
+{
+  tMessage Msg;
+  tMessage UpdateMsg;
+  tBufferPoolStatistics Stats;
+  
+  InitializeBufferPool();
+  CreateDisplayQueue(8, 4);
+  
+  SetupMessage(&Msg, IdleUpdate, RTC_DATE_TIME_ONLY);
+  SetRtcIdleUpdatePending(SendMessageToQueueFromIsr(DISPLAY_QINDEX, &Msg));
+  CHECK_EQUAL(1, QueryRtcIdleUpdatePending());
+  
+  SetupMessage(&Msg, IdleUpdate, IDLE_FULL_UPDATE);
+  RouteMsg(&Msg);
+  
+  SetupUpdate(&UpdateMsg, APPLICATION_MODE, 1);
+  RouteMsg(&UpdateMsg);
+  SetupMessageAndAllocateBuffer(&Msg, WriteBuffer, APPLICATION_MODE);
+  Msg.Length = sizeof(tSerialRamPayload);
+  RouteMsg(&Msg);
+  RouteMsg(&UpdateMsg);
+  RouteMsg(&UpdateMsg);
+  
+  CHECK_EQUAL(DISPLAY_HIGH_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CoalesceDisplayMessages(&Msg, DISPLAY_HIGH_LANE);
+  CHECK_EQUAL(IdleUpdate, Msg.Type);
+  CHECK_EQUAL(IDLE_FULL_UPDATE, Msg.Options);
+  CHECK_EQUAL(0, QueryRtcIdleUpdatePending());
+  
+  /* the update is not merged across the buffer write */
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CoalesceDisplayMessages(&Msg, DISPLAY_LOW_LANE);
+  CHECK_EQUAL(UpdateDisplay, Msg.Type);
+  
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CoalesceDisplayMessages(&Msg, DISPLAY_LOW_LANE);
+  CHECK_EQUAL(WriteBuffer, Msg.Type);
+  SendToFreeQueue(&Msg);
+  
+  /* the two updates after it are one */
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CoalesceDisplayMessages(&Msg, DISPLAY_LOW_LANE);
+  CHECK_EQUAL(UpdateDisplay, Msg.Type);
+  CHECK_EQUAL(1, Msg.Length);
+  
+  CHECK_EQUAL(DISPLAY_NO_MESSAGE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+}
+
+int main(void)
+{
+  TestMergeUpdateDisplay();
+  TestMergeIdleUpdate();
+  TestCoalesceQueue();
+  
+  CHECK_EQUAL(0, HostWatchdogResets());
+  return HostTestResult("TestLcdCoalesce");
+}
@@ -0,0 +1,297 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestLcdIdle.c
+ *
+ * DrawLcdIdle against DrawDateTime before it redrew only the fields that
+ * changed.  The clock runs for many updates while the settings, connection
+ * and battery change at random and other screens overwrite the buffer or 
+ * the LCD.  After every update the buffer and a copy of the LCD that only 
+ * gets the rows that DrawLcdIdle reported must match a full redraw.  This
+ * checks that the field table covers everything each field draws.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "hal_board_type.h"
+#include "Fonts.h"
+#include "Display.h"
+#include "LcdDisplay.h"
+#include "LcdIdle.h"
+#include "ReferenceLcdIdle.h"
+#include "HostTest.h"
+
+#define UPDATES ( 200000 )
+
+/* the rows of the seconds ones digit */
+#define SECONDS_ONES_ROW  ( 19 )
+#define SECONDS_ROWS      ( 7 )
+
+/* DaysOfTheWeek of Display.c */
+static const tString DayNames[3][7][4] =
+{
+  {"Sun", "Mon", "Tue", "Wed", "Thu", "Fri", "Sat"},
+  {"su", "ma", "ti", "ke", "to", "pe", "la"},
+  {"So", "Mo", "Di", "Mi", "Do", "Fr", "Sa"}
+};
+
+static const unsigned char BatteryIcons[] =
+{
+  STATUS_ICON_BATTERY_EMPTY, 
+  STATUS_ICON_BATTERY_HALF, 
+  STATUS_ICON_BATTERY_FULL
+};
+
+static tLcdLine Buffer[NUM_LCD_ROWS];
+static tLcdLine Expected[NUM_LCD_ROWS];
+
+/* the LCD gets the rows that are reported (it is not inverted here) */
+static tLcdLine Panel[NUM_LCD_ROWS];
+
+/* the rows below the idle area must not change */
+static tLcdLine Below[NUM_LCD_ROWS];
+
+static tLcdIdleState State;
+static tLcdIdleFields Fields;
+
+static unsigned char OneIn(unsigned int Chance)
+{
+  return ( HostRandom() % Chance ) == 0;
+}
+
+static void Scribble(tLcdLine* pBuffer)
+{
+  unsigned char row;
+  unsigned char col;
+  
+  for ( row = 0; row < WATCH_DRAWN_IDLE_BUFFER_ROWS; row++ )
+  {
+    for ( col = 0; col < NUM_LCD_COL_BYTES; col++ )
+    {
+      pBuffer[row].Data[col] = HostRandom();
+    }
+  }
+}
+
+static void SetDayOfWeek(unsigned char DayOfWeek)
+{
+  State.DayOfWeek = DayOfWeek;
+  State.pDayOfWeek = DayNames[State.Language][State.DayOfWeek];
+}
+
+static void SetRandomTime(void)
+{
+  State.Hour = HostRandom() % 24;
+  State.Minutes = HostRandom() % 60;
+  State.Seconds = HostRandom() % 60;
+  State.Year = 1990 + HostRandom() % 120;
+  State.Month = 1 + HostRandom() % 12;
+  State.Day = 1 + HostRandom() % 31;
+  SetDayOfWeek(HostRandom() % 7);
+}
+
+/* move the clock on by a second (or a minute without seconds) */
+static void Tick(void)
+{
+  if ( State.DisplaySeconds && ++State.Seconds < 60 )
+  {
+    return;
+  }
+  
+  State.Seconds = 0;
+  
+  if ( ++State.Minutes < 60 )
+  {
+    return;
+  }
+  
+  State.Minutes = 0;
+  
+  if ( ++State.Hour < 24 )
+  {
+    return;
+  }
+  
+  State.Hour = 0;
+  SetDayOfWeek((State.DayOfWeek + 1) % 7);
+  
+  if ( ++State.Day > 28 )
+  {
+    State.Day = 1;
+    
+    if ( ++State.Month > 12 )
+    {
+      State.Month = 1;
+      State.Year++;
+    }
+  }
+}
+
+static void ChangeSomething(void)
+{
+  switch ( HostRandom() % 13 )
+  {
+  case 0:  State.DisplaySeconds = !State.DisplaySeconds; break;
+  case 1:  State.TimeFormat = !State.TimeFormat; break;
+  case 2:  State.DateFormat = !State.DateFormat; break;
+  case 3:  
+    State.Language = HostRandom() % 3; 
+    SetDayOfWeek(State.DayOfWeek);
+    break;
+  case 4:  State.LinkLost = !State.LinkLost; break;
+  case 5:  State.OnceConnected = !State.OnceConnected; break;
+  case 6:  State.BluetoothOn = !State.BluetoothOn; break;
+  case 7:  State.PhoneConnected = !State.PhoneConnected; break;
+  case 8:  State.Charging = !State.Charging; break;
+  case 9:  State.Battery = BatteryIcons[HostRandom() % 3]; break;
+  case 10: State.Invert = !State.Invert; break;
+  case 11: SetRandomTime(); break;
+  default: SetDayOfWeek(HostRandom() % 7); break;
+  }
+}
+
+static unsigned char CheckRows(tLcdLine const* pActual, const char* pName)
+{
+  unsigned char row;
+  
+  for ( row = 0; row < WATCH_DRAWN_IDLE_BUFFER_ROWS; row++ )
+  {
+    if ( memcmp(Expected[row].Data, pActual[row].Data, NUM_LCD_COL_BYTES) )
+    {
+      HostFailures++;
+      printf("%s row %u is different\n", pName, row);
+      return 0;
+    }
+  }
+  
+  return 1;
+}
+
+static void PrintState(unsigned int Update)
+{
+  printf("update %u: %02u:%02u:%02u %u-%u-%u dow %u lang %u battery %u "
+         "charging %u bt %u connected %u once %u link lost %u seconds %u "
+         "12h %u day first %u invert %u\n",
+         Update, State.Hour, State.Minutes, State.Seconds, 
+         State.Year, State.Month, State.Day, State.DayOfWeek, State.Language,
+         State.Battery, State.Charging, State.BluetoothOn, 
+         State.PhoneConnected, State.OnceConnected, State.LinkLost, 
+         State.DisplaySeconds, State.TimeFormat == TWELVE_HOUR, 
+         State.DateFormat, State.Invert);
+}
+
+int main(void)
+{
+  unsigned long SecondsRows = 0;
+  unsigned long SecondsUpdates = 0;
+  unsigned int Update;
+  unsigned int i;
+  
+  for ( i = 0; i < sizeof(Buffer); i++ )
+  {
+    ((unsigned char*)Buffer)[i] = HostRandom();
+  }
+  
+  memcpy(Below, Buffer, sizeof(Buffer));
+  memcpy(Panel, Buffer, sizeof(Buffer));
+  
+  State.Battery = STATUS_ICON_BATTERY_HALF;
+  State.OnceConnected = 1;
+  State.BluetoothOn = 1;
+  State.PhoneConnected = 1;
+  State.DisplaySeconds = 1;
+  SetRandomTime();
+  
+  for ( Update = 0; Update < UPDATES; Update++ )
+  {
+    /* the first update draws everything */
+    unsigned char ClockOnly = Fields.Drawn;
+    unsigned char FirstRow;
+    
+    Tick();
+    
+    if ( OneIn(50) )
+    {
+      ChangeSomething();
+      ClockOnly = 0;
+    }
+    
+    /* another screen was drawn in the buffer */
+    if ( OneIn(300) )
+    {
+      Scribble(Buffer);
+      Scribble(Panel);
+      Fields.Drawn = 0;
+      ClockOnly = 0;
+    }
+    
+    /* the phone wrote the LCD rows (QueryLcdRowsWritten) */
+    if ( OneIn(300) )
+    {
+      Scribble(Panel);
+      Fields.Drawn = 0;
+      ClockOnly = 0;
+    }
+    
+    unsigned char Rows = DrawLcdIdle(Buffer, &Fields, &State, &FirstRow);
+    
+    CHECK(FirstRow + Rows <= WATCH_DRAWN_IDLE_BUFFER_ROWS);
+    memcpy(&Panel[FirstRow], &Buffer[FirstRow], Rows * sizeof(tLcdLine));
+    
+    ReferenceDrawIdle(Expected, &State);
+    
+    CheckRows(Buffer, "buffer");
+    CheckRows(Panel, "lcd");
+    CHECK(memcmp(&Below[WATCH_DRAWN_IDLE_BUFFER_ROWS], 
+                 &Buffer[WATCH_DRAWN_IDLE_BUFFER_ROWS],
+                 sizeof(Buffer) - 
+                 WATCH_DRAWN_IDLE_BUFFER_ROWS * sizeof(tLcdLine)) == 0);
+    
+    if ( ClockOnly && State.DisplaySeconds && !State.LinkLost )
+    {
+      SecondsRows += Rows;
+      SecondsUpdates++;
+      
+      /* only the ones digit of the seconds changed */
+      if ( State.Seconds % 10 )
+      {
+        CHECK_EQUAL(SECONDS_ONES_ROW, FirstRow);
+        CHECK_EQUAL(SECONDS_ROWS, Rows);
+      }
+    }
+    
+    if ( HostFailures )
+    {
+      PrintState(Update);
+      break;
+    }
+  }
+  
+  if ( SecondsUpdates )
+  {
+    printf("rows sent per update with seconds: %.1f of %u\n", 
+           (double)SecondsRows / SecondsUpdates, 
+           WATCH_DRAWN_IDLE_BUFFER_ROWS);
+  }
+  
+  return HostTestResult("TestLcdIdle");
+}
@@ -0,0 +1,305 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestLcdText.c
+ *
+ * WriteLcdCharacter against the per-pixel drawing that it replaced.  Every
+ * character code of every LCD font is drawn at every bit position of a row 
+ * (and past the right edge) over a random background; the buffer and the 
+ * position after the character must be the same.  A few strings are also 
+ * checked against golden images.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+
+#include "hal_lcd.h"
+#include "Fonts.h"
+#include "LcdDisplay.h"
+#include "LcdText.h"
+#include "ReferenceLcdText.h"
+#include "HostTest.h"
+
+static tLcdLine Buffer[NUM_LCD_ROWS];
+static tLcdLine Expected[NUM_LCD_ROWS];
+
+static const etFontType LcdFonts[] =
+{
+  MetaWatch5, 
+  MetaWatch7, 
+  MetaWatch16, 
+  MetaWatchTime, 
+  MetaWatchSeconds, 
+  StatusIcons
+};
+
+#define NUMBER_OF_LCD_FONTS ( sizeof(LcdFonts) / sizeof(LcdFonts[0]) )
+
+static void CheckPosition(const tLcdTextPosition* pExpected,
+                          const tLcdTextPosition* pActual)
+{
+  CHECK_EQUAL(pExpected->Row, pActual->Row);
+  CHECK_EQUAL(pExpected->Column, pActual->Column);
+  CHECK_EQUAL(pExpected->BitColumnMask, pActual->BitColumnMask);
+}
+
+static void FillRandom(void)
+{
+  unsigned char* pBytes = (unsigned char*)Expected;
+  unsigned int i;
+  
+  for ( i = 0; i < sizeof(Expected); i++ )
+  {
+    /* mostly clear so that missing pixels show */
+    pBytes[i] = HostRandom() & HostRandom() & HostRandom();
+  }
+}
+
+/* draw one character at Column and Shift with both and compare */
+static void CompareCharacter(unsigned char Character,
+                             unsigned char Row,
+                             unsigned char Column,
+                             unsigned char Shift)
+{
+  tLcdTextPosition Position = { Row, Column, 1 << Shift };
+  tLcdTextPosition ExpectedPosition = Position;
+  
+  memcpy(Buffer, Expected, sizeof(Buffer));
+  
+  WriteLcdCharacter(Buffer, &Position, Character);
+  ReferenceWriteCharacter(Expected, &ExpectedPosition, Character);
+  
+  CheckPosition(&ExpectedPosition, &Position);
+  CHECK(memcmp(Expected, Buffer, sizeof(Buffer)) == 0);
+}
+
+static void TestEveryCharacter(void)
+{
+  unsigned char Font;
+  unsigned int Character;
+  unsigned char Column;
+  unsigned char Shift;
+  unsigned int Cases = 0;
+  
+  for ( Font = 0; Font < NUMBER_OF_LCD_FONTS; Font++ )
+  {
+    SetFont(LcdFonts[Font]);
+    
+    unsigned char Rows = GetCharacterHeight();
+    
+    for ( Character = 0; Character < 256; Character++ )
+    {
+      unsigned char Row = HostRandom() % (NUM_LCD_ROWS - Rows + 1);
+      unsigned int Failures = HostFailures;
+      
+      FillRandom();
+      
+      /* one column past the edge */
+      for ( Column = 0; Column <= NUM_LCD_COL_BYTES; Column++ )
+      {
+        for ( Shift = 0; Shift < 8; Shift++ )
+        {
+          CompareCharacter(Character, Row, Column, Shift);
+          Cases++;
+        }
+      }
+      
+      /* below the bottom of the display nothing is drawn or moved (once
+       * for each font) and a message is printed
+       */
+      if ( Character == 1 )
+      {
+        CompareCharacter(Character, NUM_LCD_ROWS - Rows + 1, 3, 5);
+        CHECK(HostPrinted("Not enough rows to display character\r\n"));
+      }
+      
+      if ( HostFailures != Failures )
+      {
+        printf("font %u character %u\n", LcdFonts[Font], Character);
+        return;
+      }
+    }
+  }
+  
+  printf("characters compared: %u\n", Cases);
+}
+
+/* strings (with changed spacing) stop at the right edge */
+static void TestStrings(void)
+{
+  static const char* const pStrings[] =
+  {
+    "MetaWatch", 
+    "Link Lost", 
+    "The quick brown fox jumps over the lazy dog",
+  };
+  unsigned int i;
+  unsigned char Spacing;
+  
+  SetFont(MetaWatch7);
+  
+  for ( Spacing = 0; Spacing < 4; Spacing++ )
+  {
+    SetFontSpacing(Spacing);
+    
+    for ( i = 0; i < sizeof(pStrings) / sizeof(pStrings[0]); i++ )
+    {
+      tLcdTextPosition Position = { 10, i, BIT1 << i };
+      tLcdTextPosition ExpectedPosition = Position;
+      const char* pCharacter = pStrings[i];
+      
+      FillRandom();
+      memcpy(Buffer, Expected, sizeof(Buffer));
+      
+      WriteLcdString(Buffer, &Position, (tString*)pStrings[i]);
+      
+      while (   *pCharacter 
+             && ExpectedPosition.Column < NUM_LCD_COL_BYTES )
+      {
+        ReferenceWriteCharacter(Expected, &ExpectedPosition, *pCharacter++);
+      }
+      
+      CheckPosition(&ExpectedPosition, &Position);
+      CHECK(memcmp(Expected, Buffer, sizeof(Buffer)) == 0);
+    }
+  }
+}
+
+/* Draw a string into a clear buffer at the top left and compare the first
+ * pixels of its rows with an image ('#' is a set pixel)
+ */
+static void CheckImage(etFontType Font,
+                       const char* pString,
+                       unsigned char Column,
+                       unsigned char BitColumnMask,
+                       const char* const* pImage,
+                       unsigned char EndColumn,
+                       unsigned char EndBitColumnMask)
+{
+  tLcdTextPosition Position = { 0, Column, BitColumnMask };
+  unsigned char row;
+  
+  memset(Buffer, 0, sizeof(Buffer));
+  SetFont(Font);
+  WriteLcdString(Buffer, &Position, (tString*)pString);
+  
+  CHECK_EQUAL(EndColumn, Position.Column);
+  CHECK_EQUAL(EndBitColumnMask, Position.BitColumnMask);
+  
+  for ( row = 0; row < GetCharacterHeight(); row++ )
+  {
+    const char* pPixel = pImage[row];
+    unsigned int x;
+    
+    for ( x = Column * 8; *pPixel; x++, pPixel++ )
+    {
+      unsigned char Set = (Buffer[row].Data[x / 8] >> (x & 0x07)) & 0x01;
+      
+      if ( Set != (*pPixel == '#') )
+      {
+        HostFailures++;
+        printf("%s row %u pixel %u is %u\n", pString, row, x, Set);
+      }
+    }
+  }
+}
+
+static void TestGoldenImages(void)
+{
+  static const char* const pHi[] =
+  {
+    "#...#.###.#.............",
+    "#...#..#..#.............",
+    "#...#..#..#.............",
+    "#####..#..#.............",
+    "#...#..#..#.............",
+    "#...#..#................",
+    "#...#.###.#.............",
+  };
+  
+  /* 12:3 drawn from the fifth pixel */
+  static const char* const pTime[] =
+  {
+    ".............#######..################........################..",
+    ".............#######..################........################..",
+    ".............#######..################........################..",
+    "..............######..######....######........######....######..",
+    "..............######............######...##.............######..",
+    "..............######............######...##.............######..",
+    "..............######..################........################..",
+    "..............######..################........################..",
+    "..............######..################........################..",
+    "..............######..################........################..",
+    "..............######..######.............##.............######..",
+    "..............######..######.............##.............######..",
+    "..............######..######....######........######....######..",
+    "..............######..################........################..",
+    "..............######..################........################..",
+    "..............######..################........################..",
+  };
+  
+  static const char* const pSeconds[] =
+  {
+    "##...##..#######....",
+    "##...##.......##....",
+    "##...##.......##....",
+    "#######..#######....",
+    ".....##..##.........",
+    ".....##..##.........",
+    ".....##..#######....",
+  };
+  
+  /* phone, empty battery and full battery */
+  static const char* const pIcons[] =
+  {
+    "#..#######.#######......",
+    "####.....##########.....",
+    "####......#########.....",
+    "####.....##########.....",
+    "##########.#######......",
+  };
+  
+  /* clipped at the right edge; the position stops at the edge and then 
+   * moves by the spacing 
+   */
+  static const char* const pClipped[] =
+  {
+    "....#.#.#.#.",
+    "....#.#.#.#.",
+    ".....#.#...#",
+    ".....#.#..#.",
+    ".....#.#..#.",
+  };
+  
+  CheckImage(MetaWatch7, "Hi!", 0, BIT0, pHi, 1, BIT4);
+  CheckImage(MetaWatchTime, "\x01\x02\x0a\x03", 0, BIT4, pTime, 8, BIT0);
+  CheckImage(MetaWatchSeconds, "\x04\x02", 0, BIT0, pSeconds, 2, BIT2);
+  CheckImage(StatusIcons, "\x01\x02\x04", 0, BIT0, pIcons, 2, BIT3);
+  CheckImage(MetaWatch5, "Wxyz", 10, BIT4, pClipped, 12, BIT1);
+}
+
+int main(void)
+{
+  TestEveryCharacter();
+  TestStrings();
+  TestGoldenImages();
+  
+  return HostTestResult("TestLcdText");
+}
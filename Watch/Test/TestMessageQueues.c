@@ -0,0 +1,895 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestMessageQueues.c
+ *
+ * The two lanes of the display queue.  An urgent message that arrives during
+ * an upload is received before the rest of the upload, and the doorbell does
+ * not lose or invent messages when the display task takes messages out of a
+ * lane on its own (RemoveDisplayMessage).  Messages routed by the stack 
+ * library are smaller than the application's tMessage.  Only the messages 
+ * the host sent return flow control credits, and a host that sends as fast 
+ * as its credits allow does not fill the display queue.  The routing table 
+ * sends and prints every message type the way the switch statements it 
+ * replaced did.  An inline payload sent to the serial port profile task is 
+ * copied into a buffer without changing the sender's message, and is 
+ * dropped cleanly when the pool is empty or the queue is full.  The queue 
+ * telemetry counts each queued and dropped message once and the telemetry
+ * response has the documented layout.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "hal_board_type.h"
+#include "hal_crystal_timers.h"
+
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "DebugUart.h"
+#include "HostTest.h"
+#include "ReferenceMessageQueues.h"
+
+#define DISPLAY_LOW_LENGTH  ( 8 )
+#define DISPLAY_HIGH_LENGTH ( 4 )
+
+/* a buffer allocation failure is a watchdog reset on target */
+static unsigned int ExpectedWatchdogResets;
+
+static xQueueHandle Doorbell;
+static xQueueHandle WrapperQueue;
+
+static void CreateQueues(void)
+{
+  InitializeBufferPool();
+  CreateDisplayQueue(DISPLAY_LOW_LENGTH, DISPLAY_HIGH_LENGTH);
+  Doorbell = HostLastQueue();
+  QueueHandles[BACKGROUND_QINDEX] = xQueueCreate(8, MESSAGE_QUEUE_ITEM_SIZE);
+  WrapperQueue = xQueueCreate(8, MESSAGE_QUEUE_ITEM_SIZE);
+  AssignWrapperQueueHandle(WrapperQueue);
+}
+
+static void SendWriteBuffer(unsigned char Row)
+{
+  tMessage Msg;
+  
+  SetupMessageAndAllocateBuffer(&Msg, WriteBuffer, IDLE_MODE);
+  Msg.pBuffer[0] = Row;
+  Msg.Length = sizeof(tSerialRamPayload);
+  RouteMsg(&Msg);
+}
+
+static void SendButtonFromIsr(void)
+{
+  tMessage Msg;
+  
+  SetupMessage(&Msg, MenuButtonMsg, NO_MSG_OPTIONS);
+  CHECK_EQUAL(1, SendMessageToQueueFromIsr(DISPLAY_QINDEX, &Msg));
+}
+
+/* The phone uploads a screen while a button is pressed.  The button is
+ * received after the message that is being handled, not after the upload.
+ */
+static void TestButtonDuringUpload(void)
+{
+  tMessage Msg;
+  unsigned char Lane;
+  unsigned char Row = 0;
+  unsigned char UploadMessagesBeforeButton = 0;
+  unsigned char ExpectedRow;
+  tBufferPoolStatistics Stats;
+  
+  while ( Row < DISPLAY_LOW_LENGTH )
+  {
+    SendWriteBuffer(Row++);
+  }
+  
+  /* the display task is handling the first row when the button is pressed */
+  Lane = ReceiveDisplayMessage(&Msg, portMAX_DELAY);
+  CHECK_EQUAL(DISPLAY_LOW_LANE, Lane);
+  CHECK_EQUAL(WriteBuffer, Msg.Type);
+  SendToFreeQueue(&Msg);
+  
+  SendButtonFromIsr();
+  
+  /* the phone keeps sending as the lane drains */
+  SendWriteBuffer(Row++);
+  
+  for (;;)
+  {
+    Lane = ReceiveDisplayMessage(&Msg, portMAX_DELAY);
+    SendToFreeQueue(&Msg);
+    
+    if ( Msg.Type == MenuButtonMsg )
+    {
+      CHECK_EQUAL(DISPLAY_HIGH_LANE, Lane);
+      break;
+    }
+    
+    UploadMessagesBeforeButton++;
+  }
+  
+  printf("upload messages received before the button: %u\n",
+         UploadMessagesBeforeButton);
+  CHECK_EQUAL(0, UploadMessagesBeforeButton);
+  
+  /* the rest of the upload is still in order */
+  ExpectedRow = 1 + UploadMessagesBeforeButton;
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    CHECK_EQUAL(WriteBuffer, Msg.Type);
+    CHECK_EQUAL(ExpectedRow, Msg.pBuffer[0]);
+    ExpectedRow++;
+    SendToFreeQueue(&Msg);
+  }
+  
+  CHECK_EQUAL(Row, ExpectedRow);
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+}
+
+/* the display task runs after a message is put into the low lane and before
+ * its doorbell is given, and takes the message as part of a run
+ */
+static void RemoveBeforeDoorbell(void* pQueue)
+{
+  tMessage Msg;
+  
+  if ( pQueue == QueueHandles[DISPLAY_QINDEX] )
+  {
+    CHECK(PeekDisplayMessage(DISPLAY_LOW_LANE, &Msg));
+    RemoveDisplayMessage(DISPLAY_LOW_LANE, &Msg);
+    SendToFreeQueue(&Msg);
+  }
+}
+
+/* The display task takes messages out of the low lane itself while the 
+ * sender still has to give the doorbell.  The doorbell never holds more 
+ * than one give, nothing is received afterwards and messages sent later are
+ * each received once.
+ */
+static void TestDoorbellAfterRemove(void)
+{
+  tMessage Msg;
+  unsigned char i;
+  unsigned char Received = 0;
+  
+  HostSetSendHook(RemoveBeforeDoorbell);
+  
+  for ( i = 0; i < 2 * (DISPLAY_LOW_LENGTH + DISPLAY_HIGH_LENGTH); i++ )
+  {
+    SendWriteBuffer(i);
+    CHECK(Doorbell->uxMessagesWaiting <= 1);
+  }
+  
+  HostSetSendHook(NULL);
+  
+  CHECK_EQUAL(DISPLAY_NO_MESSAGE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CHECK_EQUAL(0, Doorbell->uxMessagesWaiting);
+  
+  for ( i = 0; i < DISPLAY_LOW_LENGTH; i++ )
+  {
+    SendWriteBuffer(i);
+  }
+  
+  SendButtonFromIsr();
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    Received++;
+    SendToFreeQueue(&Msg);
+  }
+  
+  CHECK_EQUAL(DISPLAY_LOW_LENGTH + 1, Received);
+  CHECK_EQUAL(0, Doorbell->uxMessagesWaiting);
+}
+
+/* the message of the stack library ends after pBuffer */
+typedef struct
+{
+  unsigned char Length;
+  unsigned char Type;
+  unsigned char Options;
+  unsigned char * pBuffer;
+
+} tLibraryMessage;
+
+/* Only the fields the stack library has are read from its message (the
+ * address sanitizer reports a read past the end of LibraryMsg).  The time
+ * in the queue is measured from the queued copy.
+ */
+static void TestLibraryMessage(void)
+{
+  tLibraryMessage LibraryMsg;
+  tMessage Msg;
+  unsigned int SendTime = ReadCrystalTimerCount();
+  
+  LibraryMsg.Length = sizeof(tSerialRamPayload);
+  LibraryMsg.Type = WriteBuffer;
+  LibraryMsg.Options = SCROLL_MODE;
+  LibraryMsg.pBuffer = BPL_AllocMessageBuffer();
+  
+  RouteMsg((tMessage*)&LibraryMsg);
+  HostAdvanceCrystalTimer(5);
+  
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CHECK_EQUAL(LibraryMsg.Length, Msg.Length);
+  CHECK_EQUAL(WriteBuffer, Msg.Type);
+  CHECK_EQUAL(SCROLL_MODE, Msg.Options);
+  CHECK(Msg.pBuffer == LibraryMsg.pBuffer);
+  CHECK_EQUAL(SendTime, Msg.Timestamp);
+  SendToFreeQueue(&Msg);
+}
+
+/* the message types that were added after the switch statements */
+typedef struct
+{
+  unsigned char Type;
+  unsigned char Qindex;
+  unsigned char Print;
+  
+} tAddedType;
+
+static const tAddedType AddedTypes[] =
+{
+  { CachedPageMsg,          DISPLAY_QINDEX,    REFERENCE_PRINTED     },
+  { WriteBufferPacked,      DISPLAY_QINDEX,    REFERENCE_NOT_PRINTED },
+  { QueueTelemetryMsg,      BACKGROUND_QINDEX, REFERENCE_PRINTED     },
+  { QueueTelemetryResponse, SPP_TASK_QINDEX,   REFERENCE_PRINTED     },
+  { FlowControlMsg,         BACKGROUND_QINDEX, REFERENCE_PRINTED     },
+  { FlowControlCreditMsg,   SPP_TASK_QINDEX,   REFERENCE_NOT_PRINTED },
+};
+
+/* \return the queue index a message was received from (FREE_QINDEX if it
+ * was not queued) 
+ */
+static unsigned char ReceiveRoutedMessage(unsigned char Type)
+{
+  tMessage Msg;
+  unsigned char Qindex = FREE_QINDEX;
+  unsigned char Received = 0;
+  
+  if ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    Qindex = DISPLAY_QINDEX;
+    Received++;
+    SendToFreeQueue(&Msg);
+  }
+  
+  if ( ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT) )
+  {
+    Qindex = BACKGROUND_QINDEX;
+    Received++;
+    SendToFreeQueue(&Msg);
+  }
+  
+  if ( ReceiveMessage(SPP_TASK_QINDEX, &Msg, DONT_WAIT) )
+  {
+    Qindex = SPP_TASK_QINDEX;
+    Received++;
+    SendToFreeQueue(&Msg);
+  }
+  
+  CHECK(Received <= 1);
+  
+  if ( Received == 1 )
+  {
+    CHECK_EQUAL(Type, Msg.Type);
+  }
+  
+  return Qindex;
+}
+
+/* Every one of the 256 types is routed with a buffer.  A type is received 
+ * from the queue the old switch sent it to and is traced the way the old 
+ * switch printed it.  The only differences are the types added since.
+ */
+static void TestRouteTableComplete(void)
+{
+  unsigned int Type;
+  unsigned char i;
+  tMessage Msg;
+  tBufferPoolStatistics Stats;
+  
+  
+  for ( Type = 0; Type <= MaxMessageType; Type++ )
+  {
+    unsigned char ExpectedQindex = ReferenceRouteQindex(Type);
+    unsigned char ExpectedPrint = ReferencePrintType(Type);
+    unsigned int TraceEvents = HostTraceEvents(NULL, NULL);
+    unsigned char TraceId;
+    unsigned char TraceType;
+    
+    for ( i = 0; i < sizeof(AddedTypes) / sizeof(AddedTypes[0]); i++ )
+    {
+      if ( AddedTypes[i].Type == Type )
+      {
+        ExpectedQindex = AddedTypes[i].Qindex;
+        ExpectedPrint = AddedTypes[i].Print;
+      }
+    }
+    
+    SetupMessageAndAllocateBuffer(&Msg, Type, NO_MSG_OPTIONS);
+    PrintMessageType(&Msg);
+    RouteMsg(&Msg);
+    
+    if ( ExpectedQindex != ReceiveRoutedMessage(Type) )
+    {
+      printf("message type 0x%02x is routed to the wrong queue\n", Type);
+      HostFailures++;
+    }
+    
+    if ( ExpectedPrint == REFERENCE_NOT_PRINTED )
+    {
+      CHECK_EQUAL(TraceEvents, HostTraceEvents(NULL, NULL));
+    }
+    else
+    {
+      CHECK_EQUAL(TraceEvents + 1, HostTraceEvents(&TraceId, &TraceType));
+      CHECK_EQUAL(Type, TraceType);
+      CHECK_EQUAL(ExpectedPrint == REFERENCE_UNKNOWN ? 
+                  TRACE_UNKNOWN_MESSAGE : TRACE_MESSAGE, TraceId);
+    }
+  }
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+}
+
+static void SetupInlineMsg(tMessage* pMsg)
+{
+  unsigned char i;
+  
+  SetupMessageWithInlinePayload(pMsg, ButtonEventMsg, NO_MSG_OPTIONS);
+  
+  for ( i = 0; i < MSG_INLINE_PAYLOAD_LENGTH; i++ )
+  {
+    pMsg->InlinePayload[i] = 0x10 + i;
+  }
+  
+  pMsg->Length = MSG_INLINE_PAYLOAD_LENGTH;
+}
+
+/* \return the number of messages received from the serial port profile 
+ * task queue (each one has its payload in a buffer)
+ */
+static unsigned char ReceiveInlineMsgs(void)
+{
+  tMessage Msg;
+  unsigned char Received = 0;
+  unsigned char i;
+  
+  while ( ReceiveMessage(SPP_TASK_QINDEX, &Msg, DONT_WAIT) )
+  {
+    CHECK(Msg.pBuffer != MSG_INLINE_PAYLOAD);
+    CHECK(Msg.pBuffer != NULL);
+    
+    for ( i = 0; i < MSG_INLINE_PAYLOAD_LENGTH; i++ )
+    {
+      CHECK_EQUAL(0x10 + i, Msg.pBuffer[i]);
+    }
+    
+    SendToFreeQueue(&Msg);
+    Received++;
+  }
+  
+  return Received;
+}
+
+/* The same message is sent twice from a task and twice from an interrupt.
+ * Each queued copy gets its own buffer and the message is not changed.
+ */
+static void TestInlinePayloadToSpp(void)
+{
+  tMessage Msg;
+  tBufferPoolStatistics Stats;
+  
+  SetupInlineMsg(&Msg);
+  
+  RouteMsg(&Msg);
+  RouteMsg(&Msg);
+  CHECK(Msg.pBuffer == MSG_INLINE_PAYLOAD);
+  
+  CHECK_EQUAL(1, SendMessageToQueueFromIsr(SPP_TASK_QINDEX, &Msg));
+  CHECK_EQUAL(1, SendMessageToQueueFromIsr(SPP_TASK_QINDEX, &Msg));
+  CHECK(Msg.pBuffer == MSG_INLINE_PAYLOAD);
+  
+  CHECK_EQUAL(4, ReceiveInlineMsgs());
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+}
+
+/* there is no buffer for the payload: the message is dropped */
+static void TestInlinePayloadPoolEmpty(void)
+{
+  tMessage Msg;
+  unsigned char* pBuffers[NUM_MSG_BUFFERS];
+  unsigned char i;
+  
+  for ( i = 0; i < NUM_MSG_BUFFERS; i++ )
+  {
+    pBuffers[i] = BPL_AllocMessageBuffer();
+  }
+  
+  SetupInlineMsg(&Msg);
+  CHECK_EQUAL(0, SendMessageToQueueFromIsr(SPP_TASK_QINDEX, &Msg));
+  RouteMsg(&Msg);
+  ExpectedWatchdogResets += 2;
+  
+  CHECK_EQUAL(0, ReceiveInlineMsgs());
+  
+  for ( i = 0; i < NUM_MSG_BUFFERS; i++ )
+  {
+    BPL_FreeMessageBuffer(pBuffers[i]);
+  }
+}
+
+/* the buffer that was allocated for the payload is freed */
+static void TestInlinePayloadQueueFull(void)
+{
+  tMessage Msg;
+  tBufferPoolStatistics Stats;
+  unsigned char Sent = 0;
+  
+  SetupInlineMsg(&Msg);
+  
+  while ( SendMessageToQueueFromIsr(SPP_TASK_QINDEX, &Msg) )
+  {
+    Sent++;
+  }
+  
+  CHECK_EQUAL(WrapperQueue->uxLength, Sent);
+  
+  RouteMsg(&Msg);
+  CHECK(HostPrinted("Spp Task Q is full\r\n"));
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(Sent, Stats.InUse);
+  
+  CHECK_EQUAL(Sent, ReceiveInlineMsgs());
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+}
+
+/* \return the credits in the credit message to the host (0 if none was sent)
+ */
+static unsigned char ReceiveCredits(void)
+{
+  tMessage Msg;
+  unsigned char Credits = 0;
+  
+  if ( ReceiveMessage(SPP_TASK_QINDEX, &Msg, DONT_WAIT) )
+  {
+    CHECK_EQUAL(FlowControlCreditMsg, Msg.Type);
+    Credits = Msg.pBuffer[0];
+    SendToFreeQueue(&Msg);
+  }
+  
+  CHECK_EQUAL(0, WrapperQueue->uxMessagesWaiting);
+  return Credits;
+}
+
+/* An update the watch sends to itself while the host uploads a screen does 
+ * not give the host an extra credit, and neither does a message the stack
+ * library frees itself (the flags are padding in its message).
+ */
+static void TestCreditOnlyHostMessages(void)
+{
+  tMessage Msg;
+  tMessage EnableMsg;
+  tLibraryMessage LibraryMsg;
+  
+  SetupMessage(&EnableMsg, FlowControlMsg, FLOW_CONTROL_ENABLE_OPTION);
+  FlowControlHandler(&EnableMsg);
+  
+  /* the display lane is the limit: 8 entries less the reserve of 2 */
+  CHECK_EQUAL(6, ReceiveCredits());
+  
+  SendWriteBuffer(0);
+  
+  SetupMessage(&Msg, UpdateDisplay, IDLE_MODE | FORCE_UPDATE);
+  RouteWatchMsg(&Msg);
+  
+  memset(&LibraryMsg, MSG_CREDIT, sizeof(LibraryMsg));
+  LibraryMsg.Type = WriteBuffer;
+  LibraryMsg.pBuffer = NULL;
+  SendToFreeQueue((tMessage*)&LibraryMsg);
+  
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CHECK_EQUAL(MSG_CREDIT, Msg.Flags);
+  FreeQueuedMessage(&Msg);
+  
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  CHECK_EQUAL(0, Msg.Flags);
+  FreeQueuedMessage(&Msg);
+  
+  /* one credit is less than a batch */
+  SendFlowControlCredits();
+  CHECK_EQUAL(0, ReceiveCredits());
+  
+  SendWriteBuffer(1);
+  
+  CHECK_EQUAL(DISPLAY_LOW_LANE, ReceiveDisplayMessage(&Msg, DONT_WAIT));
+  FreeQueuedMessage(&Msg);
+  SendFlowControlCredits();
+  CHECK_EQUAL(2, ReceiveCredits());
+  
+  SetupMessage(&EnableMsg, FlowControlMsg, FLOW_CONTROL_DISABLE_OPTION);
+  FlowControlHandler(&EnableMsg);
+}
+
+/* ask for telemetry; the caller frees the response */
+static void RequestTelemetry(unsigned char Options,
+                             unsigned char FirstType,
+                             tMessage* pResponse)
+{
+  tMessage Msg;
+  
+  SetupMessageAndAllocateBuffer(&Msg, QueueTelemetryMsg, Options);
+  Msg.pBuffer[0] = FirstType;
+  Msg.Length = 1;
+  QueueTelemetryHandler(&Msg);
+  SendToFreeQueue(&Msg);
+  
+  CHECK_EQUAL(1, ReceiveMessage(SPP_TASK_QINDEX, pResponse, DONT_WAIT));
+  CHECK_EQUAL(QueueTelemetryResponse, pResponse->Type);
+  CHECK_EQUAL(Options, pResponse->Options);
+}
+
+static unsigned int GetTelemetryWord(unsigned char* pData)
+{
+  return pData[0] | (pData[1] << 8);
+}
+
+static void ClearTelemetryCounts(void)
+{
+  tMessage Msg;
+  
+  RequestTelemetry(BACKGROUND_QINDEX | QUEUE_TELEMETRY_CLEAR_OPTION, 0, &Msg);
+  SendToFreeQueue(&Msg);
+}
+
+/* Background messages sent from a task and from an interrupt are counted 
+ * once when they are queued or dropped, and the time they waited is put 
+ * in the right bin.  The response is the documented little endian record.
+ */
+static void TestQueueTelemetry(void)
+{
+  tMessage Msg;
+  unsigned char Sent = 0;
+  unsigned char i;
+  
+  /* the response to the clear request is counted after the clear */
+  ClearTelemetryCounts();
+  
+  SetupMessage(&Msg, LedChange, LED_TOGGLE_OPTION);
+  RouteMsg(&Msg);
+  RouteMsg(&Msg);
+  CHECK_EQUAL(1, SendMessageToQueueFromIsr(BACKGROUND_QINDEX, &Msg));
+  RouteMsg(&Msg);
+  
+  /* latencies of 0, 1, 5 and 1000 ticks: bins 0, 1, 3 and the last */
+  static const unsigned int Advance[] = { 0, 1, 4, 995 };
+  
+  for ( i = 0; i < sizeof(Advance) / sizeof(Advance[0]); i++ )
+  {
+    HostAdvanceCrystalTimer(Advance[i]);
+    CHECK_EQUAL(1, ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT));
+    SendToFreeQueue(&Msg);
+  }
+  
+  /* fill the queue and drop one from a task and one from an interrupt */
+  SetupMessage(&Msg, LedChange, LED_TOGGLE_OPTION);
+  
+  while ( SendMessageToQueueFromIsr(BACKGROUND_QINDEX, &Msg) )
+  {
+    Sent++;
+  }
+  
+  RouteMsg(&Msg);
+  CHECK(HostPrinted("Background Q is full\r\n"));
+  
+  while ( ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT) )
+  {
+    SendToFreeQueue(&Msg);
+  }
+  
+  RequestTelemetry(BACKGROUND_QINDEX, 0, &Msg);
+  CHECK_EQUAL(5 + 2 * QUEUE_LATENCY_BINS, Msg.Length);
+  CHECK_EQUAL(4 + Sent, GetTelemetryWord(&Msg.pBuffer[0]));
+  CHECK_EQUAL(2, GetTelemetryWord(&Msg.pBuffer[2]));
+  CHECK_EQUAL(Sent, Msg.pBuffer[4]);
+  
+  unsigned char* pBins = &Msg.pBuffer[5];
+  
+  /* the messages of the full queue waited 0 ticks */
+  CHECK_EQUAL(1 + Sent, GetTelemetryWord(&pBins[0]));
+  CHECK_EQUAL(1, GetTelemetryWord(&pBins[2]));
+  CHECK_EQUAL(0, GetTelemetryWord(&pBins[4]));
+  CHECK_EQUAL(1, GetTelemetryWord(&pBins[6]));
+  CHECK_EQUAL(1, GetTelemetryWord(&pBins[2 * (QUEUE_LATENCY_BINS - 1)]));
+  SendToFreeQueue(&Msg);
+  
+  /* one record for the led messages and one for the two responses */
+  RequestTelemetry(QUEUE_TELEMETRY_TYPES_OPTION, 0, &Msg);
+  CHECK_EQUAL(1 + 2 * 7, Msg.Length);
+  CHECK_EQUAL(0, Msg.pBuffer[0]);
+  CHECK_EQUAL(LedChange, Msg.pBuffer[1]);
+  CHECK_EQUAL(4 + Sent, GetTelemetryWord(&Msg.pBuffer[2]));
+  CHECK_EQUAL(2, GetTelemetryWord(&Msg.pBuffer[4]));
+  CHECK_EQUAL(1000, GetTelemetryWord(&Msg.pBuffer[6]));
+  CHECK_EQUAL(QueueTelemetryResponse, Msg.pBuffer[8]);
+  CHECK_EQUAL(2, GetTelemetryWord(&Msg.pBuffer[9]));
+  CHECK_EQUAL(0, GetTelemetryWord(&Msg.pBuffer[11]));
+  SendToFreeQueue(&Msg);
+  
+  /* the records start at the type that is asked for */
+  RequestTelemetry(QUEUE_TELEMETRY_TYPES_OPTION, LedChange + 1, &Msg);
+  CHECK_EQUAL(1 + 7, Msg.Length);
+  CHECK_EQUAL(QueueTelemetryResponse, Msg.pBuffer[1]);
+  SendToFreeQueue(&Msg);
+  
+  ClearTelemetryCounts();
+  RequestTelemetry(BACKGROUND_QINDEX, 0, &Msg);
+  
+  for ( i = 0; i < Msg.Length; i++ )
+  {
+    CHECK_EQUAL(0, Msg.pBuffer[i]);
+  }
+  
+  SendToFreeQueue(&Msg);
+}
+
+/* the depth of the display queue is the sum of its lanes */
+static void TestDisplayQueueDepth(void)
+{
+  tMessage Msg;
+  
+  ClearTelemetryCounts();
+  
+  SendWriteBuffer(0);
+  SendWriteBuffer(1);
+  SendButtonFromIsr();
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    SendToFreeQueue(&Msg);
+  }
+  
+  RequestTelemetry(DISPLAY_QINDEX, 0, &Msg);
+  CHECK_EQUAL(3, GetTelemetryWord(&Msg.pBuffer[0]));
+  CHECK_EQUAL(0, GetTelemetryWord(&Msg.pBuffer[2]));
+  CHECK_EQUAL(3, Msg.pBuffer[4]);
+  SendToFreeQueue(&Msg);
+}
+
+/* A response holds as many records as fit in a payload.  The first byte 
+ * is the type to ask for next, and asking for it returns the rest.
+ */
+static void TestTypeTelemetryPages(void)
+{
+  static const unsigned char Types[] =
+  {
+    GetDeviceType, GetInfoString, GetRealTimeClock, 
+    ReadBatteryVoltageMsg, ReadLightSensorMsg, LedChange
+  };
+  
+  unsigned char PerPage = (HOST_MSG_MAX_PAYLOAD_LENGTH - 1) / 7;
+  unsigned char Records = 0;
+  unsigned char FirstType = 0;
+  tMessage Msg;
+  unsigned char i;
+  
+  CHECK(sizeof(Types) > PerPage);
+  
+  ClearTelemetryCounts();
+  
+  for ( i = 0; i < sizeof(Types); i++ )
+  {
+    SetupMessage(&Msg, Types[i], NO_MSG_OPTIONS);
+    RouteMsg(&Msg);
+    CHECK_EQUAL(1, ReceiveMessage(BACKGROUND_QINDEX, &Msg, DONT_WAIT));
+    SendToFreeQueue(&Msg);
+  }
+  
+  do
+  {
+    RequestTelemetry(QUEUE_TELEMETRY_TYPES_OPTION, FirstType, &Msg);
+    CHECK(Msg.Length <= HOST_MSG_MAX_PAYLOAD_LENGTH);
+    CHECK_EQUAL(1, Msg.Length % 7);
+    
+    for ( i = 1; i < Msg.Length; i += 7 )
+    {
+      /* the responses are the last type in the list */
+      if ( Records < sizeof(Types) )
+      {
+        CHECK_EQUAL(Types[Records], Msg.pBuffer[i]);
+        CHECK_EQUAL(1, GetTelemetryWord(&Msg.pBuffer[i + 1]));
+      }
+      else
+      {
+        CHECK_EQUAL(QueueTelemetryResponse, Msg.pBuffer[i]);
+      }
+      
+      Records++;
+    }
+    
+    FirstType = Msg.pBuffer[0];
+    CHECK(FirstType == 0 || Msg.Length == 1 + 7 * PerPage);
+    SendToFreeQueue(&Msg);
+    
+  } while ( FirstType != 0 );
+  
+  CHECK_EQUAL(sizeof(Types) + 1, Records);
+}
+
+#define SIMULATION_STEPS    ( 20000 )
+#define DISPLAY_BATCH       ( 8 )
+
+/* The host sends a bulk message whenever it has a credit (the most it can
+ * send), the watch sends buttons from an interrupt and has at most one 
+ * redraw of its own waiting, and the display task takes out from one to a
+ * batch of messages each time it runs.  No message is dropped, and once 
+ * the display task has caught up the host has all of its credits back.
+ */
+static void TestFlowControlNoDrops(void)
+{
+  tMessage Msg;
+  tBufferPoolStatistics Stats;
+  unsigned int Step;
+  unsigned int Credits;
+  unsigned char Window;
+  unsigned char Count;
+  unsigned char Row = 0;
+  unsigned char WatchUpdateWaiting = 0;
+  unsigned long HostSent = 0;
+  unsigned long HostReceived = 0;
+  unsigned long Capacity = 0;
+  
+  ClearTelemetryCounts();
+  
+  SetupMessage(&Msg, FlowControlMsg, FLOW_CONTROL_ENABLE_OPTION);
+  FlowControlHandler(&Msg);
+  Window = ReceiveCredits();
+  Credits = Window;
+  
+  for ( Step = 0; Step < SIMULATION_STEPS; Step++ )
+  {
+    for ( ; Credits > 0; Credits-- )
+    {
+      if ( HostRandom() % 8 == 0 )
+      {
+        SetupMessage(&Msg, UpdateDisplay, IDLE_MODE);
+        RouteMsg(&Msg);
+      }
+      else
+      {
+        SendWriteBuffer(Row++);
+      }
+      
+      HostSent++;
+    }
+    
+    if ( HostRandom() % 4 == 0 )
+    {
+      SendButtonFromIsr();
+    }
+    
+    if ( !WatchUpdateWaiting && HostRandom() % 4 == 0 )
+    {
+      SetupMessage(&Msg, UpdateDisplay, IDLE_MODE | FORCE_UPDATE);
+      RouteWatchMsg(&Msg);
+      WatchUpdateWaiting = 1;
+    }
+    
+    Count = 1 + HostRandom() % DISPLAY_BATCH;
+    Capacity += Count;
+    
+    for ( ; Count > 0; Count-- )
+    {
+      if ( ReceiveDisplayMessage(&Msg, DONT_WAIT) == DISPLAY_NO_MESSAGE )
+      {
+        break;
+      }
+      
+      if ( Msg.Flags & MSG_CREDIT )
+      {
+        HostReceived++;
+      }
+      else if ( Msg.Type == UpdateDisplay )
+      {
+        WatchUpdateWaiting = 0;
+      }
+      
+      FreeQueuedMessage(&Msg);
+    }
+    
+    SendFlowControlCredits();
+    
+    while ( ReceiveMessage(SPP_TASK_QINDEX, &Msg, DONT_WAIT) )
+    {
+      CHECK_EQUAL(FlowControlCreditMsg, Msg.Type);
+      Credits += Msg.pBuffer[0];
+      SendToFreeQueue(&Msg);
+    }
+    
+    CHECK(Credits <= Window);
+  }
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    HostReceived += Msg.Flags & MSG_CREDIT;
+    FreeQueuedMessage(&Msg);
+  }
+  
+  SendFlowControlCredits();
+  Credits += ReceiveCredits();
+  
+  CHECK_EQUAL(Window, Credits);
+  CHECK_EQUAL(HostSent, HostReceived);
+  
+  printf("flow control: %lu host messages in %u steps, the display task "
+         "could take out %lu\n", HostSent, SIMULATION_STEPS, Capacity);
+  
+  /* the window only holds the host back while the display task is behind */
+  CHECK(HostSent * 10 > Capacity * 8);
+  
+  RequestTelemetry(DISPLAY_QINDEX, 0, &Msg);
+  CHECK_EQUAL(0, GetTelemetryWord(&Msg.pBuffer[2]));
+  SendToFreeQueue(&Msg);
+  
+  RequestTelemetry(SPP_TASK_QINDEX, 0, &Msg);
+  CHECK_EQUAL(0, GetTelemetryWord(&Msg.pBuffer[2]));
+  SendToFreeQueue(&Msg);
+  
+  BPL_GetStatistics(&Stats);
+  CHECK_EQUAL(0, Stats.InUse);
+  
+  SetupMessage(&Msg, FlowControlMsg, FLOW_CONTROL_DISABLE_OPTION);
+  FlowControlHandler(&Msg);
+}
+
+int main(void)
+{
+  CreateQueues();
+  
+  TestButtonDuringUpload();
+  TestDoorbellAfterRemove();
+  TestLibraryMessage();
+  TestRouteTableComplete();
+  TestInlinePayloadToSpp();
+  TestInlinePayloadPoolEmpty();
+  TestInlinePayloadQueueFull();
+  TestCreditOnlyHostMessages();
+  TestQueueTelemetry();
+  TestDisplayQueueDepth();
+  TestTypeTelemetryPages();
+  TestFlowControlNoDrops();
+  
+  CHECK_EQUAL(ExpectedWatchdogResets, HostWatchdogResets());
+  return HostTestResult("TestMessageQueues");
+}
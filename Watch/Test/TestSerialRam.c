@@ -0,0 +1,630 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TestSerialRam.c
+ *
+ * SerialRam.c and LcdDriver.c run against the serial ram, lcd and bus models 
+ * of HostPeripherals.c.  The rows of write buffer messages have to end up 
+ * in the serial ram exactly as if each row was written by itself, with one
+ * transfer for each LCD_BURST_LINES adjacent rows.  The dma interrupt 
+ * switches to the display task when the tick runs.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+#include "queue.h"
+#include "task.h"
+
+#include "hal_board_type.h"
+#include "hal_lcd.h"
+#include "Messages.h"
+#include "BufferPool.h"
+#include "MessageQueues.h"
+#include "LcdDisplay.h"
+#include "LcdDriver.h"
+#include "DisplayBuffers.h"
+#include "SerialRam.h"
+#include "HostTest.h"
+#include "HostPeripherals.h"
+
+#define BYTES_PER_LINE   ( 12 )
+#define BYTES_PER_SCREEN ( NUM_LCD_ROWS * BYTES_PER_LINE )
+
+unsigned int GetBufferAddress(unsigned char Index);
+
+/* LcdDisplay.c */
+unsigned char CurrentMode = IDLE_MODE;
+static unsigned char InvertDisplay = NORMAL_DISPLAY;
+
+unsigned char QueryInvertDisplay(void)
+{
+  return InvertDisplay;
+}
+
+unsigned char GetIdleBufferConfiguration(void)
+{
+  return WATCH_CONTROLS_TOP;
+}
+
+/* what the serial ram should hold */
+static unsigned char ExpectedSram[HOST_SRAM_SIZE];
+
+/* the rows the lcd was sent in order */
+#define MAX_LCD_WRITES ( 2 * NUM_LCD_ROWS )
+
+typedef struct
+{
+  unsigned char Row;
+  unsigned char Data[BYTES_PER_LINE];
+  
+} tLcdWrite;
+
+static tLcdWrite LcdWrites[MAX_LCD_WRITES];
+static unsigned int NumberOfLcdWrites;
+
+static void RecordLcdRow(unsigned char Row, unsigned char const* pData)
+{
+  CHECK(NumberOfLcdWrites < MAX_LCD_WRITES);
+  
+  if ( NumberOfLcdWrites < MAX_LCD_WRITES )
+  {
+    LcdWrites[NumberOfLcdWrites].Row = Row;
+    memcpy(LcdWrites[NumberOfLcdWrites].Data, pData, BYTES_PER_LINE);
+    NumberOfLcdWrites++;
+  }
+}
+
+static void StartTest(void)
+{
+  HostClearBusCounts();
+  memcpy(ExpectedSram, HostSram, sizeof(ExpectedSram));
+}
+
+/* the part of the display task that handles the serial ram messages */
+static void RunDisplayTask(void)
+{
+  tMessage Msg;
+  
+  while ( ReceiveDisplayMessage(&Msg, DONT_WAIT) != DISPLAY_NO_MESSAGE )
+  {
+    switch ( Msg.Type )
+    {
+    case WriteBuffer:   WriteBufferHandler(&Msg);   break;
+    case UpdateDisplay: UpdateDisplayHandler(&Msg); break;
+    case ChangeModeMsg: break;
+    default:            CHECK(!"unexpected display message"); break;
+    }
+    
+    FreeQueuedMessage(&Msg);
+  }
+}
+
+static unsigned char FreeBuffers(void)
+{
+  tBufferPoolStatistics Stats;
+  
+  BPL_GetStatistics(&Stats);
+  return Stats.Count - Stats.InUse;
+}
+
+static void FillLine(unsigned char* pLine, unsigned char Row)
+{
+  unsigned char i;
+  
+  for ( i = 0; i < BYTES_PER_LINE; i++ )
+  {
+    pLine[i] = (unsigned char)(Row * 13 + i + HostRandom());
+  }
+}
+
+/* queue a write buffer message of one row (RowB is ignored) or two rows and
+ * write the rows into the expected serial ram
+ */
+static void SendWriteBuffer(unsigned char Mode, 
+                            unsigned char RowA, 
+                            unsigned char RowB, 
+                            unsigned char OneLine)
+{
+  tMessage Msg;
+  unsigned int Address = 
+    GetBufferAddress(GetBufferIndex(Mode & BUFFER_SELECT_MASK, 
+                                    BUFFER_TYPE_WRITE));
+  
+  if ( OneLine )
+  {
+    Mode |= WRITE_BUFFER_ONE_LINE_MASK;
+  }
+  
+  SetupMessageAndAllocateBuffer(&Msg, WriteBuffer, Mode);
+  
+  tSerialRamPayload* pPayload = (tSerialRamPayload*)GetMessagePayload(&Msg);
+  pPayload->RowSelectA = RowA;
+  pPayload->RowSelectB = RowB;
+  FillLine(pPayload->pLineA, RowA);
+  FillLine(pPayload->pLineB, RowB);
+  Msg.Length = sizeof(tSerialRamPayload);
+  
+  memcpy(&ExpectedSram[Address + RowA * BYTES_PER_LINE], 
+         pPayload->pLineA, BYTES_PER_LINE);
+  
+  if ( !OneLine )
+  {
+    memcpy(&ExpectedSram[Address + RowB * BYTES_PER_LINE], 
+           pPayload->pLineB, BYTES_PER_LINE);
+  }
+  
+  RouteMsg(&Msg);
+}
+
+/* the serial ram is cleared (it is random after power up) */
+static void TestInit(void)
+{
+  unsigned int i;
+  unsigned char Cleared = 1;
+  
+  for ( i = 0; i < HOST_SRAM_SIZE; i++ )
+  {
+    Cleared &= ( HostSram[i] == 0 );
+  }
+  
+  CHECK(Cleared);
+  CHECK(!HostPrinted("Serial RAM initialization failure (a) \r\n"));
+  CHECK(!HostPrinted("Serial RAM initialization failure (b) \r\n"));
+  CHECK(!HostPrinted("Serial RAM map does not fit\r\n"));
+}
+
+/* a screen sent in runs of adjacent rows is written LCD_BURST_LINES rows at
+ * a time 
+ */
+static void TestWriteBufferRun(void)
+{
+  tHostBusCounts Counts;
+  unsigned char Row;
+  
+  StartTest();
+  
+  for ( Row = 0; Row < NUM_LCD_ROWS; Row += 2 )
+  {
+    SendWriteBuffer(APPLICATION_MODE, Row, Row + 1, 0);
+    
+    /* runs of 16 messages (32 rows) */
+    if ( (Row + 2) % 32 == 0 )
+    {
+      RunDisplayTask();
+    }
+  }
+  
+  HostGetBusCounts(HOST_SRAM_BUS, &Counts);
+  CHECK_EQUAL(NUM_LCD_ROWS / LCD_BURST_LINES, Counts.Transactions);
+  CHECK_EQUAL(Counts.Transactions * 3 + NUM_LCD_ROWS * BYTES_PER_LINE, 
+              Counts.Bytes);
+  CHECK(memcmp(ExpectedSram, HostSram, sizeof(ExpectedSram)) == 0);
+  
+  /* rows that are not adjacent are written by themselves */
+  HostClearBusCounts();
+  SendWriteBuffer(APPLICATION_MODE, 40, 20, 0);
+  SendWriteBuffer(APPLICATION_MODE, 21, 0, 1);
+  SendWriteBuffer(APPLICATION_MODE, 21, 22, 0);
+  RunDisplayTask();
+  
+  HostGetBusCounts(HOST_SRAM_BUS, &Counts);
+  CHECK_EQUAL(3, Counts.Transactions);
+  CHECK(memcmp(ExpectedSram, HostSram, sizeof(ExpectedSram)) == 0);
+}
+
+/* random runs of one and two row messages to random rows of every mode */
+static void TestWriteBufferRandom(void)
+{
+  unsigned int Step;
+  
+  StartTest();
+  
+  for ( Step = 0; Step < 5000; Step++ )
+  {
+    unsigned char Mode = HostRandom() % NUMBER_OF_MODES;
+    unsigned char Rows = ( Mode >= SCROLL_MODE ) ? 
+      NUM_LCD_ROWS / 2 : NUM_LCD_ROWS;
+    unsigned char RowA = HostRandom() % Rows;
+    unsigned char RowB = ( HostRandom() % 4 ) ? 
+      RowA + 1 : HostRandom() % Rows;
+    
+    if ( RowB >= Rows )
+    {
+      RowB = 0;
+    }
+    
+    SendWriteBuffer(Mode, RowA, RowB, HostRandom() % 3 == 0);
+    
+    /* runs of adjacent rows */
+    unsigned char Run = HostRandom() % 8;
+    
+    while ( Run-- && RowB + 2 < Rows && FreeBuffers() > 1 )
+    {
+      SendWriteBuffer(Mode, RowB + 1, RowB + 2, 0);
+      RowB += 2;
+    }
+    
+    if ( HostRandom() % 2 || FreeBuffers() < 10 )
+    {
+      RunDisplayTask();
+    }
+  }
+  
+  RunDisplayTask();
+  CHECK(memcmp(ExpectedSram, HostSram, sizeof(ExpectedSram)) == 0);
+  CHECK_EQUAL(NUM_MSG_BUFFERS, FreeBuffers());
+}
+
+/* write a screen (half a screen for scroll buffers) in runs of 16 messages
+ * and mark the buffer written 
+ */
+static void WriteScreen(unsigned char Mode)
+{
+  unsigned char Rows = ( Mode >= SCROLL_MODE ) ? 
+    NUM_LCD_ROWS / 2 : NUM_LCD_ROWS;
+  unsigned char Row;
+  
+  for ( Row = 0; Row < Rows; Row += 2 )
+  {
+    SendWriteBuffer(Row + 2 < Rows ? Mode : Mode | BUFFER_WRITTEN_MASK,
+                    Row, Row + 1, 0);
+    
+    if ( (Row + 2) % 32 == 0 || Row + 2 == Rows )
+    {
+      RunDisplayTask();
+    }
+  }
+}
+
+/* the lcd has to show the rows of the buffer (inverted unless the display
+ * is inverted)
+ */
+static void CheckLcdShows(unsigned int Address, 
+                          unsigned char StartRow, 
+                          unsigned char Rows)
+{
+  unsigned char Flip = ( InvertDisplay == NORMAL_DISPLAY ) ? 0xFF : 0x00;
+  unsigned char Shown = 1;
+  unsigned char Row;
+  unsigned char i;
+  
+  for ( Row = StartRow; Row < StartRow + Rows; Row++ )
+  {
+    for ( i = 0; i < BYTES_PER_LINE; i++ )
+    {
+      Shown &= ( HostLcd[Row][i] == 
+                 (HostSram[Address + Row * BYTES_PER_LINE + i] ^ Flip) );
+    }
+  }
+  
+  CHECK(Shown);
+}
+
+/* the next lines are read from the serial ram while the lcd is sent the 
+ * current ones
+ */
+static void TestUpdateDisplay(void)
+{
+  tMessage Msg;
+  tHostBusCounts Sram;
+  tHostBusCounts Lcd;
+  
+  StartTest();
+  CurrentMode = APPLICATION_MODE;
+  WriteScreen(APPLICATION_MODE);
+  
+  unsigned int Address = 
+    GetBufferAddress(GetBufferIndex(APPLICATION_MODE, BUFFER_TYPE_READ));
+  
+  HostClearBusCounts();
+  SetupMessage(&Msg, UpdateDisplay, APPLICATION_MODE);
+  UpdateDisplayHandler(&Msg);
+  CheckLcdShows(Address, 0, NUM_LCD_ROWS);
+  
+  HostGetBusCounts(HOST_SRAM_BUS, &Sram);
+  HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+  CHECK_EQUAL(NUM_LCD_ROWS, Lcd.Rows);
+  CHECK_EQUAL(1, Lcd.Statics);
+  
+  /* the buses overlap but the lcd bus (1 MHz) is never waited out early */
+  CHECK(HostElapsedCycles() < Sram.SmClkCycles + Lcd.SmClkCycles);
+  CHECK(HostElapsedCycles() >= Lcd.SmClkCycles);
+  
+  printf("update of %d rows: %.0f us, serial ram bus %.0f us, "
+         "lcd bus %.0f us\n", NUM_LCD_ROWS,
+         HostElapsedCycles() * 1e6 / HOST_SMCLK_HZ,
+         Sram.SmClkCycles * 1e6 / HOST_SMCLK_HZ,
+         Lcd.SmClkCycles * 1e6 / HOST_SMCLK_HZ);
+  
+  /* the rows that the lcd shows are not sent again */
+  HostClearBusCounts();
+  UpdateDisplayHandler(&Msg);
+  HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+  CHECK_EQUAL(0, Lcd.Rows);
+  CheckLcdShows(Address, 0, NUM_LCD_ROWS);
+}
+
+/* the display task blocks on the long dma transfers of an update.  While
+ * the tick runs the interrupt switches to the task and when the part is 
+ * asleep (tick off) it only wakes the part.
+ */
+static void TestDmaWake(void)
+{
+  tMessage Msg;
+  
+  StartTest();
+  CurrentMode = APPLICATION_MODE;
+  SetupMessage(&Msg, UpdateDisplay, APPLICATION_MODE);
+  
+  WriteScreen(APPLICATION_MODE);
+  HostClearBusCounts();
+  UpdateDisplayHandler(&Msg);
+  CHECK(HostYields() > 0);
+  CHECK_EQUAL(0, HostLpmExits());
+  
+  HostSetSchedulerState(0);
+  WriteScreen(APPLICATION_MODE);
+  HostClearBusCounts();
+  UpdateDisplayHandler(&Msg);
+  CHECK_EQUAL(0, HostYields());
+  CHECK(HostLpmExits() > 0);
+  HostSetSchedulerState(1);
+  
+  printf("update of %d rows: %u dma waits blocked\n", NUM_LCD_ROWS, 
+         HostLpmExits());
+}
+
+/* send the rows of a buffer one write at a time (WriteLcdHandler) */
+static void WriteLinesToLcd(unsigned int Address, 
+                            unsigned char StartRow, 
+                            unsigned char Rows)
+{
+  tLcdMessagePayload Line;
+  unsigned char Row;
+  
+  for ( Row = StartRow; Row < StartRow + Rows; Row++ )
+  {
+    Line.RowNumber = Row;
+    memcpy(Line.pLine, &HostSram[Address + Row * BYTES_PER_LINE], 
+           BYTES_PER_LINE);
+    WriteLcdHandler(&Line);
+  }
+}
+
+/* the lcd is sent the same rows with the same data by a burst update as by
+ * one write per row, with one chip select for each LCD_BURST_LINES rows
+ */
+static void CheckBurstMatchesLines(unsigned char StartRow, unsigned char Rows)
+{
+  tMessage Msg;
+  tHostBusCounts Lcd;
+  tLcdWrite Bursts[MAX_LCD_WRITES];
+  unsigned int NumberOfBursts;
+  
+  WriteScreen(APPLICATION_MODE);
+  unsigned int Address = 
+    GetBufferAddress(GetBufferIndex(APPLICATION_MODE, BUFFER_TYPE_READ));
+  
+  /* every row is sent after a clear */
+  ClearLcd();
+  HostClearBusCounts();
+  NumberOfLcdWrites = 0;
+  
+  if ( StartRow == 0 && Rows == NUM_LCD_ROWS )
+  {
+    SetupMessage(&Msg, UpdateDisplay, APPLICATION_MODE);
+  }
+  else
+  {
+    SetupMessageWithInlinePayload(&Msg, UpdateDisplay, APPLICATION_MODE);
+    Msg.InlinePayload[0] = StartRow;
+    Msg.InlinePayload[1] = Rows;
+    Msg.Length = 2;
+  }
+  
+  UpdateDisplayHandler(&Msg);
+  
+  HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+  CHECK_EQUAL(Rows, Lcd.Rows);
+  
+  /* the bursts and the static mode command */
+  CHECK_EQUAL((Rows + LCD_BURST_LINES - 1) / LCD_BURST_LINES + 1, 
+              Lcd.Transactions);
+  
+  memcpy(Bursts, LcdWrites, sizeof(Bursts));
+  NumberOfBursts = NumberOfLcdWrites;
+  
+  ClearLcd();
+  HostClearBusCounts();
+  NumberOfLcdWrites = 0;
+  WriteLinesToLcd(Address, StartRow, Rows);
+  
+  HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+  CHECK_EQUAL(Rows, Lcd.Transactions);
+  CHECK_EQUAL(NumberOfBursts, NumberOfLcdWrites);
+  CHECK(memcmp(Bursts, LcdWrites, NumberOfBursts * sizeof(tLcdWrite)) == 0);
+  CheckLcdShows(Address, StartRow, Rows);
+}
+
+static void TestBurstMatchesLines(void)
+{
+  StartTest();
+  CurrentMode = APPLICATION_MODE;
+  HostSetLcdRowHook(RecordLcdRow);
+  
+  CheckBurstMatchesLines(0, NUM_LCD_ROWS);
+  CheckBurstMatchesLines(10, 21);
+  CheckBurstMatchesLines(40, 8);
+  CheckBurstMatchesLines(3, 1);
+  
+  InvertDisplay = INVERT_DISPLAY;
+  CheckBurstMatchesLines(0, NUM_LCD_ROWS);
+  CheckBurstMatchesLines(17, 50);
+  InvertDisplay = NORMAL_DISPLAY;
+  
+  HostSetLcdRowHook(NULL);
+}
+
+/* after an update with COPY_ACTIVE_TO_DRAW_DURING_UPDATE the phone only has
+ * to send the rows that change
+ */
+static void CheckCopyDuringUpdate(unsigned char Mode)
+{
+  static unsigned char Before[HOST_SRAM_SIZE];
+  tMessage Msg;
+  tHostBusCounts Sram;
+  tHostBusCounts Lcd;
+  
+  /* the watch draws the top of the idle screen */
+  unsigned char StartRow = ( Mode == IDLE_MODE ) ? 30 : 0;
+  unsigned int Offset = StartRow * BYTES_PER_LINE;
+  unsigned int Size = ( Mode >= SCROLL_MODE ) ? 
+    BYTES_PER_SCREEN / 2 : BYTES_PER_SCREEN - Offset;
+  
+  CurrentMode = Mode;
+  WriteScreen(Mode);
+  
+  unsigned char Shown = GetBufferIndex(Mode, BUFFER_TYPE_READ);
+  unsigned int ShownAddress = GetBufferAddress(Shown) + Offset;
+  
+  memcpy(Before, HostSram, sizeof(Before));
+  HostClearBusCounts();
+  SetupMessage(&Msg, UpdateDisplay, Mode | COPY_ACTIVE_TO_DRAW_DURING_UPDATE);
+  UpdateDisplayHandler(&Msg);
+  
+  unsigned char Draw = GetBufferIndex(Mode, BUFFER_TYPE_WRITE);
+  unsigned int DrawAddress = GetBufferAddress(Draw) + Offset;
+  
+  CHECK(Draw != Shown);
+  CHECK_EQUAL(BUFFER_WRITING, GetBufferStatus(Draw));
+  CHECK(memcmp(&HostSram[DrawAddress], &HostSram[ShownAddress], Size) == 0);
+  
+  /* nothing else changes */
+  CHECK(memcmp(Before, HostSram, DrawAddress) == 0);
+  CHECK(memcmp(&Before[DrawAddress + Size], 
+               &HostSram[DrawAddress + Size], 
+               HOST_SRAM_SIZE - DrawAddress - Size) == 0);
+  
+  /* the rows read for the lcd, then a read and a write for each 
+   * LCD_BURST_LINES rows that are copied 
+   */
+  unsigned int Chunk = LCD_BURST_LINES * BYTES_PER_LINE;
+  HostGetBusCounts(HOST_SRAM_BUS, &Sram);
+  CHECK_EQUAL((NUM_LCD_ROWS - StartRow + LCD_BURST_LINES - 1) / LCD_BURST_LINES
+              + 2 * ((Size + Chunk - 1) / Chunk),
+              Sram.Transactions);
+  
+  /* one message for two changed rows */
+  StartTest();
+  SendWriteBuffer(Mode | BUFFER_WRITTEN_MASK, StartRow + 4, StartRow + 5, 0);
+  RunDisplayTask();
+  
+  SetupMessage(&Msg, UpdateDisplay, Mode);
+  UpdateDisplayHandler(&Msg);
+  CHECK(memcmp(ExpectedSram, HostSram, sizeof(ExpectedSram)) == 0);
+  CheckLcdShows(DrawAddress - Offset, StartRow, Size / BYTES_PER_LINE);
+  
+  /* an update of a scroll buffer also sends what follows it */
+  HostGetBusCounts(HOST_LCD_BUS, &Lcd);
+  
+  if ( Mode < SCROLL_MODE )
+  {
+    CHECK_EQUAL(2, Lcd.Rows);
+  }
+}
+
+static void TestCopyDuringUpdate(void)
+{
+  StartTest();
+  CheckCopyDuringUpdate(APPLICATION_MODE);
+  CheckCopyDuringUpdate(IDLE_MODE);
+  CheckCopyDuringUpdate(NOTIFICATION_MODE);
+  CheckCopyDuringUpdate(SCROLL_MODE);
+  CheckCopyDuringUpdate(APPLICATION_MODE);
+}
+
+static void SendCachedPage(unsigned char Mode, 
+                           unsigned char Operation, 
+                           unsigned char Page)
+{
+  tMessage Msg;
+  
+  SetupMessageWithInlinePayload(&Msg, CachedPageMsg, Mode | Operation);
+  Msg.InlinePayload[CACHED_PAGE_INDEX] = Page;
+  Msg.Length = 1;
+  CachedPageHandler(&Msg);
+}
+
+/* a page saved in the serial ram comes back into the draw buffer */
+static void TestCachedPages(void)
+{
+  static unsigned char Saved[BYTES_PER_SCREEN];
+  
+  StartTest();
+  CurrentMode = NOTIFICATION_MODE;
+  WriteScreen(NOTIFICATION_MODE);
+  
+  unsigned int Address = 
+    GetBufferAddress(GetRecentBufferIndex(NOTIFICATION_MODE));
+  memcpy(Saved, &HostSram[Address], BYTES_PER_SCREEN);
+  SendCachedPage(NOTIFICATION_MODE, CACHED_PAGE_SAVE, 1);
+  
+  /* another screen and then the page is loaded over it */
+  WriteScreen(NOTIFICATION_MODE);
+  SendCachedPage(NOTIFICATION_MODE, CACHED_PAGE_LOAD, 1);
+  
+  unsigned char Index = GetRecentBufferIndex(NOTIFICATION_MODE);
+  Address = GetBufferAddress(Index);
+  CHECK_EQUAL(BUFFER_WRITTEN, GetBufferStatus(Index));
+  CHECK(memcmp(Saved, &HostSram[Address], BYTES_PER_SCREEN) == 0);
+  
+  /* show is a load and then an update */
+  WriteScreen(NOTIFICATION_MODE);
+  SendCachedPage(NOTIFICATION_MODE, CACHED_PAGE_SHOW, 1);
+  RunDisplayTask();
+  
+  Address = GetBufferAddress(GetRecentBufferIndex(NOTIFICATION_MODE));
+  CHECK(memcmp(Saved, &HostSram[Address], BYTES_PER_SCREEN) == 0);
+  CheckLcdShows(Address, 0, NUM_LCD_ROWS);
+  
+  SendCachedPage(NOTIFICATION_MODE, CACHED_PAGE_LOAD, 0xFF);
+  CHECK(HostPrinted("Invalid Cached Page: "));
+  SendCachedPage(SCROLL_MODE, CACHED_PAGE_SAVE, 0);
+  CHECK(HostPrinted("Invalid Cached Page: "));
+}
+
+int main(void)
+{
+  InitializeBufferPool();
+  CreateDisplayQueue(NUM_MSG_BUFFERS, 4);
+  HostInitPeripherals(5);
+  SerialRamInit();
+  LcdPeripheralInit();
+  
+  TestInit();
+  TestWriteBufferRun();
+  TestWriteBufferRandom();
+  TestUpdateDisplay();
+  TestDmaWake();
+  TestBurstMatchesLines();
+  TestCopyDuringUpdate();
+  TestCachedPages();
+  
+  return HostTestResult("TestSerialRam");
+}
@@ -0,0 +1,358 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestTemplates.c
+ *
+ * The template decoder that LoadTemplate and WriteBufferPacked use.  The 
+ * flash templates decode to a full screen, decoding in chunks gives the 
+ * same bytes as decoding at once, random data never makes the decoder read 
+ * past its end (address sanitizer) and the host encoder round trips.  PBM 
+ * images of a frame give the frame template.
+ */
+/******************************************************************************/
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "FreeRTOS.h"
+
+#include "Messages.h"
+#include "Templates.h"
+#include "TemplateEncoder.h"
+#include "PbmReader.h"
+#include "HostTest.h"
+
+#define BYTES_PER_SCREEN ( 96 * TEMPLATE_BYTES_PER_LINE )
+
+/* the chunk size of DecodeToSram */
+#define SRAM_CHUNK ( 8 * TEMPLATE_BYTES_PER_LINE )
+
+/* the commands of a WriteBufferPacked message follow the start row and count */
+#define PACKED_DATA_LENGTH ( HOST_MSG_MAX_PAYLOAD_LENGTH - 2 )
+
+/* A second decoder written from the description in Templates.h.
+ *
+ * \return the number of bytes written before the data ran out or was bad 
+ */
+static unsigned int ReferenceDecode(const unsigned char* pData,
+                                    unsigned int Length,
+                                    unsigned char* pOut,
+                                    unsigned int Size)
+{
+  unsigned int In = 0;
+  unsigned int Out = 0;
+  
+  while ( Out < Size && In < Length )
+  {
+    unsigned char Command = pData[In++];
+    unsigned int Count = (Command & TEMPLATE_LENGTH_MASK) + 1;
+    unsigned int i;
+    
+    switch ( Command & TEMPLATE_COMMAND_MASK )
+    {
+    case TEMPLATE_LITERAL:
+      if ( Length - In < Count )
+      {
+        return Out;
+      }
+      for ( i = 0; i < Count && Out < Size; i++ )
+      {
+        pOut[Out++] = pData[In + i];
+      }
+      In += Count;
+      break;
+      
+    case TEMPLATE_RUN:
+      if ( In == Length )
+      {
+        return Out;
+      }
+      for ( i = 0; i < Count && Out < Size; i++ )
+      {
+        pOut[Out++] = pData[In];
+      }
+      In++;
+      break;
+      
+    case TEMPLATE_REPEAT_LINE:
+      /* each byte is the byte one line back (the first line is blank) */
+      for ( i = 0; i < Count * TEMPLATE_BYTES_PER_LINE && Out < Size; i++ )
+      {
+        pOut[Out] = ( Out < TEMPLATE_BYTES_PER_LINE ) ? 
+          0 : pOut[Out - TEMPLATE_BYTES_PER_LINE];
+        Out++;
+      }
+      break;
+      
+    default:
+      return Out;
+    }
+  }
+  
+  return Out;
+}
+
+/* decode in random chunks and \return the number of bytes that were 
+ * decoded (Size when all of them were)
+ */
+static unsigned int ChunkDecode(const unsigned char* pData,
+                                unsigned int Length,
+                                unsigned char* pOut,
+                                unsigned int Size,
+                                unsigned char Xor)
+{
+  tTemplateDecoder Decoder;
+  unsigned int Out = 0;
+  
+  InitTemplateDecoder(&Decoder, pData, pData + Length);
+  
+  while ( Out < Size )
+  {
+    unsigned int Chunk = 1 + HostRandom() % SRAM_CHUNK;
+    
+    if ( Chunk > Size - Out )
+    {
+      Chunk = Size - Out;
+    }
+    
+    if ( !DecodeTemplate(&Decoder, &pOut[Out], Chunk, Xor) )
+    {
+      return Out;
+    }
+    
+    Out += Chunk;
+  }
+  
+  return Out;
+}
+
+static void TestFlashTemplates(void)
+{
+  unsigned char Screen[BYTES_PER_SCREEN];
+  unsigned char Expected[BYTES_PER_SCREEN];
+  unsigned char Select;
+  
+  for ( Select = FIRST_FLASH_TEMPLATE; ; Select++ )
+  {
+    unsigned int Size = 0;
+    const unsigned char* pTemplate = GetTemplatePointer(Select, &Size);
+    
+    if ( pTemplate == NULL )
+    {
+      break;
+    }
+    
+    CHECK_EQUAL(BYTES_PER_SCREEN, 
+                ChunkDecode(pTemplate, Size, Screen, BYTES_PER_SCREEN, 0));
+    CHECK_EQUAL(BYTES_PER_SCREEN,
+                ReferenceDecode(pTemplate, Size, Expected, BYTES_PER_SCREEN));
+    CHECK(memcmp(Screen, Expected, BYTES_PER_SCREEN) == 0);
+    
+    /* a frame: full top and bottom lines, a pixel at each side */
+    CHECK_EQUAL(0xFF, Screen[0]);
+    CHECK_EQUAL(0x01, Screen[TEMPLATE_BYTES_PER_LINE]);
+    CHECK_EQUAL(0x80, Screen[2 * TEMPLATE_BYTES_PER_LINE - 1]);
+    CHECK_EQUAL(0xFF, Screen[BYTES_PER_SCREEN - 1]);
+  }
+  
+  CHECK_EQUAL(FIRST_FLASH_TEMPLATE + 2, Select);
+}
+
+/* Random bytes in a buffer of exactly their length.  The decoder stops 
+ * where the reference decoder stops and reads nothing past the end.
+ */
+static void TestFuzz(void)
+{
+  static unsigned char Out[BYTES_PER_SCREEN];
+  static unsigned char Expected[BYTES_PER_SCREEN];
+  unsigned int Round;
+  unsigned int Good = 0;
+  
+  for ( Round = 0; Round < 100000; Round++ )
+  {
+    unsigned int Length = HostRandom() % (PACKED_DATA_LENGTH + 1);
+    unsigned int Size = 
+      TEMPLATE_BYTES_PER_LINE * (1 + HostRandom() % 96);
+    unsigned char* pData = malloc(Length ? Length : 1);
+    unsigned int i;
+    
+    for ( i = 0; i < Length; i++ )
+    {
+      /* mostly valid commands so that some of them decode */
+      pData[i] = HostRandom();
+      if ( (HostRandom() & 0x03) == 0 )
+      {
+        pData[i] &= ~BIT6;
+      }
+    }
+    
+    unsigned int Decoded = ChunkDecode(pData, Length, Out, Size, 0);
+    unsigned int Reference = ReferenceDecode(pData, Length, Expected, Size);
+    
+    /* the chunk that has the bad data is not counted */
+    CHECK(Decoded <= Reference);
+    CHECK(Decoded == Size || Reference < Size);
+    CHECK(memcmp(Out, Expected, Decoded) == 0);
+    
+    if ( Decoded == Size )
+    {
+      Good++;
+    }
+    
+    free(pData);
+  }
+  
+  printf("random messages that decoded: %u of %u\n", Good, Round);
+}
+
+/* random images with long runs and repeated lines */
+static void RandomRows(unsigned char* pRows, unsigned int Size)
+{
+  unsigned int i;
+  
+  for ( i = 0; i < Size; i++ )
+  {
+    switch ( HostRandom() % 4 )
+    {
+    case 0:
+      pRows[i] = HostRandom();
+      break;
+    case 1:
+      pRows[i] = i ? pRows[i - 1] : 0;
+      break;
+    default:
+      pRows[i] = ( i >= TEMPLATE_BYTES_PER_LINE ) ? 
+        pRows[i - TEMPLATE_BYTES_PER_LINE] : 0;
+      break;
+    }
+  }
+}
+
+static void TestRoundTrip(void)
+{
+  static unsigned char Rows[BYTES_PER_SCREEN];
+  static unsigned char Old[BYTES_PER_SCREEN];
+  static unsigned char Out[BYTES_PER_SCREEN];
+  static unsigned char Packed[2 * BYTES_PER_SCREEN];
+  unsigned int Round;
+  
+  for ( Round = 0; Round < 2000; Round++ )
+  {
+    unsigned int Size = TEMPLATE_BYTES_PER_LINE * (1 + HostRandom() % 96);
+    unsigned int i;
+    
+    RandomRows(Rows, Size);
+    
+    unsigned int Length = EncodeTemplate(Rows, Size, Packed, sizeof(Packed));
+    CHECK(Length > 0);
+    CHECK_EQUAL(Size, ChunkDecode(Packed, Length, Out, Size, 0));
+    CHECK(memcmp(Out, Rows, Size) == 0);
+    
+    /* xor: the message holds the changes from what the buffer has */
+    RandomRows(Old, Size);
+    for ( i = 0; i < Size; i++ )
+    {
+      Rows[i] ^= Old[i];
+    }
+    
+    Length = EncodeTemplate(Rows, Size, Packed, sizeof(Packed));
+    memcpy(Out, Old, Size);
+    CHECK_EQUAL(Size, ChunkDecode(Packed, Length, Out, Size, 1));
+    
+    for ( i = 0; i < Size; i++ )
+    {
+      CHECK_EQUAL(Rows[i] ^ Old[i], Out[i]);
+    }
+  }
+}
+
+/* the frame template drawn as a PBM image */
+static unsigned int WriteFramePbm(char Format, unsigned char* pFile)
+{
+  unsigned int Length = sprintf((char*)pFile, "P%c\n# frame\n96 96\n", Format);
+  unsigned int x;
+  unsigned int y;
+  
+  for ( y = 0; y < 96; y++ )
+  {
+    for ( x = 0; x < 96; x++ )
+    {
+      unsigned char Black = ( y == 0 || y == 95 || x == 0 || x == 95 );
+      
+      if ( Format == '1' )
+      {
+        pFile[Length++] = Black ? '1' : '0';
+        pFile[Length++] = ( x == 95 ) ? '\n' : ' ';
+      }
+      else
+      {
+        if ( (x & 0x07) == 0 )
+        {
+          pFile[Length++] = 0;
+        }
+        pFile[Length - 1] |= Black << (7 - (x & 0x07));
+      }
+    }
+  }
+  
+  return Length;
+}
+
+static void TestPbm(void)
+{
+  static unsigned char File[3 * BYTES_PER_SCREEN * 8];
+  static unsigned char Rows[BYTES_PER_SCREEN];
+  static unsigned char Packed[2 * BYTES_PER_SCREEN];
+  unsigned int Size = 0;
+  const unsigned char* pFrame = GetTemplatePointer(FIRST_FLASH_TEMPLATE, &Size);
+  const char* Formats = "14";
+  unsigned int i;
+  
+  for ( i = 0; Formats[i]; i++ )
+  {
+    unsigned int Length = WriteFramePbm(Formats[i], File);
+    
+    CHECK_EQUAL(BYTES_PER_SCREEN, ReadPbm(File, Length, Rows, sizeof(Rows)));
+    CHECK_EQUAL(Size, EncodeTemplate(Rows, BYTES_PER_SCREEN, 
+                                     Packed, sizeof(Packed)));
+    CHECK(memcmp(Packed, pFrame, Size) == 0);
+    
+    /* short files, too little room and other widths */
+    CHECK_EQUAL(0, ReadPbm(File, Length - 2, Rows, sizeof(Rows)));
+    CHECK_EQUAL(0, ReadPbm(File, Length, Rows, sizeof(Rows) - 1));
+    File[sizeof("P1\n# frame\n9") - 2] = '5';
+    CHECK_EQUAL(0, ReadPbm(File, Length, Rows, sizeof(Rows)));
+  }
+  
+  /* fewer lines than a screen */
+  memcpy(File, "P1 96 1 1", 9);
+  memset(&File[9], '0', 95);
+  CHECK_EQUAL(TEMPLATE_BYTES_PER_LINE, ReadPbm(File, 104, Rows, sizeof(Rows)));
+  CHECK_EQUAL(0x01, Rows[0]);
+  CHECK_EQUAL(0x00, Rows[TEMPLATE_BYTES_PER_LINE - 1]);
+}
+
+int main(void)
+{
+  TestFlashTemplates();
+  TestFuzz();
+  TestRoundTrip();
+  TestPbm();
+  
+  return HostTestResult("TestTemplates");
+}
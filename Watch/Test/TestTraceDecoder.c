@@ -0,0 +1,282 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file TestTraceDecoder.c
+ *
+ * The trace frames of the debug uart (DebugUart.h) and the host decoder in 
+ * Watch/Tools.  The frames are built here the way WriteTraceFrame builds 
+ * them.  Arguments that contain the start byte do not confuse the decoder 
+ * and it finds the next whole frame after bytes were lost.
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "FreeRTOS.h"
+
+#include "DebugUart.h"
+#include "Crc16.h"
+#include "TraceDecoder.h"
+#include "HostTest.h"
+
+#define MAX_RECORDS  ( 256 )
+#define MAX_TEXT     ( 4096 )
+#define MAX_STREAM   ( MAX_RECORDS * (TRACE_FRAME_SIZE + 8) )
+
+typedef struct
+{
+  tTraceDecoderRecord Records[MAX_RECORDS];
+  unsigned int RecordCount;
+  unsigned char Text[MAX_TEXT];
+  unsigned int TextCount;
+  
+} tOutput;
+
+static unsigned char Stream[MAX_STREAM];
+static unsigned int StreamLength;
+
+static void SaveText(void* pContext, unsigned char Byte)
+{
+  tOutput* pOutput = pContext;
+  
+  if ( pOutput->TextCount < MAX_TEXT )
+  {
+    pOutput->Text[pOutput->TextCount++] = Byte;
+  }
+}
+
+static void SaveRecord(void* pContext, const tTraceDecoderRecord* pRecord)
+{
+  tOutput* pOutput = pContext;
+  
+  if ( pOutput->RecordCount < MAX_RECORDS )
+  {
+    pOutput->Records[pOutput->RecordCount++] = *pRecord;
+  }
+}
+
+static void PutFrame(const tTraceDecoderRecord* pRecord)
+{
+  unsigned char* pFrame = &Stream[StreamLength];
+  
+  pFrame[0] = TRACE_RECORD_START;
+  pFrame[1] = pRecord->Id;
+  pFrame[2] = pRecord->Arg1;
+  pFrame[3] = (unsigned char)pRecord->Timestamp;
+  pFrame[4] = (unsigned char)(pRecord->Timestamp >> 8);
+  pFrame[5] = (unsigned char)pRecord->Arg2;
+  pFrame[6] = (unsigned char)(pRecord->Arg2 >> 8);
+  
+  unsigned int Crc = Crc16(CRC16_INIT, pFrame, TRACE_FRAME_SIZE - 2);
+  pFrame[7] = (unsigned char)Crc;
+  pFrame[8] = (unsigned char)(Crc >> 8);
+  
+  StreamLength += TRACE_FRAME_SIZE;
+}
+
+static void PutText(const char* pText)
+{
+  unsigned int Length = strlen(pText);
+  
+  memcpy(&Stream[StreamLength], pText, Length);
+  StreamLength += Length;
+}
+
+static void Decode(tOutput* pOutput, unsigned long* pDiscarded)
+{
+  tTraceDecoder Decoder;
+  unsigned int i;
+  
+  memset(pOutput, 0, sizeof(tOutput));
+  TraceDecoderInit(&Decoder, SaveText, SaveRecord, pOutput);
+  
+  for ( i = 0; i < StreamLength; i++ )
+  {
+    TraceDecoderPut(&Decoder, Stream[i]);
+  }
+  
+  TraceDecoderFinish(&Decoder);
+  *pDiscarded = Decoder.Discarded;
+}
+
+static unsigned char SameRecord(const tTraceDecoderRecord* pA,
+                                const tTraceDecoderRecord* pB)
+{
+  return (   pA->Id == pB->Id 
+          && pA->Arg1 == pB->Arg1 
+          && pA->Timestamp == pB->Timestamp 
+          && pA->Arg2 == pB->Arg2 );
+}
+
+/* one record in four has the start byte in every argument byte */
+static void RandomRecord(tTraceDecoderRecord* pRecord, unsigned int Number)
+{
+  unsigned char Start = (HostRandom() & 0x03) == 0;
+  
+  pRecord->Id = Start ? TRACE_RECORD_START : HostRandom() & 0x07;
+  pRecord->Arg1 = Start ? TRACE_RECORD_START : HostRandom();
+  pRecord->Timestamp = Number;
+  pRecord->Arg2 = Start ? 0x1E1E : HostRandom();
+}
+
+static void TestCheckValue(void)
+{
+  CHECK_EQUAL(0x29B1, Crc16(CRC16_INIT, (const unsigned char*)"123456789", 9));
+  
+  /* the CRC can be computed in pieces */
+  unsigned int Crc = Crc16(CRC16_INIT, (const unsigned char*)"1234", 4);
+  CHECK_EQUAL(0x29B1, Crc16(Crc, (const unsigned char*)"56789", 5));
+}
+
+/* text and records, some with start bytes in the arguments */
+static void TestTextAndRecords(void)
+{
+  tTraceDecoderRecord Sent[3] = 
+  {
+    { TRACE_MESSAGE, 0x1E, 0x001E, 0x1E1E },
+    { TRACE_BUFFER_STATUS, 0x02, 0x1E00, 0x0102 },
+    { TRACE_RECORD_START, TRACE_RECORD_START, 0xFFFF, 0x0000 },
+  };
+  static tOutput Output;
+  unsigned long Discarded;
+  
+  StreamLength = 0;
+  PutText("Idle\r\n");
+  PutFrame(&Sent[0]);
+  PutFrame(&Sent[1]);
+  PutText("Buffers 20\r\n");
+  PutFrame(&Sent[2]);
+  
+  Decode(&Output, &Discarded);
+  
+  CHECK_EQUAL(0, Discarded);
+  CHECK_EQUAL(3, Output.RecordCount);
+  CHECK(SameRecord(&Sent[0], &Output.Records[0]));
+  CHECK(SameRecord(&Sent[1], &Output.Records[1]));
+  CHECK(SameRecord(&Sent[2], &Output.Records[2]));
+  CHECK_EQUAL(18, Output.TextCount);
+  CHECK(memcmp(Output.Text, "Idle\r\nBuffers 20\r\n", 18) == 0);
+}
+
+/* Bytes of some frames are lost.  A damaged frame is only decoded when the 
+ * bytes after it happen to complete a matching CRC (the chance is about 
+ * 1 in 65536 for each start byte that is tried).  Every whole frame is 
+ * decoded unless the frame in front of it took some of its bytes that way.
+ */
+static void TestResync(void)
+{
+  static tTraceDecoderRecord Sent[MAX_RECORDS];
+  static unsigned char Whole[MAX_RECORDS];
+  static tOutput Output;
+  unsigned char Frame[TRACE_FRAME_SIZE];
+  unsigned int WholeCount = 0;
+  unsigned int Missed = 0;
+  unsigned int MadeUp = 0;
+  unsigned long Discarded;
+  unsigned int Round;
+  unsigned int i;
+  unsigned int j;
+  
+  for ( Round = 0; Round < 50; Round++ )
+  {
+    StreamLength = 0;
+    
+    for ( i = 0; i < MAX_RECORDS; i++ )
+    {
+      RandomRecord(&Sent[i], i);
+      
+      unsigned int Start = StreamLength;
+      PutFrame(&Sent[i]);
+      
+      /* one frame in four loses one or two bytes */
+      Whole[i] = (HostRandom() & 0x03) != 0;
+      
+      if ( Whole[i] )
+      {
+        WholeCount++;
+      }
+      else
+      {
+        unsigned int Lost = HostRandom() % TRACE_FRAME_SIZE;
+        unsigned int LostCount = 1 + (HostRandom() & 0x01);
+        
+        memcpy(Frame, &Stream[Start], TRACE_FRAME_SIZE);
+        StreamLength = Start;
+        
+        for ( j = 0; j < TRACE_FRAME_SIZE; j++ )
+        {
+          if ( j < Lost || j >= Lost + LostCount )
+          {
+            Stream[StreamLength++] = Frame[j];
+          }
+        }
+      }
+    }
+    
+    Decode(&Output, &Discarded);
+    
+    /* the timestamp is the number of the record that was sent */
+    i = 0;
+    for ( j = 0; j < Output.RecordCount; j++ )
+    {
+      unsigned int Number = Output.Records[j].Timestamp;
+      
+      CHECK(Number < MAX_RECORDS && Number >= i);
+      if ( Number >= MAX_RECORDS || Number < i )
+      {
+        break;
+      }
+      
+      if ( !SameRecord(&Sent[Number], &Output.Records[j]) )
+      {
+        CHECK(!Whole[Number]);
+        MadeUp++;
+      }
+      
+      for ( ; i < Number; i++ )
+      {
+        if ( Whole[i] )
+        {
+          CHECK(i > 0 && !Whole[i - 1]);
+          Missed++;
+        }
+      }
+      
+      i = Number + 1;
+    }
+    
+    for ( ; i < MAX_RECORDS; i++ )
+    {
+      CHECK(!Whole[i]);
+    }
+  }
+  
+  printf("whole frames %u, missed after a damaged frame %u, made up %u\n", 
+         WholeCount, Missed, MadeUp);
+  CHECK(Missed * 100 < WholeCount);
+  CHECK(MadeUp * 1000 < MAX_RECORDS * Round - WholeCount);
+}
+
+int main(void)
+{
+  TestCheckValue();
+  TestTextAndRecords();
+  TestResync();
+  
+  return HostTestResult("TestTraceDecoder");
+}
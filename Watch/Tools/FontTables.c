@@ -0,0 +1,139 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file FontTables.c
+ *
+ * Host tool that writes Application/FontTables.h: the packed width table of
+ * each LCD font (from FontWidths.c) and the font descriptors that Fonts.c 
+ * uses.  A width is stored as width - 1 in a nibble so it has to be 1 to 16.
+ *
+ * Usage: FontTables > ../Application/FontTables.h
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+
+#include "Fonts.h"
+#include "FontWidths.h"
+
+#define MAX_CHARACTERS ( 256 )
+
+/*! What is known about a font besides its widths */
+typedef struct
+{
+  const char* pName;
+  const char* pTable;
+  unsigned char RowBytes;
+  unsigned char Height;
+  unsigned char Spacing;
+  unsigned char FirstCharacter;
+  const char* pCharacters;
+  unsigned char Characters;
+  const unsigned char* pWidths;
+  
+} tFontSource;
+
+/* in etFontType order; the seconds font has no width table */
+static const tFontSource Fonts[] =
+{
+  { "MetaWatch5", "MetaWatch5table", 1, 5, 1, 0x20, 
+    "PRINTABLE_CHARACTERS", PRINTABLE_CHARACTERS, MetaWatch5width },
+  { "MetaWatch7", "MetaWatch7table", 1, 7, 1, 0x20, 
+    "PRINTABLE_CHARACTERS", PRINTABLE_CHARACTERS, MetaWatch7width },
+  { "MetaWatch16", "MetaWatch16table", 2, 16, 1, 0x20, 
+    "PRINTABLE_CHARACTERS", PRINTABLE_CHARACTERS, MetaWatch16width },
+  { "MetaWatchTime", "MetaWatchTimeTable", 2, 16, 2, 0, 
+    "TOTAL_TIME_CHARACTERS", TOTAL_TIME_CHARACTERS, MetaWatchTimeWidth },
+  { "MetaWatchSeconds", "MetaWatchSecondsTable", 1, 7, 2, 0, 
+    "TOTAL_SECONDS_CHARACTERS", TOTAL_SECONDS_CHARACTERS, 0 },
+  { "StatusIcons", "StatusIconsTable", 1, 5, 0, 0, 
+    "TOTAL_STATUS_ICONS", TOTAL_STATUS_ICONS, StatusIconsWidth },
+};
+
+#define NUMBER_OF_FONTS ( sizeof(Fonts) / sizeof(Fonts[0]) )
+
+/* \return 0 if a width does not fit in a nibble */
+static int WritePackedWidths(const tFontSource* pFont)
+{
+  unsigned char Packed[MAX_CHARACTERS / 2] = { 0 };
+  unsigned int Bytes = (pFont->Characters + 1) / 2;
+  unsigned int i;
+  
+  for ( i = 0; i < pFont->Characters; i++ )
+  {
+    unsigned int Width = 
+      pFont->pWidths ? pFont->pWidths[i] : SECONDS_CHARACTER_WIDTH;
+    
+    if ( Width < 1 || Width > 16 )
+    {
+      fprintf(stderr, "%s character %u is %u wide\n", 
+              pFont->pName, i, Width);
+      return 0;
+    }
+    
+    Packed[i / 2] |= (Width - 1) << ((i & 0x01) * 4);
+  }
+  
+  printf("static const unsigned char %sPackedWidths[%u] =\n{", 
+         pFont->pName, Bytes);
+  
+  for ( i = 0; i < Bytes; i++ )
+  {
+    printf("%s0x%02X,", (i % 10) ? " " : "\n  ", Packed[i]);
+  }
+  
+  printf("\n};\n\n");
+  return 1;
+}
+
+int main(void)
+{
+  unsigned int i;
+  
+  printf("/* Generated by Tools/FontTables from Tools/FontWidths.c; "
+         "do not edit. */\n\n");
+  
+  for ( i = 0; i < NUMBER_OF_FONTS; i++ )
+  {
+    if ( !WritePackedWidths(&Fonts[i]) )
+    {
+      return 1;
+    }
+  }
+  
+  printf("/*! The LCD fonts in etFontType order */\n");
+  printf("static const tFontDescriptor FontDescriptors[] =\n{\n");
+  
+  for ( i = 0; i < NUMBER_OF_FONTS; i++ )
+  {
+    const tFontSource* pFont = &Fonts[i];
+    
+    printf("  /* %s */\n", pFont->pName);
+    printf("  { %s, %u, %u, %u, 0x%02X, %s,\n    %sPackedWidths },\n",
+           pFont->pTable, pFont->RowBytes, pFont->Height, pFont->Spacing,
+           pFont->FirstCharacter, pFont->pCharacters, pFont->pName);
+    
+    if ( i + 1 < NUMBER_OF_FONTS )
+    {
+      printf("  \n");
+    }
+  }
+  
+  printf("};\n");
+  return 0;
+}
@@ -0,0 +1,358 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file FontWidths.c
+*
+* Character widths of the LCD fonts (moved from Application/Fonts.c)
+*/
+/******************************************************************************/
+
+#include "Fonts.h"
+#include "FontWidths.h"
+
+const unsigned char MetaWatch5width[PRINTABLE_CHARACTERS] = 
+{
+/*		width    char    hexcode */
+/*		=====    ====    ======= */
+        2, /*  '  '    20      */
+  		  1, /*   !      21      */
+  		  3, /*   "      22      */
+  		  5, /*   #      23      */
+  		  3, /*   $      24      */
+  		  3, /*   %      25      */
+  		  5, /*   &      26      */
+  		  1, /*   '      27      */
+  		  2, /*   (      28      */
+  		  2, /*   )      29      */
+  		  5, /*   *      2A      */
+  		  5, /*   +      2B      */
+  		  1, /*   ,      2C      */
+  		  3, /*   -      2D      */
+  		  1, /*   .      2E      */
+  		  5, /*   /      2F      */
+  		  4, /*   0      30      */
+  		  3, /*   1      31      */
+  		  4, /*   2      32      */
+  		  4, /*   3      33      */
+  		  4, /*   4      34      */
+  		  4, /*   5      35      */
+  		  4, /*   6      36      */
+  		  4, /*   7      37      */
+  		  4, /*   8      38      */
+  		  4, /*   9      39      */
+  		  1, /*   :      3A      */
+  		  2, /*   ;      3B      */
+  		  3, /*   <      3C      */
+  		  4, /*   =      3D      */
+  		  3, /*   >      3E      */
+  		  3, /*   ?      3F      */
+  		  3, /*   @      40      */
+  		  5, /*   A      41      */
+  		  4, /*   B      42      */
+  		  4, /*   C      43      */
+  		  4, /*   D      44      */
+  		  4, /*   E      45      */
+  		  4, /*   F      46      */
+  		  4, /*   G      47      */
+  		  4, /*   H      48      */
+  		  3, /*   I      49      */
+  		  4, /*   J      4A      */
+  		  4, /*   K      4B      */
+  		  4, /*   L      4C      */
+  		  5, /*   M      4D      */
+  		  5, /*   N      4E      */
+  		  4, /*   O      4F      */
+  		  4, /*   P      50      */
+  		  5, /*   Q      51      */
+  		  4, /*   R      52      */
+  		  4, /*   S      53      */
+  		  3, /*   T      54      */
+  		  4, /*   U      55      */
+  		  5, /*   V      56      */
+  		  5, /*   W      57      */
+  		  4, /*   X      58      */
+  		  5, /*   Y      59      */
+  		  4, /*   Z      5A      */
+  		  2, /*   [      5B      */
+  		  5, /*   \      5C      */
+  		  2, /*   ]      5D      */
+  		  5, /*   ^      5E      */
+  		  4, /*   _      5F      */
+  		  1, /*   `      60      */
+  		  5, /*   a      61      */
+  		  4, /*   b      62      */
+  		  4, /*   c      63      */
+  		  4, /*   d      64      */
+  		  4, /*   e      65      */
+  		  4, /*   f      66      */
+  		  4, /*   g      67      */
+  		  4, /*   h      68      */
+  		  3, /*   i      69      */
+  		  4, /*   j      6A      */
+  		  4, /*   k      6B      */
+  		  4, /*   l      6C      */
+  		  5, /*   m      6D      */
+  		  5, /*   n      6E      */
+  		  4, /*   o      6F      */
+  		  4, /*   p      70      */
+  		  5, /*   q      71      */
+  		  4, /*   r      72      */
+  		  4, /*   s      73      */
+  		  3, /*   t      74      */
+  		  4, /*   u      75      */
+  		  5, /*   v      76      */
+  		  5, /*   w      77      */
+  		  4, /*   x      78      */
+  		  5, /*   y      79      */
+  		  4, /*   z      7A      */
+  		  3, /*   {      7B      */
+  		  1, /*   |      7C      */
+  		  3, /*   }      7D      */
+};
+
+const unsigned char MetaWatch7width[PRINTABLE_CHARACTERS] = {
+/*		width    char    hexcode */
+/*		=====    ====    ======= */
+        2, /*  '  '    20      */
+  		  1, /*   !      21      */
+  		  3, /*   "      22      */
+  		  7, /*   #      23      */
+  		  5, /*   $      24      */
+  		  7, /*   %      25      */
+  		  5, /*   &      26      */
+  		  3, /*   '      27      */
+  		  3, /*   (      28      */
+  		  3, /*   )      29      */
+  		  7, /*   *      2A      */
+  		  5, /*   +      2B      */
+  		  1, /*   ,      2C      */
+  		  4, /*   -      2D      */
+  		  1, /*   .      2E      */
+  		  4, /*   /      2F      */
+  		  4, /*   0      30      */
+  		  2, /*   1      31      */
+  		  4, /*   2      32      */
+  		  4, /*   3      33      */
+  		  5, /*   4      34      */
+  		  4, /*   5      35      */
+  		  4, /*   6      36      */
+  		  4, /*   7      37      */
+  		  4, /*   8      38      */
+  		  4, /*   9      39      */
+  		  1, /*   :      3A      */
+  		  1, /*   ;      3B      */
+  		  3, /*   <      3C      */
+  		  4, /*   =      3D      */
+  		  3, /*   >      3E      */
+  		  4, /*   ?      3F      */
+  		  7, /*   @      40      */
+  		  7, /*   A      41      */
+  		  5, /*   B      42      */
+  		  5, /*   C      43      */
+  		  5, /*   D      44      */
+  		  4, /*   E      45      */
+  		  4, /*   F      46      */
+  		  6, /*   G      47      */
+  		  5, /*   H      48      */
+  		  3, /*   I      49      */
+  		  5, /*   J      4A      */
+  		  5, /*   K      4B      */
+  		  4, /*   L      4C      */
+  		  7, /*   M      4D      */
+  		  6, /*   N      4E      */
+  		  6, /*   O      4F      */
+  		  4, /*   P      50      */
+  		  7, /*   Q      51      */
+  		  5, /*   R      52      */
+  		  4, /*   S      53      */
+  		  5, /*   T      54      */
+  		  5, /*   U      55      */
+  		  7, /*   V      56      */
+  		  7, /*   W      57      */
+  		  5, /*   X      58      */
+  		  7, /*   Y      59      */
+  		  5, /*   Z      5A      */
+  		  3, /*   [      5B      */
+  		  4, /*   \      5C      */
+  		  3, /*   ]      5D      */
+  		  5, /*   ^      5E      */
+  		  5, /*   _      5F      */
+  		  1, /*   `      60      */
+  		  7, /*   a      61      */
+  		  5, /*   b      62      */
+  		  5, /*   c      63      */
+  		  5, /*   d      64      */
+  		  4, /*   e      65      */
+  		  4, /*   f      66      */
+  		  6, /*   g      67      */
+  		  5, /*   h      68      */
+  		  3, /*   i      69      */
+  		  5, /*   j      6A      */
+  		  5, /*   k      6B      */
+  		  4, /*   l      6C      */
+  		  7, /*   m      6D      */
+  		  6, /*   n      6E      */
+  		  6, /*   o      6F      */
+  		  4, /*   p      70      */
+  		  7, /*   q      71      */
+  		  5, /*   r      72      */
+  		  4, /*   s      73      */
+  		  5, /*   t      74      */
+  		  5, /*   u      75      */
+  		  7, /*   v      76      */
+  		  7, /*   w      77      */
+  		  5, /*   x      78      */
+  		  7, /*   y      79      */
+  		  5, /*   z      7A      */
+  		  3, /*   {      7B      */
+  		  1, /*   |      7C      */
+  		  3, /*   }      7D      */
+};
+
+const unsigned char MetaWatch16width[PRINTABLE_CHARACTERS] = 
+{
+/*		width    char    hexcode */
+/*		=====    ====    ======= */
+        4, /*  '  '    20      */
+  		  2, /*   !      21      */
+  		  5, /*   "      22      */
+  		 12, /*   #      23      */
+  		  6, /*   $      24      */
+  		 10, /*   %      25      */
+  		 10, /*   &      26      */
+  		  2, /*   '      27      */
+  		  4, /*   (      28      */
+  		  4, /*   )      29      */
+  		  8, /*   *      2A      */
+  		  8, /*   +      2B      */
+  		  2, /*   ,      2C      */
+  		  8, /*   -      2D      */
+  		  2, /*   .      2E      */
+  		  6, /*   /      2F      */
+  		  7, /*   0      30      */
+  		  3, /*   1      31      */
+  		  6, /*   2      32      */
+  		  6, /*   3      33      */
+  		  7, /*   4      34      */
+  		  6, /*   5      35      */
+  		  6, /*   6      36      */
+  		  6, /*   7      37      */
+  		  6, /*   8      38      */
+  		  6, /*   9      39      */
+  		  2, /*   :      3A      */
+  		  2, /*   ;      3B      */
+  		  8, /*   <      3C      */
+  		  7, /*   =      3D      */
+  		  8, /*   >      3E      */
+  		  6, /*   ?      3F      */
+  		 11, /*   @      40      */
+  		  9, /*   A      41      */
+  		  7, /*   B      42      */
+  		  7, /*   C      43      */
+  		  7, /*   D      44      */
+  		  7, /*   E      45      */
+  		  6, /*   F      46      */
+  		  7, /*   G      47      */
+  		  7, /*   H      48      */
+  		  4, /*   I      49      */
+  		  6, /*   J      4A      */
+  		  7, /*   K      4B      */
+  		  6, /*   L      4C      */
+  		 11, /*   M      4D      */
+  		  9, /*   N      4E      */
+  		  7, /*   O      4F      */
+  		  7, /*   P      50      */
+  		  8, /*   Q      51      */
+  		  7, /*   R      52      */
+  		  6, /*   S      53      */
+  		  6, /*   T      54      */
+  		  7, /*   U      55      */
+  		  7, /*   V      56      */
+  		 11, /*   W      57      */
+  		  7, /*   X      58      */
+  		  8, /*   Y      59      */
+  		  7, /*   Z      5A      */
+  		  4, /*   [      5B      */
+  		  6, /*   \      5C      */
+  		  4, /*   ]      5D      */
+  		  7, /*   ^      5E      */
+  		  9, /*   _      5F      */
+  		  3, /*   `      60      */
+  		  6, /*   a      61      */
+  		  6, /*   b      62      */
+  		  6, /*   c      63      */
+  		  6, /*   d      64      */
+  		  6, /*   e      65      */
+  		  4, /*   f      66      */
+  		  6, /*   g      67      */
+  		  6, /*   h      68      */
+  		  2, /*   i      69      */
+  		  5, /*   j      6A      */
+  		  6, /*   k      6B      */
+  		  2, /*   l      6C      */
+  		 10, /*   m      6D      */
+  		  6, /*   n      6E      */
+  		  6, /*   o      6F      */
+  		  6, /*   p      70      */
+  		  6, /*   q      71      */
+  		  5, /*   r      72      */
+  		  5, /*   s      73      */
+  		  4, /*   t      74      */
+  		  6, /*   u      75      */
+  		  7, /*   v      76      */
+  		 11, /*   w      77      */
+  		  7, /*   x      78      */
+  		  6, /*   y      79      */
+  		  6, /*   z      7A      */
+  		  4, /*   {      7B      */
+  		  2, /*   |      7C      */
+  		  4, /*   }      7D      */
+};
+
+const unsigned char MetaWatchTimeWidth[TOTAL_TIME_CHARACTERS] = 
+{
+/*		width    char    hexcode */
+/*		=====    ====    ======= */
+		 16, /*   0      30      */
+		 16, /*   1      31      */
+		 16, /*   2      32      */
+		 16, /*   3      33      */
+		 16, /*   4      34      */
+		 16, /*   5      35      */
+		 16, /*   6      36      */
+		 16, /*   7      37      */
+		 16, /*   8      38      */
+		 16, /*   9      39      */
+		  4, /*   :      3A      */
+		 16, /*   ;      3B      */
+};
+
+const unsigned char StatusIconsWidth[TOTAL_STATUS_ICONS] =
+{
+		/*		width    char    hexcode */
+		/*		=====    ====    ======= */
+		  		  5, /*   0      30      */
+		  		  3, /*   1      31      */
+		  		  8, /*   2      32      */
+		  		  8, /*   3      33      */
+		  		  8, /*   4      34      */
+		  		  5, /*   5      35      */
+		  		  5, /*   6      36      */
+		  		  5, /*   7      37      */
+		  		  5, /*   8      38      */
+		  		  2, /*   9      39      */
+};
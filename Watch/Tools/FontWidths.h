@@ -0,0 +1,39 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+
+/******************************************************************************/
+/*! \file FontWidths.h
+ *
+ * The width of each character of the LCD fonts.  These are the source of 
+ * the packed width tables in Application/FontTables.h; edit them here and 
+ * run Tools/FontTables.
+ */
+/******************************************************************************/
+
+#ifndef FONT_WIDTHS_H
+#define FONT_WIDTHS_H
+
+/*! every character of the seconds font is this wide */
+#define SECONDS_CHARACTER_WIDTH ( 7 )
+
+extern const unsigned char MetaWatch5width[PRINTABLE_CHARACTERS];
+extern const unsigned char MetaWatch7width[PRINTABLE_CHARACTERS];
+extern const unsigned char MetaWatch16width[PRINTABLE_CHARACTERS];
+extern const unsigned char MetaWatchTimeWidth[TOTAL_TIME_CHARACTERS];
+extern const unsigned char StatusIconsWidth[TOTAL_STATUS_ICONS];
+
+#endif /* FONT_WIDTHS_H */
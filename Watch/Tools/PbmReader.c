@@ -0,0 +1,161 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file PbmReader.c
+ *
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "Templates.h"
+#include "PbmReader.h"
+
+typedef struct
+{
+  const unsigned char* pFile;
+  unsigned int Size;
+  unsigned int Position;
+  
+} tPbmInput;
+
+static int IsSpace(unsigned char Byte)
+{
+  return Byte == ' ' || Byte == '\t' || Byte == '\n' || 
+         Byte == '\r' || Byte == '\v' || Byte == '\f';
+}
+
+/* skip white space and comments (a comment runs to the end of the line) */
+static void SkipSpace(tPbmInput* pInput)
+{
+  while ( pInput->Position < pInput->Size )
+  {
+    unsigned char Byte = pInput->pFile[pInput->Position];
+    
+    if ( Byte == '#' )
+    {
+      while ( pInput->Position < pInput->Size &&
+              pInput->pFile[pInput->Position] != '\n' )
+      {
+        pInput->Position++;
+      }
+    }
+    else if ( IsSpace(Byte) )
+    {
+      pInput->Position++;
+    }
+    else
+    {
+      break;
+    }
+  }
+}
+
+/* \return the number or 0 if there is none */
+static unsigned int ReadNumber(tPbmInput* pInput)
+{
+  unsigned int Number = 0;
+  
+  SkipSpace(pInput);
+  
+  while ( pInput->Position < pInput->Size &&
+          pInput->pFile[pInput->Position] >= '0' &&
+          pInput->pFile[pInput->Position] <= '9' &&
+          Number < 10000 )
+  {
+    Number = 10 * Number + pInput->pFile[pInput->Position++] - '0';
+  }
+  
+  return Number;
+}
+
+static void SetPixel(unsigned char* pRows, unsigned int Pixel)
+{
+  pRows[Pixel >> 3] |= 1 << (Pixel & 0x07);
+}
+
+unsigned int ReadPbm(const unsigned char* pFile,
+                     unsigned int FileSize,
+                     unsigned char* pRows,
+                     unsigned int Size)
+{
+  tPbmInput Input = { pFile, FileSize, 2 };
+  unsigned int Width;
+  unsigned int Height;
+  unsigned int Pixel;
+  unsigned int Pixels;
+  
+  if ( FileSize < 2 || pFile[0] != 'P' || 
+       (pFile[1] != '1' && pFile[1] != '4') )
+  {
+    return 0;
+  }
+  
+  Width = ReadNumber(&Input);
+  Height = ReadNumber(&Input);
+  
+  if ( Width != PBM_WIDTH || Height == 0 ||
+       Height * TEMPLATE_BYTES_PER_LINE > Size )
+  {
+    return 0;
+  }
+  
+  Pixels = Width * Height;
+  memset(pRows, 0, Height * TEMPLATE_BYTES_PER_LINE);
+  
+  if ( pFile[1] == '1' )
+  {
+    for ( Pixel = 0; Pixel < Pixels; Pixel++ )
+    {
+      SkipSpace(&Input);
+      
+      if ( Input.Position == FileSize )
+      {
+        return 0;
+      }
+      
+      switch ( pFile[Input.Position++] )
+      {
+      case '1': SetPixel(pRows, Pixel); break;
+      case '0': break;
+      default:  return 0;
+      }
+    }
+  }
+  else
+  {
+    /* one white space character separates the header from the bits */
+    if ( Input.Position == FileSize || !IsSpace(pFile[Input.Position]) ||
+         FileSize - Input.Position - 1 < Pixels / 8 )
+    {
+      return 0;
+    }
+    
+    Input.Position++;
+    
+    /* a line is a whole number of bytes, the first pixel is the msb */
+    for ( Pixel = 0; Pixel < Pixels; Pixel++ )
+    {
+      if ( pFile[Input.Position + Pixel / 8] & (0x80 >> (Pixel & 0x07)) )
+      {
+        SetPixel(pRows, Pixel);
+      }
+    }
+  }
+  
+  return Height * TEMPLATE_BYTES_PER_LINE;
+}
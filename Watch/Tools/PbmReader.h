@@ -0,0 +1,47 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file PbmReader.h
+ *
+ * Reads a portable bitmap (PBM, plain P1 or raw P4) into rows in the layout 
+ * of the display buffers: 12 bytes a line, the leftmost pixel in bit 0 and 
+ * 1 for black.  Other formats (PNG) can be converted with netpbm, for 
+ * example pngtopnm image.png | pamditherbw | pnmtoplainpnm.
+ */
+/******************************************************************************/
+
+#ifndef PBM_READER_H
+#define PBM_READER_H
+
+/*! the width of an image has to be the width of the display */
+#define PBM_WIDTH ( 96 )
+
+/*! Read an image
+ *
+ * \param pFile is the contents of the file
+ * \param FileSize is the number of bytes in pFile
+ * \param pRows is where the lines go
+ * \param Size is the room in pRows
+ * \return the number of bytes in pRows or 0 if the file is not a PBM that 
+ * is PBM_WIDTH wide or it does not fit
+ */
+unsigned int ReadPbm(const unsigned char* pFile,
+                     unsigned int FileSize,
+                     unsigned char* pRows,
+                     unsigned int Size);
+
+#endif /* PBM_READER_H */
@@ -0,0 +1,93 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file PbmTemplate.c
+ *
+ * Host tool that turns a 96 pixel wide PBM image into a template (see 
+ * Templates.h).  The array it writes goes into Templates.c and the Templates 
+ * table.  The same commands can be sent in WriteBufferPacked messages; a 
+ * screen that the phone sends once can be kept in serial ram with 
+ * CachedPageMsg and loaded again with one message.
+ *
+ * Usage: PbmTemplate name [image.pbm]  (stdin without a file)
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+
+#include "Templates.h"
+#include "PbmReader.h"
+#include "TemplateEncoder.h"
+
+#define MAX_FILE_SIZE ( 64 * 1024 )
+#define BYTES_PER_SCREEN ( PBM_WIDTH * TEMPLATE_BYTES_PER_LINE )
+#define VALUES_PER_LINE ( 12 )
+
+int main(int argc, char* argv[])
+{
+  static unsigned char File[MAX_FILE_SIZE];
+  static unsigned char Rows[BYTES_PER_SCREEN];
+  static unsigned char Template[2 * BYTES_PER_SCREEN];
+  FILE* pFile = stdin;
+  unsigned int FileSize;
+  unsigned int Size;
+  unsigned int Length;
+  unsigned int i;
+  
+  if ( argc < 2 || argc > 3 )
+  {
+    fprintf(stderr, "usage: %s name [image.pbm]\n", argv[0]);
+    return 2;
+  }
+  
+  if ( argc == 3 )
+  {
+    pFile = fopen(argv[2], "rb");
+    if ( pFile == NULL )
+    {
+      perror(argv[2]);
+      return 1;
+    }
+  }
+  
+  FileSize = fread(File, 1, sizeof(File), pFile);
+  
+  Size = ReadPbm(File, FileSize, Rows, sizeof(Rows));
+  if ( Size == 0 )
+  {
+    fprintf(stderr, "not a PBM image %u pixels wide and at most %u high\n",
+            PBM_WIDTH, PBM_WIDTH);
+    return 1;
+  }
+  
+  Length = EncodeTemplate(Rows, Size, Template, sizeof(Template));
+  
+  printf("/* %u lines in %u bytes */\n", Size / TEMPLATE_BYTES_PER_LINE, 
+         Length);
+  printf("static const unsigned char p%sTemplate[] =\n{", argv[1]);
+  
+  for ( i = 0; i < Length; i++ )
+  {
+    printf("%s0x%02X", 
+           i % VALUES_PER_LINE ? "," : ( i ? ",\n  " : "\n  " ),
+           Template[i]);
+  }
+  
+  printf("\n};\n");
+  
+  return 0;
+}
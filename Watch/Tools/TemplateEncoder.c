@@ -0,0 +1,135 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TemplateEncoder.c
+ *
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+#include "Templates.h"
+#include "TemplateEncoder.h"
+
+#define MAX_COMMAND_LENGTH ( TEMPLATE_LENGTH_MASK + 1 )
+#define MIN_RUN            ( 3 )
+
+/* \return the number of whole lines from Position that are the same as the
+ * line in front of them (the first line is compared with a blank line)
+ */
+static unsigned int RepeatedLines(const unsigned char* pRows,
+                                  unsigned int Size,
+                                  unsigned int Position)
+{
+  static const unsigned char Blank[TEMPLATE_BYTES_PER_LINE];
+  const unsigned char* pLast = 
+    Position ? &pRows[Position - TEMPLATE_BYTES_PER_LINE] : Blank;
+  unsigned int Lines = 0;
+  
+  while (   Position + TEMPLATE_BYTES_PER_LINE <= Size 
+         && Lines < MAX_COMMAND_LENGTH
+         && memcmp(&pRows[Position], pLast, TEMPLATE_BYTES_PER_LINE) == 0 )
+  {
+    Position += TEMPLATE_BYTES_PER_LINE;
+    Lines++;
+  }
+  
+  return Lines;
+}
+
+static unsigned int RunLength(const unsigned char* pRows,
+                              unsigned int Size,
+                              unsigned int Position)
+{
+  unsigned int Length = 1;
+  
+  while (   Position + Length < Size 
+         && Length < MAX_COMMAND_LENGTH
+         && pRows[Position + Length] == pRows[Position] )
+  {
+    Length++;
+  }
+  
+  return Length;
+}
+
+unsigned int EncodeTemplate(const unsigned char* pRows,
+                            unsigned int Size,
+                            unsigned char* pOut,
+                            unsigned int OutSize)
+{
+  unsigned int Position = 0;
+  unsigned int Out = 0;
+  
+  while ( Position < Size )
+  {
+    unsigned int Lines = 0;
+    unsigned int Length;
+    
+    if ( Position % TEMPLATE_BYTES_PER_LINE == 0 )
+    {
+      Lines = RepeatedLines(pRows, Size, Position);
+    }
+    
+    if ( Lines )
+    {
+      if ( Out + 1 > OutSize )
+      {
+        return 0;
+      }
+      
+      pOut[Out++] = TEMPLATE_REPEAT_LINE | (Lines - 1);
+      Position += Lines * TEMPLATE_BYTES_PER_LINE;
+    }
+    else if ( (Length = RunLength(pRows, Size, Position)) >= MIN_RUN )
+    {
+      if ( Out + 2 > OutSize )
+      {
+        return 0;
+      }
+      
+      pOut[Out++] = TEMPLATE_RUN | (Length - 1);
+      pOut[Out++] = pRows[Position];
+      Position += Length;
+    }
+    else
+    {
+      /* a literal ends where a run or a repeated line can start */
+      Length = 1;
+      while (   Position + Length < Size 
+             && Length < MAX_COMMAND_LENGTH
+             && RunLength(pRows, Size, Position + Length) < MIN_RUN
+             && (   (Position + Length) % TEMPLATE_BYTES_PER_LINE
+                 || RepeatedLines(pRows, Size, Position + Length) == 0 ) )
+      {
+        Length++;
+      }
+      
+      if ( Out + 1 + Length > OutSize )
+      {
+        return 0;
+      }
+      
+      pOut[Out++] = TEMPLATE_LITERAL | (Length - 1);
+      memcpy(&pOut[Out], &pRows[Position], Length);
+      Out += Length;
+      Position += Length;
+    }
+  }
+  
+  return Out;
+}
@@ -0,0 +1,44 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TemplateEncoder.h
+ *
+ * Host reference encoder for the template format (see Templates.h) that is 
+ * used by templates and WriteBufferPacked messages.  It is greedy, not 
+ * optimal: a repeat of the last line is used at the start of a line, runs 
+ * of three or more bytes are used anywhere and everything else is a 
+ * literal.
+ */
+/******************************************************************************/
+
+#ifndef TEMPLATE_ENCODER_H
+#define TEMPLATE_ENCODER_H
+
+/*! Encode rows 
+ *
+ * \param pRows is the data (whole lines of TEMPLATE_BYTES_PER_LINE)
+ * \param Size is the number of bytes of data
+ * \param pOut is where the commands go
+ * \param OutSize is the room in pOut
+ * \return the number of bytes in pOut or 0 if they do not fit
+ */
+unsigned int EncodeTemplate(const unsigned char* pRows,
+                            unsigned int Size,
+                            unsigned char* pOut,
+                            unsigned int OutSize);
+
+#endif /* TEMPLATE_ENCODER_H */
@@ -0,0 +1,106 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceDecode.c
+ *
+ * Host tool that decodes a capture of the debug uart.  The text is copied 
+ * to stdout and each trace record is written on its own line:
+ *
+ *   #T <time ms> <event> <Arg1> <Arg2>
+ *
+ * Usage: TraceDecode [capture file]  (stdin without a file)
+ */
+/******************************************************************************/
+
+#include <stdio.h>
+
+typedef char tString;
+
+#include "DebugUart.h"
+#include "TraceDecoder.h"
+
+/* the crystal timer runs at 1024 Hz */
+#define TIMESTAMP_TO_MS ( 1000.0 / 1024.0 )
+
+static const char* GetEventName(unsigned char Id)
+{
+  switch (Id)
+  {
+  case TRACE_LOST:            return "LOST";
+  case TRACE_MESSAGE:         return "MESSAGE";
+  case TRACE_UNKNOWN_MESSAGE: return "UNKNOWN_MESSAGE";
+  case TRACE_UPDATE_DISPLAY:  return "UPDATE_DISPLAY";
+  case TRACE_BUFFER_STATUS:   return "BUFFER_STATUS";
+  default:                    return "EVENT";
+  }
+}
+
+static void WriteText(void* pContext, unsigned char Byte)
+{
+  (void)pContext;
+  putchar(Byte);
+}
+
+static void WriteRecord(void* pContext, const tTraceDecoderRecord* pRecord)
+{
+  (void)pContext;
+  printf("\n#T %.3f %s(0x%02x) 0x%02x 0x%04x\n",
+         pRecord->Timestamp * TIMESTAMP_TO_MS,
+         GetEventName(pRecord->Id),
+         pRecord->Id,
+         pRecord->Arg1,
+         pRecord->Arg2);
+}
+
+int main(int argc, char* argv[])
+{
+  FILE* pFile = stdin;
+  tTraceDecoder Decoder;
+  int Byte;
+  
+  if ( argc > 2 )
+  {
+    fprintf(stderr, "usage: %s [capture file]\n", argv[0]);
+    return 2;
+  }
+  
+  if ( argc == 2 )
+  {
+    pFile = fopen(argv[1], "rb");
+    if ( pFile == NULL )
+    {
+      perror(argv[1]);
+      return 1;
+    }
+  }
+  
+  TraceDecoderInit(&Decoder, WriteText, WriteRecord, NULL);
+  
+  while ( (Byte = getc(pFile)) != EOF )
+  {
+    TraceDecoderPut(&Decoder, (unsigned char)Byte);
+  }
+  
+  TraceDecoderFinish(&Decoder);
+  
+  if ( Decoder.Discarded )
+  {
+    fprintf(stderr, "%lu damaged frames\n", Decoder.Discarded);
+  }
+  
+  return 0;
+}
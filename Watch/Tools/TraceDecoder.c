@@ -0,0 +1,123 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceDecoder.c
+ *
+ */
+/******************************************************************************/
+
+#include <string.h>
+
+typedef char tString;
+
+#include "DebugUart.h"
+#include "Crc16.h"
+#include "TraceDecoder.h"
+
+#if TRACE_DECODER_WINDOW != TRACE_FRAME_SIZE
+  #error "The decoder window must hold a trace frame"
+#endif
+
+void TraceDecoderInit(tTraceDecoder* pDecoder,
+                      void (*pText)(void* pContext, unsigned char Byte),
+                      void (*pRecord)(void* pContext, 
+                                      const tTraceDecoderRecord* pRecord),
+                      void* pContext)
+{
+  memset(pDecoder, 0, sizeof(tTraceDecoder));
+  pDecoder->pText = pText;
+  pDecoder->pRecord = pRecord;
+  pDecoder->pContext = pContext;
+}
+
+static void Shift(tTraceDecoder* pDecoder, unsigned char Bytes)
+{
+  pDecoder->Count -= Bytes;
+  memmove(pDecoder->Window, pDecoder->Window + Bytes, pDecoder->Count);
+}
+
+static unsigned char IsFrame(const unsigned char* pFrame)
+{
+  unsigned int Crc = Crc16(CRC16_INIT, pFrame, TRACE_FRAME_SIZE - 2);
+  
+  return (   pFrame[TRACE_FRAME_SIZE - 2] == (unsigned char)Crc
+          && pFrame[TRACE_FRAME_SIZE - 1] == (unsigned char)(Crc >> 8) );
+}
+
+void TraceDecoderPut(tTraceDecoder* pDecoder, unsigned char Byte)
+{
+  pDecoder->Window[pDecoder->Count++] = Byte;
+  
+  while ( pDecoder->Count )
+  {
+    unsigned char* pFrame = pDecoder->Window;
+    
+    if ( pFrame[0] != TRACE_RECORD_START )
+    {
+      pDecoder->pText(pDecoder->pContext, pFrame[0]);
+      Shift(pDecoder, 1);
+    }
+    else if ( pDecoder->Count < TRACE_FRAME_SIZE )
+    {
+      break;
+    }
+    else if ( IsFrame(pFrame) )
+    {
+      tTraceDecoderRecord Record;
+      
+      Record.Id = pFrame[1];
+      Record.Arg1 = pFrame[2];
+      Record.Timestamp = pFrame[3] | (pFrame[4] << 8);
+      Record.Arg2 = pFrame[5] | (pFrame[6] << 8);
+      pDecoder->pRecord(pDecoder->pContext, &Record);
+      Shift(pDecoder, TRACE_FRAME_SIZE);
+    }
+    else
+    {
+      /* the start of a frame that lost bytes or a start byte in the 
+       * arguments of a frame that lost its start 
+       */
+      pDecoder->Discarded++;
+      Shift(pDecoder, 1);
+    }
+  }
+  
+}
+
+void TraceDecoderFinish(tTraceDecoder* pDecoder)
+{
+  unsigned char Rest[TRACE_FRAME_SIZE];
+  unsigned char Count;
+  unsigned char i;
+  
+  /* the window starts with a start byte without a whole frame; the bytes 
+   * after it are decoded again 
+   */
+  while ( pDecoder->Count )
+  {
+    pDecoder->Discarded++;
+    Count = pDecoder->Count - 1;
+    memcpy(Rest, pDecoder->Window + 1, Count);
+    pDecoder->Count = 0;
+    
+    for ( i = 0; i < Count; i++ )
+    {
+      TraceDecoderPut(pDecoder, Rest[i]);
+    }
+  }
+  
+}
@@ -0,0 +1,74 @@
+//==============================================================================
+//  Copyright 2011 Meta Watch Ltd. - http://www.MetaWatch.org/
+// 
+//  Licensed under the Meta Watch License, Version 1.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//  
+//      http://www.MetaWatch.org/licenses/license-1.0.html
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//==============================================================================
+
+/******************************************************************************/
+/*! \file TraceDecoder.h
+ *
+ * Separates the text and the trace records that the debug uart sends (the 
+ * frame format is described with the trace event ids in DebugUart.h).  This
+ * runs on the host.
+ */
+/******************************************************************************/
+
+#ifndef TRACE_DECODER_H
+#define TRACE_DECODER_H
+
+#define TRACE_DECODER_WINDOW ( 9 )
+
+/*! A trace record as it was sent by TraceEvent */
+typedef struct
+{
+  unsigned char Id;
+  unsigned char Arg1;
+  unsigned int Timestamp;
+  unsigned int Arg2;
+  
+} tTraceDecoderRecord;
+
+/*! Decoder state 
+ *
+ * \param pText is called with each byte of text
+ * \param pRecord is called with each record
+ * \param pContext is passed to the callbacks
+ * \param Window holds the bytes that may be the start of a frame
+ * \param Count is the number of bytes in the window
+ * \param Discarded is the number of start bytes that were not a frame 
+ */
+typedef struct
+{
+  void (*pText)(void* pContext, unsigned char Byte);
+  void (*pRecord)(void* pContext, const tTraceDecoderRecord* pRecord);
+  void* pContext;
+  unsigned char Window[TRACE_DECODER_WINDOW];
+  unsigned char Count;
+  unsigned long Discarded;
+  
+} tTraceDecoder;
+
+/*! Start decoding a stream */
+void TraceDecoderInit(tTraceDecoder* pDecoder,
+                      void (*pText)(void* pContext, unsigned char Byte),
+                      void (*pRecord)(void* pContext, 
+                                      const tTraceDecoderRecord* pRecord),
+                      void* pContext);
+
+/*! Decode the next byte of the stream */
+void TraceDecoderPut(tTraceDecoder* pDecoder, unsigned char Byte);
+
+/*! The stream has ended; the bytes of an incomplete frame are discarded */
+void TraceDecoderFinish(tTraceDecoder* pDecoder);
+
+#endif /* TRACE_DECODER_H */